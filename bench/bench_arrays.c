@@ -0,0 +1,305 @@
+/**
+ * @file bench_arrays.c
+ * @brief benchmarks of the Array and StrictArray APIs
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details Times \c `new_/from_/free_`, \c `push_back_`, \c `get_item_`,
+ * \c `pop_back_` and \c `clear_` for the generic family (elements of 1, 4, 8 and
+ * 64 bytes), the \c `_int` family and a raw C array baseline, for element counts
+ * from 1e2 up to a maximum (1e6 by default, up to 1e8).
+ * Every benchmark runs once to warm up the caches and the allocator, then
+ * \i `repetitions` times (by default enough to time about 1e7 elements, between
+ * 5 and 101 runs); the minimum and the median of the runs are reported.
+ * The raw baseline names its own operations (\c `malloc`, \c `store`, ...) and
+ * gives the operation of the arrays it stands for in \c `counterpart`.
+ * Results are written as CSV on the standard output:
+ * family,type_size,count,operation,counterpart,repetitions,min_ns,median_ns,min_ns_per_element
+ *
+ * Build and run from the repository root:
+ * cc -O2 -std=c11 -I. bench/bench_arrays.c -o bench_arrays
+ * ./bench_arrays [max_count] [repetitions] > bench_output.txt
+ * or with CMake, \c `cmake --build build --target bench` writes
+ * build/bench_output.txt.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../generic/Array.h"
+#include "../generic/StrictArray.h"
+#include "../int/Array.h"
+#include "../int/StrictArray.h"
+
+#define BENCH_MAX_OPERATIONS 16
+#define BENCH_MAX_REPETITIONS 101
+
+/**
+ * @brief the timings of every operation of a benchmark, one per run
+ */
+typedef struct {
+  const char *operation[BENCH_MAX_OPERATIONS];
+  const char *counterpart[BENCH_MAX_OPERATIONS];
+  long long ns[BENCH_MAX_OPERATIONS][BENCH_MAX_REPETITIONS];
+  size_t operations, run;
+  int warm_up;
+} Samples;
+
+static volatile size_t sink;
+
+static long long now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/**
+ * @brief record the time of the next operation of the current run
+ */
+static void record(Samples *samples, const char *operation, const char *counterpart, long long ns) {
+  size_t op = samples->operations++;
+  if (samples->warm_up || op >= BENCH_MAX_OPERATIONS) return;
+  samples->operation[op] = operation;
+  samples->counterpart[op] = counterpart;
+  samples->ns[op][samples->run] = ns;
+}
+
+static int compare_ns(const void *a, const void *b) {
+  long long x = *(const long long*)a, y = *(const long long*)b;
+  return (x > y) - (x < y);
+}
+
+/**
+ * @brief run \i `bench` once to warm up then \i `repetitions` times, and print
+ * the minimum and the median of every operation
+ */
+static void run(const char *family, size_t type_size, size_t count, size_t repetitions,
+                size_t (*bench)(size_t type_size, size_t count, Samples *samples)) {
+  static Samples samples;
+  samples.warm_up = 1, samples.operations = 0;
+  bench(type_size, count, &samples);
+  samples.warm_up = 0;
+  size_t operations = BENCH_MAX_OPERATIONS;
+  for (samples.run = 0; samples.run < repetitions; samples.run++) {
+    samples.operations = 0;
+    // a run that failed to allocate stops early, only the complete operations are kept
+    size_t done = bench(type_size, count, &samples);
+    if (done < operations) operations = done;
+  }
+  if (operations > BENCH_MAX_OPERATIONS) operations = BENCH_MAX_OPERATIONS;
+  for (size_t op = 0; op < operations; op++) {
+    qsort(samples.ns[op], repetitions, sizeof(long long), compare_ns);
+    long long min = samples.ns[op][0], median = samples.ns[op][repetitions / 2];
+    printf("%s,%zu,%zu,%s,%s,%zu,%lld,%lld,%.3f\n", family, type_size, count, samples.operation[op],
+           samples.counterpart[op], repetitions, min, median, (double)min / (double)count);
+  }
+}
+
+static size_t bench_generic(size_t type_size, size_t count, Samples *samples) {
+  char *value = (char*)calloc(1, type_size);
+  StrictArray *arr = NULL, *clone = NULL;
+  Array *fixed = NULL, *fixed_clone = NULL;
+  long long start;
+
+  start = now_ns();
+  if (get_data(new_StrictArray(NULL, 0, count, type_size), (void**)&arr)) goto out;
+  record(samples, "new_StrictArray", "", now_ns() - start);
+
+  start = now_ns();
+  for (size_t i = 0; i < count; i++) {
+    value[0] = (char)i;
+    push_back_StrictArray(arr, value);
+  }
+  record(samples, "push_back_StrictArray", "", now_ns() - start);
+
+  start = now_ns();
+  size_t total = 0;
+  for (size_t i = 0; i < count; i++) {
+    total += *(unsigned char*)get_item(arr, i);
+  }
+  sink = total;
+  record(samples, "get_item", "", now_ns() - start);
+
+  start = now_ns();
+  if (get_data(from_StrictArray(arr), (void**)&clone)) goto out;
+  record(samples, "from_StrictArray", "", now_ns() - start);
+
+  start = now_ns();
+  free_StrictArray(&clone);
+  record(samples, "free_StrictArray", "", now_ns() - start);
+
+  start = now_ns();
+  for (size_t i = 0; i < count; i++) {
+    pop_back_StrictArray(arr);
+  }
+  record(samples, "pop_back_StrictArray", "", now_ns() - start);
+
+  start = now_ns();
+  clear_StrictArray(arr);
+  record(samples, "clear_StrictArray", "", now_ns() - start);
+
+  start = now_ns();
+  if (get_data(new_Array(arr->data, count, count, type_size), (void**)&fixed)) goto out;
+  record(samples, "new_Array", "", now_ns() - start);
+
+  start = now_ns();
+  total = 0;
+  for (size_t i = 0; i < count; i++) {
+    total += *(unsigned char*)get_item_Array(fixed, i);
+  }
+  sink = total;
+  record(samples, "get_item_Array", "", now_ns() - start);
+
+  start = now_ns();
+  if (get_data(from_Array(fixed), (void**)&fixed_clone)) goto out;
+  record(samples, "from_Array", "", now_ns() - start);
+
+  start = now_ns();
+  free_Array(&fixed_clone);
+  record(samples, "free_Array", "", now_ns() - start);
+
+out:
+  free_Array(&fixed);
+  free_StrictArray(&arr);
+  free(value);
+  return samples->operations;
+}
+
+static size_t bench_int(size_t type_size, size_t count, Samples *samples) {
+  (void)type_size;
+  StrictArray_int *arr = NULL, *clone = NULL;
+  Array_int *fixed = NULL, *fixed_clone = NULL;
+  long long start;
+
+  start = now_ns();
+  if (get_data(new_StrictArray_int(NULL, 0, count), (void**)&arr)) goto out;
+  record(samples, "new_StrictArray", "", now_ns() - start);
+
+  start = now_ns();
+  for (size_t i = 0; i < count; i++) {
+    push_back_StrictArray_int(arr, (int)i);
+  }
+  record(samples, "push_back_StrictArray", "", now_ns() - start);
+
+  start = now_ns();
+  size_t total = 0;
+  for (size_t i = 0; i < count; i++) {
+    total += (size_t)*get_item_StrictArray_int(arr, i);
+  }
+  sink = total;
+  record(samples, "get_item", "", now_ns() - start);
+
+  start = now_ns();
+  if (get_data(from_StrictArray_int(arr), (void**)&clone)) goto out;
+  record(samples, "from_StrictArray", "", now_ns() - start);
+
+  start = now_ns();
+  free_StrictArray_int(&clone);
+  record(samples, "free_StrictArray", "", now_ns() - start);
+
+  start = now_ns();
+  for (size_t i = 0; i < count; i++) {
+    pop_back_StrictArray_int(arr);
+  }
+  record(samples, "pop_back_StrictArray", "", now_ns() - start);
+
+  start = now_ns();
+  clear_StrictArray_int(arr);
+  record(samples, "clear_StrictArray", "", now_ns() - start);
+
+  start = now_ns();
+  if (get_data(new_Array_int(arr->data, count, count), (void**)&fixed)) goto out;
+  record(samples, "new_Array", "", now_ns() - start);
+
+  start = now_ns();
+  total = 0;
+  for (size_t i = 0; i < count; i++) {
+    total += (size_t)*get_item_Array_int(fixed, i);
+  }
+  sink = total;
+  record(samples, "get_item_Array", "", now_ns() - start);
+
+  start = now_ns();
+  if (get_data(from_Array_int(fixed), (void**)&fixed_clone)) goto out;
+  record(samples, "from_Array", "", now_ns() - start);
+
+  start = now_ns();
+  free_Array_int(&fixed_clone);
+  record(samples, "free_Array", "", now_ns() - start);
+
+out:
+  free_Array_int(&fixed);
+  free_StrictArray_int(&arr);
+  return samples->operations;
+}
+
+static size_t bench_raw(size_t type_size, size_t count, Samples *samples) {
+  char *value = (char*)calloc(1, type_size);
+  char *clone = NULL;
+  long long start;
+
+  start = now_ns();
+  char *raw = (char*)malloc(type_size * count);
+  if (!raw) goto out;
+  record(samples, "malloc", "new_StrictArray", now_ns() - start);
+
+  start = now_ns();
+  for (size_t i = 0; i < count; i++) {
+    value[0] = (char)i;
+    memcpy(raw + i * type_size, value, type_size);
+  }
+  record(samples, "store", "push_back_StrictArray", now_ns() - start);
+
+  start = now_ns();
+  size_t total = 0;
+  for (size_t i = 0; i < count; i++) {
+    total += *(unsigned char*)(raw + i * type_size);
+  }
+  sink = total;
+  record(samples, "load", "get_item", now_ns() - start);
+
+  start = now_ns();
+  clone = (char*)malloc(type_size * count);
+  if (!clone) goto out;
+  memcpy(clone, raw, type_size * count);
+  record(samples, "malloc_memcpy", "from_StrictArray", now_ns() - start);
+
+  start = now_ns();
+  free(clone);
+  clone = NULL;
+  record(samples, "free", "free_StrictArray", now_ns() - start);
+
+out:
+  free(clone);
+  free(raw);
+  free(value);
+  return samples->operations;
+}
+
+int main(int argc, char **argv) {
+  size_t max_count = 1000000, repetitions = 0;
+  if (argc > 1) max_count = (size_t)strtoull(argv[1], NULL, 10);
+  if (argc > 2) repetitions = (size_t)strtoull(argv[2], NULL, 10);
+  if (max_count > 100000000) max_count = 100000000;
+  if (repetitions > BENCH_MAX_REPETITIONS) repetitions = BENCH_MAX_REPETITIONS;
+
+  static const size_t type_sizes[] = {1, 4, 8, 64};
+  printf("family,type_size,count,operation,counterpart,repetitions,min_ns,median_ns,min_ns_per_element\n");
+  for (size_t count = 100; count <= max_count; count *= 10) {
+    size_t runs = repetitions;
+    if (!runs) {
+      runs = 10000000 / count;
+      if (runs < 5) runs = 5;
+      if (runs > BENCH_MAX_REPETITIONS) runs = BENCH_MAX_REPETITIONS;
+    }
+    for (size_t t = 0; t < sizeof(type_sizes) / sizeof(type_sizes[0]); t++) {
+      run("generic", type_sizes[t], count, runs, bench_generic);
+      run("raw", type_sizes[t], count, runs, bench_raw);
+    }
+    run("int", sizeof(int), count, runs, bench_int);
+  }
+  return 0;
+}
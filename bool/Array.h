@@ -0,0 +1,384 @@
+/**
+ * @file bool/Array.h
+ * @author andarling
+ * @date 14/10/2026
+ * @brief a library for Array of packed bits
+ *
+ * @details This library introduces a structure \c `Array_bool`, the same as
+ * \c `Array_int` but holding \i `capacity` bits packed in 64-bit words, so a
+ * flag costs one bit instead of an integer. The bits are laid out as in
+ * bool/kernels.h and the bits after \i `capacity` in the last word are always
+ * clear. A bit is set by any non-zero value.
+ * Whole arrays are counted, searched and combined a word at a time.
+ *
+ * API:
+ * @li new_T ~ create
+ * @li new_T_with_allocator ~ create with an \c `Allocator`
+ * @li init_T ~ create in a caller-provided buffer
+ * @li T_bytes_required ~ size of the buffer for \c `init_T`
+ * @li from_T ~ copy
+ * @li free_T ~ free()
+ * @li test_T, set_T, flip_T ~ a[i], a[i] = v, a[i] = !a[i]
+ * @li fill_T ~ set every bit to a value
+ * @li popcount_T ~ number of set bits
+ * @li find_first_set_T, find_next_set_T ~ index of a set bit
+ * @li and_T, or_T, xor_T ~ a &= b, a |= b, a ^= b
+ */
+#ifndef __C_DSA_BOOL_ARRAY__
+#define __C_DSA_BOOL_ARRAY__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/Result.h"
+#include "../utils/status.h"
+#include "../utils/Allocator.h"
+#include "../utils/checked.h"
+#include "kernels.h"
+
+typedef struct Array_bool Array_bool;
+
+/**
+ * @struct Array_bool
+ * @author andarling
+ * @date 14/10/2026
+ * @brief \i `capacity` bits packed in \i `words`
+ *
+ * The \i `allocator` which allocated the array is kept to deallocate it, it is
+ * a null pointer if the array lives in a caller-provided buffer.
+ */
+struct Array_bool {
+  size_t capacity;
+  const Allocator *allocator;
+  uint64_t words[];
+};
+
+/**
+ * @fn Result new_Array_bool_with_allocator(const uint64_t *words, size_t size, size_t capacity, const Allocator *allocator)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `new_Array_bool` but the array is allocated, and later
+ * deallocated by \c `free_Array_bool`, through \i `allocator`
+ *
+ * @param allocator the allocator to use, it must outlive the array
+ * (\i `allocator` cannot be NULL)
+ *
+ * @return a \i `Result` variable indicating an error or if no error, the
+ * allocated data
+ */
+C_DSA_API Result new_Array_bool_with_allocator(const uint64_t *words, size_t size, size_t capacity,
+                                               const Allocator *allocator) {
+  if (!words) {
+    size = 0;
+  }
+  if (!allocator) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  if (capacity < size) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: size is negative or capacity is less than size\n"
+    };
+  }
+  size_t n = words_for_bits(capacity), bytes;
+  if (capacity > C_DSA_MAX_BITS || checked_bytes(sizeof(Array_bool), n, sizeof(uint64_t), &bytes)) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Capacity is too big\n"
+    };
+  }
+  Array_bool *result = (Array_bool*)allocator->alloc(allocator->ctx, bytes);
+  if (!result) {
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+  result->capacity = capacity;
+  result->allocator = allocator;
+  memset(result->words, 0, sizeof(uint64_t) * n);
+  if (size) copy_bits(result->words, words, size);
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn Result new_Array_bool(const uint64_t *words, size_t size, size_t capacity)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a \i `Result` variable containing an array of \i `capacity` bits
+ *
+ * The first \i `size` bits are copied from the packed \i `words`, the other
+ * ones are clear.
+ *
+ * @param words the packed bits to copy
+ * (if null pointer then every bit is clear)
+ * @param size the number of bits to copy
+ * @param capacity the number of bits of the array
+ * (size <= capacity <= \c `C_DSA_MAX_BITS`)
+ *
+ * @return a \i `Result` variable indicating an error or if no error, the
+ * allocated data
+ */
+C_DSA_API Result new_Array_bool(const uint64_t *words, size_t size, size_t capacity) {
+  return new_Array_bool_with_allocator(words, size, capacity, &heap_allocator);
+}
+
+/**
+ * @fn size_t Array_bool_bytes_required(size_t capacity)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the size in bytes of an \c `Array_bool` of \i `capacity` bits, or 0 if it
+ * does not fit in a \c `size_t` (\i `capacity` > \c `C_DSA_MAX_BITS`)
+ */
+C_DSA_API size_t Array_bool_bytes_required(size_t capacity) {
+  size_t bytes;
+  if (capacity > C_DSA_MAX_BITS) return 0;
+  return checked_bytes(sizeof(Array_bool), words_for_bits(capacity), sizeof(uint64_t), &bytes) == NO_ERROR ? bytes : 0;
+}
+
+/**
+ * @fn Result init_Array_bool(void *buffer, size_t buffer_bytes)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief lay out an \c `Array_bool` of clear bits in a caller-provided buffer
+ *
+ * The capacity is the number of whole words fitting in the buffer after the
+ * header, times 64. \c `free_Array_bool` does not deallocate such an array.
+ *
+ * @param buffer the storage of the array
+ * (aligned to \c `_Alignof(Array_bool)`)
+ * @param buffer_bytes the size of \i `buffer`
+ * (buffer_bytes >= \c `Array_bool_bytes_required(0)`)
+ */
+C_DSA_API Result init_Array_bool(void *buffer, size_t buffer_bytes) {
+  if (!buffer) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  if ((size_t)buffer % _Alignof(Array_bool)) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Buffer is not aligned for the array header\n"
+    };
+  }
+  if (buffer_bytes < sizeof(Array_bool)) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Buffer is smaller than the array header\n"
+    };
+  }
+  Array_bool *result = (Array_bool*)buffer;
+  size_t n = (buffer_bytes - sizeof(Array_bool)) / sizeof(uint64_t);
+  // the capacity in bits of a huge buffer is clamped so that it fits in a size_t
+  if (n > C_DSA_MAX_BITS / C_DSA_WORD_BITS) n = C_DSA_MAX_BITS / C_DSA_WORD_BITS;
+  result->capacity = n * C_DSA_WORD_BITS;
+  result->allocator = NULL;
+  memset(result->words, 0, sizeof(uint64_t) * n);
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn Result from_Array_bool(Array_bool *from)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a clone to the data
+ *
+ * The clone is allocated with the same allocator as \i `from`, or on the heap
+ * if \i `from` lives in a caller-provided buffer.
+ */
+C_DSA_API Result from_Array_bool(Array_bool *from) {
+  if (!from) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  return new_Array_bool_with_allocator(from->words, from->capacity, from->capacity,
+                                       from->allocator ? from->allocator : &heap_allocator);
+}
+
+/**
+ * @fn void free_Array_bool(Array_bool **to_delete)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief deallocate data and set pointer to NULL
+ *
+ * An array created by \c `init_Array_bool` is not deallocated.
+ */
+C_DSA_API void free_Array_bool(Array_bool **to_delete) {
+  if (!to_delete || !(*to_delete)) return;
+  const Allocator *allocator = (*to_delete)->allocator;
+  if (allocator) allocator->free(allocator->ctx, *to_delete, Array_bool_bytes_required((*to_delete)->capacity));
+  *to_delete = NULL;
+}
+
+/**
+ * @fn static inline int test_unchecked_Array_bool(const Array_bool *arr, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the bit on \i `index` without any check (index in [0, \i `capacity` - 1])
+ */
+static inline int test_unchecked_Array_bool(const Array_bool *arr, size_t index) {
+  return (int)(arr->words[index / C_DSA_WORD_BITS] >> (index % C_DSA_WORD_BITS) & 1);
+}
+
+/**
+ * @fn int test_Array_bool(const Array_bool *arr, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the bit on \i `index`
+ *
+ * @return 1 if the bit is set, 0 if it is clear and -1 if \i `arr` is a null
+ * pointer or \i `index` is out of [0, \i `capacity` - 1]
+ */
+C_DSA_API int test_Array_bool(const Array_bool *arr, size_t index) {
+  if (!arr || index >= arr->capacity) return -1;
+  return test_unchecked_Array_bool(arr, index);
+}
+
+/**
+ * @fn status_t set_Array_bool(Array_bool *arr, size_t index, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief set the bit on \i `index` if \i `value` is non-zero, else clear it
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t set_Array_bool(Array_bool *arr, size_t index, int value) {
+  if (!arr) return SEGFAULT;
+  if (index >= arr->capacity) return INVALID_INDEX;
+  uint64_t bit = (uint64_t)1 << (index % C_DSA_WORD_BITS);
+  uint64_t *word = arr->words + index / C_DSA_WORD_BITS;
+  *word = value ? *word | bit : *word & ~bit;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t flip_Array_bool(Array_bool *arr, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief invert the bit on \i `index`
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t flip_Array_bool(Array_bool *arr, size_t index) {
+  if (!arr) return SEGFAULT;
+  if (index >= arr->capacity) return INVALID_INDEX;
+  arr->words[index / C_DSA_WORD_BITS] ^= (uint64_t)1 << (index % C_DSA_WORD_BITS);
+  return NO_ERROR;
+}
+
+/**
+ * @fn void fill_Array_bool(Array_bool *arr, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief set every bit if \i `value` is non-zero, else clear every bit
+ */
+C_DSA_API void fill_Array_bool(Array_bool *arr, int value) {
+  if (!arr) return;
+  size_t n = words_for_bits(arr->capacity);
+  if (!n) return;
+  fill_words(arr->words, n, value ? ~(uint64_t)0 : 0);
+  arr->words[n - 1] &= tail_mask_bits(arr->capacity);
+}
+
+/**
+ * @fn size_t popcount_Array_bool(const Array_bool *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the number of set bits
+ */
+C_DSA_API size_t popcount_Array_bool(const Array_bool *arr) {
+  if (!arr) return 0;
+  return popcount_words(arr->words, words_for_bits(arr->capacity));
+}
+
+/**
+ * @fn size_t find_next_set_Array_bool(const Array_bool *arr, size_t from)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the index of the first set bit in [from, \i `capacity` - 1]
+ *
+ * The set bits are iterated by
+ * \c `for (i = find_first_set_Array_bool(a); i < a->capacity; i = find_next_set_Array_bool(a, i + 1))`.
+ *
+ * @return the index, or \i `capacity` if there is none (0 for a null pointer)
+ */
+C_DSA_API size_t find_next_set_Array_bool(const Array_bool *arr, size_t from) {
+  if (!arr) return 0;
+  return find_next_set_words(arr->words, arr->capacity, from);
+}
+
+/**
+ * @fn size_t find_first_set_Array_bool(const Array_bool *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the index of the first set bit, or \i `capacity` if there is none
+ */
+C_DSA_API size_t find_first_set_Array_bool(const Array_bool *arr) {
+  return find_next_set_Array_bool(arr, 0);
+}
+
+/**
+ * @fn status_t and_Array_bool(Array_bool *dst, const Array_bool *src)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief clear the bits of \i `dst` which are clear in \i `src`
+ *
+ * @param[in,out] dst the array to modify
+ * @param[in] src the mask, which can be \i `dst`
+ * (src has the same capacity as dst, else \c `INVALID_SIZE` is returned)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t and_Array_bool(Array_bool *dst, const Array_bool *src) {
+  if (!dst || !src) return SEGFAULT;
+  if (dst->capacity != src->capacity) return INVALID_SIZE;
+  and_words(dst->words, src->words, words_for_bits(dst->capacity));
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t or_Array_bool(Array_bool *dst, const Array_bool *src)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief set the bits of \i `dst` which are set in \i `src`
+ *
+ * The same as \c `and_Array_bool` for the parameters.
+ */
+C_DSA_API status_t or_Array_bool(Array_bool *dst, const Array_bool *src) {
+  if (!dst || !src) return SEGFAULT;
+  if (dst->capacity != src->capacity) return INVALID_SIZE;
+  or_words(dst->words, src->words, words_for_bits(dst->capacity));
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t xor_Array_bool(Array_bool *dst, const Array_bool *src)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief invert the bits of \i `dst` which are set in \i `src`
+ *
+ * The same as \c `and_Array_bool` for the parameters.
+ */
+C_DSA_API status_t xor_Array_bool(Array_bool *dst, const Array_bool *src) {
+  if (!dst || !src) return SEGFAULT;
+  if (dst->capacity != src->capacity) return INVALID_SIZE;
+  xor_words(dst->words, src->words, words_for_bits(dst->capacity));
+  return NO_ERROR;
+}
+
+#endif // __C_DSA_BOOL_ARRAY__
@@ -0,0 +1,477 @@
+/**
+ * @file bool/StrictArray.h
+ * @brief a strict array of packed bits header
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details This library introduces a structure \c `StrictArray_bool` that
+ * behaves the same as \c `StrictArray_int` but holds bits packed in 64-bit
+ * words, laid out as in bool/kernels.h: bits are only appended and removed at
+ * the back, read and changed on [0, \i `size` - 1], and once \i `size`
+ * reaches \i `capacity` no bit can be appended.
+ * The bits after \i `size` are always clear, so whole arrays are counted,
+ * searched and combined a word at a time. A bit is set by any non-zero value.
+ *
+ * StrictArray_bool's APIs:
+ * @li new_T : dynamically create type T on the heap
+ * @li new_T_with_allocator : dynamically create type T with an \c `Allocator`
+ * @li init_T : create type T in a caller-provided buffer
+ * @li T_bytes_required : the size of the buffer \c `init_T` needs
+ * @li from_T : dynamically clone type T on the heap of the same type
+ * @li free_T : deallocate type T
+ * @li push_back_T : insert a bit to type T on last position
+ * @li append_range_T : insert many packed bits to type T on last positions
+ * @li pop_back_T : remove last bit in type T
+ * @li pop_back_n_T : remove many last bits in type T
+ * @li clear_T : reset the data in T
+ * @li test_T, set_T, flip_T : read, write and invert the bit on \i `index`
+ * @li fill_T : set every bit of T to a value
+ * @li popcount_T : the number of set bits in T
+ * @li find_first_set_T, find_next_set_T : the index of a set bit in T
+ * @li and_T, or_T, xor_T : combine two T of the same size
+ */
+#ifndef __C_DSA_BOOL_STRICT_ARRAY_H__
+#define __C_DSA_BOOL_STRICT_ARRAY_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+#include "../utils/checked.h"
+#include "kernels.h"
+
+typedef struct StrictArray_bool StrictArray_bool;
+
+/**
+ * @struct StrictArray_bool
+ * @author andarling
+ * @date 14/10/2026
+ * @brief \i `size` bits out of \i `capacity` packed in \i `words`
+ *
+ * The \i `allocator` which allocated the array is kept to deallocate it, it is
+ * a null pointer if the array lives in a caller-provided buffer.
+ */
+struct StrictArray_bool {
+  size_t size, capacity;
+  const Allocator *allocator;
+  uint64_t words[];
+};
+
+/**
+ * @fn Result new_StrictArray_bool_with_allocator(const uint64_t *words, size_t size, size_t cap, const Allocator *allocator)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to the allocation made by \i `allocator`
+ *
+ * The same as \c `new_StrictArray_bool`, but the array is allocated, and later
+ * deallocated by \c `free_StrictArray_bool`, through \i `allocator`.
+ *
+ * @param[in] allocator the allocator to use, it must outlive the array
+ * (allocator is not a null pointer)
+ *
+ * @return a \c `Result` type to the successfully allocated data or a error message
+ */
+C_DSA_API Result new_StrictArray_bool_with_allocator(const uint64_t *words, size_t size, size_t cap,
+                                                     const Allocator *allocator) {
+  if (!words) {
+    size = 0;
+  }
+  if (!allocator) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  if (cap < size) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Size is negative or capacity is less than size\n"
+    };
+  }
+
+  size_t n = words_for_bits(cap), bytes;
+  if (cap > C_DSA_MAX_BITS || checked_bytes(sizeof(StrictArray_bool), n, sizeof(uint64_t), &bytes)) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Capacity is too big\n"
+    };
+  }
+  StrictArray_bool *result = (StrictArray_bool*)allocator->alloc(allocator->ctx, bytes);
+  if (!result) {
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+  result->size = size, result->capacity = cap;
+  result->allocator = allocator;
+  memset(result->words, 0, sizeof(uint64_t) * n);
+  if (size) copy_bits(result->words, words, size);
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn Result new_StrictArray_bool(const uint64_t *words, size_t size, size_t cap)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to the allocation
+ *
+ * @param[in] words the packed bits to copy
+ * (if null pointer then defaults to 0 bits in array)
+ * @param[in] size the number of bits to copy
+ * @param[in] cap the desired capacity in bits of the returned \c `StrictArray_bool`
+ * (size <= cap <= \c `C_DSA_MAX_BITS`)
+ *
+ * @return a \c `Result` type to the successfully allocated data or a error message
+ */
+C_DSA_API Result new_StrictArray_bool(const uint64_t *words, size_t size, size_t cap) {
+  return new_StrictArray_bool_with_allocator(words, size, cap, &heap_allocator);
+}
+
+/**
+ * @fn size_t StrictArray_bool_bytes_required(size_t cap)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the size in bytes of a \c `StrictArray_bool` of \i `cap` bits, or 0 if it
+ * does not fit in a \c `size_t` (\i `cap` > \c `C_DSA_MAX_BITS`)
+ */
+C_DSA_API size_t StrictArray_bool_bytes_required(size_t cap) {
+  size_t bytes;
+  if (cap > C_DSA_MAX_BITS) return 0;
+  return checked_bytes(sizeof(StrictArray_bool), words_for_bits(cap), sizeof(uint64_t), &bytes) == NO_ERROR ? bytes : 0;
+}
+
+/**
+ * @fn Result init_StrictArray_bool(void *buffer, size_t buffer_bytes)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief lay out an empty \c `StrictArray_bool` in a caller-provided buffer
+ *
+ * The capacity is the number of whole words fitting in the buffer after the
+ * header, times 64. \c `free_StrictArray_bool` does not deallocate such an
+ * array and \c `from_StrictArray_bool` clones it on the heap.
+ *
+ * @param[in] buffer the storage of the array
+ * (aligned to \c `_Alignof(StrictArray_bool)`)
+ * @param[in] buffer_bytes the size of \i `buffer`
+ * (buffer_bytes >= \c `StrictArray_bool_bytes_required(0)`)
+ *
+ * @return a \c `Result` type to the array (at the address of \i `buffer`) or a
+ * error message
+ */
+C_DSA_API Result init_StrictArray_bool(void *buffer, size_t buffer_bytes) {
+  if (!buffer) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  if ((size_t)buffer % _Alignof(StrictArray_bool)) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Buffer is not aligned for the array header\n"
+    };
+  }
+  if (buffer_bytes < sizeof(StrictArray_bool)) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Buffer is smaller than the array header\n"
+    };
+  }
+
+  StrictArray_bool *result = (StrictArray_bool*)buffer;
+  size_t n = (buffer_bytes - sizeof(StrictArray_bool)) / sizeof(uint64_t);
+  // the capacity in bits of a huge buffer is clamped so that it fits in a size_t
+  if (n > C_DSA_MAX_BITS / C_DSA_WORD_BITS) n = C_DSA_MAX_BITS / C_DSA_WORD_BITS;
+  result->size = 0, result->capacity = n * C_DSA_WORD_BITS;
+  result->allocator = NULL;
+  memset(result->words, 0, sizeof(uint64_t) * n);
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn Result from_StrictArray_bool(StrictArray_bool *from)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief creates a copy of an existed \c `StrictArray_bool`
+ *
+ * The copy is allocated with the same allocator as \i `from`, or on the heap
+ * if \i `from` lives in a caller-provided buffer.
+ */
+C_DSA_API Result from_StrictArray_bool(StrictArray_bool *from) {
+  if (!from) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+
+  return new_StrictArray_bool_with_allocator(from->words, from->size, from->capacity,
+                                             from->allocator ? from->allocator : &heap_allocator);
+}
+
+/**
+ * @fn void free_StrictArray_bool(StrictArray_bool **arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief deallocate the data and set the pointer to NULL
+ *
+ * An array created by \c `init_StrictArray_bool` is not deallocated.
+ */
+C_DSA_API void free_StrictArray_bool(StrictArray_bool **arr) {
+  if (!arr || !*arr) return;
+  const Allocator *allocator = (*arr)->allocator;
+  if (allocator) allocator->free(allocator->ctx, *arr, StrictArray_bool_bytes_required((*arr)->capacity));
+  *arr = NULL;
+}
+
+/**
+ * @fn status_t push_back_StrictArray_bool(StrictArray_bool *arr, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert a bit, set if \i `value` is non-zero, to the end of the array
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t push_back_StrictArray_bool(StrictArray_bool *arr, int value) {
+  if (!arr) return SEGFAULT;
+  size_t size = arr->size;
+  if (size == arr->capacity) {
+    return NO_SPACE;
+  }
+  // the bit after size is clear
+  arr->words[size / C_DSA_WORD_BITS] |= (uint64_t)(value != 0) << (size % C_DSA_WORD_BITS);
+  arr->size = size + 1;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t append_range_StrictArray_bool(StrictArray_bool *arr, const uint64_t *src, size_t count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert \i `count` packed bits of \i `src` to the end of the array
+ *
+ * The bits are shifted in place a word at a time.
+ *
+ * @param[in] arr a pointer to \c `StrictArray_bool` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] src the packed bits
+ * (src is not a null pointer if count > 0)
+ * @param[in] count the number of bits to insert
+ * (count <= \i `capacity` - \i `size`, else \c `NO_SPACE` is returned)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t append_range_StrictArray_bool(StrictArray_bool *arr, const uint64_t *src, size_t count) {
+  if (!arr || (!src && count)) return SEGFAULT;
+  if (count > arr->capacity - arr->size) {
+    return NO_SPACE;
+  }
+  if (count) or_shifted_bits(arr->words, arr->size, src, count);
+  arr->size += count;
+  return NO_ERROR;
+}
+
+/**
+ * @fn void pop_back_StrictArray_bool(StrictArray_bool *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove the last bit
+ */
+C_DSA_API void pop_back_StrictArray_bool(StrictArray_bool *arr) {
+  if (!arr || !arr->size) return;
+  arr->size--;
+  arr->words[arr->size / C_DSA_WORD_BITS] &= ~((uint64_t)1 << (arr->size % C_DSA_WORD_BITS));
+}
+
+/**
+ * @fn void pop_back_n_StrictArray_bool(StrictArray_bool *arr, size_t count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove the last \i `count` bits, or every bit if there are fewer
+ */
+C_DSA_API void pop_back_n_StrictArray_bool(StrictArray_bool *arr, size_t count) {
+  if (!arr) return;
+  size_t size = count < arr->size ? arr->size - count : 0;
+  clear_bits(arr->words, size, arr->size);
+  arr->size = size;
+}
+
+/**
+ * @fn void clear_StrictArray_bool(StrictArray_bool *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove every bit
+ */
+C_DSA_API void clear_StrictArray_bool(StrictArray_bool *arr) {
+  if (!arr) return;
+  memset(arr->words, 0, sizeof(uint64_t) * words_for_bits(arr->size));
+  arr->size = 0;
+}
+
+/**
+ * @fn static inline int test_unchecked_StrictArray_bool(const StrictArray_bool *arr, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the bit on \i `index` without any check (index in [0, \i `size` - 1])
+ */
+static inline int test_unchecked_StrictArray_bool(const StrictArray_bool *arr, size_t index) {
+  return (int)(arr->words[index / C_DSA_WORD_BITS] >> (index % C_DSA_WORD_BITS) & 1);
+}
+
+/**
+ * @fn int test_StrictArray_bool(const StrictArray_bool *arr, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the bit on \i `index`
+ *
+ * @return 1 if the bit is set, 0 if it is clear and -1 if \i `arr` is a null
+ * pointer or \i `index` is out of [0, \i `size` - 1]
+ */
+C_DSA_API int test_StrictArray_bool(const StrictArray_bool *arr, size_t index) {
+  if (!arr || index >= arr->size) return -1;
+  return test_unchecked_StrictArray_bool(arr, index);
+}
+
+/**
+ * @fn status_t set_StrictArray_bool(StrictArray_bool *arr, size_t index, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief set the bit on \i `index` if \i `value` is non-zero, else clear it
+ *
+ * @return 0 if success and non-zero if an error occurs (\c `INVALID_INDEX` if
+ * \i `index` is out of [0, \i `size` - 1])
+ */
+C_DSA_API status_t set_StrictArray_bool(StrictArray_bool *arr, size_t index, int value) {
+  if (!arr) return SEGFAULT;
+  if (index >= arr->size) return INVALID_INDEX;
+  uint64_t bit = (uint64_t)1 << (index % C_DSA_WORD_BITS);
+  uint64_t *word = arr->words + index / C_DSA_WORD_BITS;
+  *word = value ? *word | bit : *word & ~bit;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t flip_StrictArray_bool(StrictArray_bool *arr, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief invert the bit on \i `index`
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t flip_StrictArray_bool(StrictArray_bool *arr, size_t index) {
+  if (!arr) return SEGFAULT;
+  if (index >= arr->size) return INVALID_INDEX;
+  arr->words[index / C_DSA_WORD_BITS] ^= (uint64_t)1 << (index % C_DSA_WORD_BITS);
+  return NO_ERROR;
+}
+
+/**
+ * @fn void fill_StrictArray_bool(StrictArray_bool *arr, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief set every bit in [0, \i `size` - 1] if \i `value` is non-zero, else
+ * clear them
+ */
+C_DSA_API void fill_StrictArray_bool(StrictArray_bool *arr, int value) {
+  if (!arr) return;
+  size_t n = words_for_bits(arr->size);
+  if (!n) return;
+  fill_words(arr->words, n, value ? ~(uint64_t)0 : 0);
+  arr->words[n - 1] &= tail_mask_bits(arr->size);
+}
+
+/**
+ * @fn size_t popcount_StrictArray_bool(const StrictArray_bool *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the number of set bits
+ */
+C_DSA_API size_t popcount_StrictArray_bool(const StrictArray_bool *arr) {
+  if (!arr) return 0;
+  return popcount_words(arr->words, words_for_bits(arr->size));
+}
+
+/**
+ * @fn size_t find_next_set_StrictArray_bool(const StrictArray_bool *arr, size_t from)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the index of the first set bit in [from, \i `size` - 1]
+ *
+ * @return the index, or \i `size` if there is none (0 for a null pointer)
+ */
+C_DSA_API size_t find_next_set_StrictArray_bool(const StrictArray_bool *arr, size_t from) {
+  if (!arr) return 0;
+  return find_next_set_words(arr->words, arr->size, from);
+}
+
+/**
+ * @fn size_t find_first_set_StrictArray_bool(const StrictArray_bool *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the index of the first set bit, or \i `size` if there is none
+ */
+C_DSA_API size_t find_first_set_StrictArray_bool(const StrictArray_bool *arr) {
+  return find_next_set_StrictArray_bool(arr, 0);
+}
+
+/**
+ * @fn status_t and_StrictArray_bool(StrictArray_bool *dst, const StrictArray_bool *src)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief clear the bits of \i `dst` which are clear in \i `src`
+ *
+ * @param[in,out] dst the array to modify
+ * @param[in] src the mask, which can be \i `dst`
+ * (src has the same size as dst, else \c `INVALID_SIZE` is returned)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t and_StrictArray_bool(StrictArray_bool *dst, const StrictArray_bool *src) {
+  if (!dst || !src) return SEGFAULT;
+  if (dst->size != src->size) return INVALID_SIZE;
+  and_words(dst->words, src->words, words_for_bits(dst->size));
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t or_StrictArray_bool(StrictArray_bool *dst, const StrictArray_bool *src)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief set the bits of \i `dst` which are set in \i `src`
+ *
+ * The same as \c `and_StrictArray_bool` for the parameters.
+ */
+C_DSA_API status_t or_StrictArray_bool(StrictArray_bool *dst, const StrictArray_bool *src) {
+  if (!dst || !src) return SEGFAULT;
+  if (dst->size != src->size) return INVALID_SIZE;
+  or_words(dst->words, src->words, words_for_bits(dst->size));
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t xor_StrictArray_bool(StrictArray_bool *dst, const StrictArray_bool *src)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief invert the bits of \i `dst` which are set in \i `src`
+ *
+ * The same as \c `and_StrictArray_bool` for the parameters.
+ */
+C_DSA_API status_t xor_StrictArray_bool(StrictArray_bool *dst, const StrictArray_bool *src) {
+  if (!dst || !src) return SEGFAULT;
+  if (dst->size != src->size) return INVALID_SIZE;
+  xor_words(dst->words, src->words, words_for_bits(dst->size));
+  return NO_ERROR;
+}
+
+#endif // __C_DSA_BOOL_STRICT_ARRAY_H__
@@ -0,0 +1,186 @@
+/**
+ * @file bool/kernels.h
+ * @brief word-at-a-time kernels for packed bits
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details The bits are packed in 64-bit words, bit \i `i` being the bit
+ * \i `i` % 64 (from the least significant one) of the word \i `i` / 64.
+ * The kernels work on whole words, so a word is counted, searched or combined
+ * in a few instructions, and the combining loops have no dependency between
+ * iterations so the compiler vectorizes them (e.g. with \c `-O3`).
+ * Popcount and bit scans use the compiler builtins when available, with a
+ * portable fallback.
+ *
+ * Kernels' APIs:
+ * @li words_for_bits : number of words holding a number of bits
+ * @li popcount_words : number of set bits
+ * @li find_next_set_words : index of the first set bit starting from a bit
+ * @li copy_bits : copy bits, clearing the rest of the last word
+ * @li or_shifted_bits : or bits to any bit offset of a cleared destination
+ * @li clear_bits : clear a range of bits
+ * @li fill_words, and_words, or_words, xor_words : whole word operations
+ */
+#ifndef __C_DSA_BOOL_KERNELS_H__
+#define __C_DSA_BOOL_KERNELS_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../utils/config.h"
+
+#define C_DSA_WORD_BITS 64
+
+/**
+ * @brief the largest number of bits of an array, so that the bits of its last
+ * word can still be counted in a \c `size_t`
+ */
+#define C_DSA_MAX_BITS (SIZE_MAX - (C_DSA_WORD_BITS - 1))
+
+/**
+ * @brief the number of words holding \i `bits` bits
+ */
+C_DSA_API size_t words_for_bits(size_t bits) {
+  return bits / C_DSA_WORD_BITS + (bits % C_DSA_WORD_BITS != 0);
+}
+
+/**
+ * @brief the mask of the bits of the last word of \i `bits` bits
+ */
+C_DSA_API uint64_t tail_mask_bits(size_t bits) {
+  size_t rest = bits % C_DSA_WORD_BITS;
+  return rest ? ((uint64_t)1 << rest) - 1 : ~(uint64_t)0;
+}
+
+C_DSA_API unsigned popcount_word(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return (unsigned)__builtin_popcountll(word);
+#else
+  word -= (word >> 1) & 0x5555555555555555u;
+  word = (word & 0x3333333333333333u) + ((word >> 2) & 0x3333333333333333u);
+  word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fu;
+  return (unsigned)((word * 0x0101010101010101u) >> 56);
+#endif
+}
+
+// word is not 0
+C_DSA_API unsigned ctz_word(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return (unsigned)__builtin_ctzll(word);
+#else
+  unsigned count = 0;
+  while (!(word & 1)) word >>= 1, count++;
+  return count;
+#endif
+}
+
+/**
+ * @fn size_t popcount_words(const uint64_t *words, size_t n)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the number of set bits in \i `n` words
+ */
+C_DSA_API size_t popcount_words(const uint64_t *words, size_t n) {
+  // independent accumulators so the popcounts overlap
+  size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0, i = 0;
+  for (; i + 4 <= n; i += 4) {
+    c0 += popcount_word(words[i]);
+    c1 += popcount_word(words[i + 1]);
+    c2 += popcount_word(words[i + 2]);
+    c3 += popcount_word(words[i + 3]);
+  }
+  for (; i < n; i++) {
+    c0 += popcount_word(words[i]);
+  }
+  return c0 + c1 + c2 + c3;
+}
+
+/**
+ * @fn size_t find_next_set_words(const uint64_t *words, size_t bits, size_t from)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the index of the first set bit in [from, bits - 1]
+ *
+ * @return the index of the bit, \i `bits` if there is none
+ */
+C_DSA_API size_t find_next_set_words(const uint64_t *words, size_t bits, size_t from) {
+  if (from >= bits) return bits;
+  size_t n = words_for_bits(bits), i = from / C_DSA_WORD_BITS;
+  uint64_t word = words[i] & (~(uint64_t)0 << (from % C_DSA_WORD_BITS));
+  while (!word) {
+    if (++i == n) return bits;
+    word = words[i];
+  }
+  size_t index = i * C_DSA_WORD_BITS + ctz_word(word);
+  return index < bits ? index : bits;
+}
+
+/**
+ * @brief copy \i `bits` bits of \i `src` to \i `dst`, the rest of the last word
+ * of \i `dst` is cleared
+ */
+C_DSA_API void copy_bits(uint64_t *dst, const uint64_t *src, size_t bits) {
+  size_t n = words_for_bits(bits);
+  if (!n) return;
+  memcpy(dst, src, sizeof(uint64_t) * n);
+  dst[n - 1] &= tail_mask_bits(bits);
+}
+
+/**
+ * @brief or \i `count` bits of \i `src` to the bits [offset, offset + count - 1]
+ * of \i `dst`, which are cleared, as are the bits after them in their last word
+ */
+C_DSA_API void or_shifted_bits(uint64_t *dst, size_t offset, const uint64_t *src, size_t count) {
+  size_t n = words_for_bits(count), shift = offset % C_DSA_WORD_BITS;
+  size_t last = (offset + count - 1) / C_DSA_WORD_BITS;
+  dst += offset / C_DSA_WORD_BITS;
+  last -= offset / C_DSA_WORD_BITS;
+  for (size_t i = 0; i < n; i++) {
+    uint64_t word = i + 1 == n ? src[i] & tail_mask_bits(count) : src[i];
+    dst[i] |= word << shift;
+    if (shift && i + 1 <= last) dst[i + 1] |= word >> (C_DSA_WORD_BITS - shift);
+  }
+}
+
+/**
+ * @brief clear the bits [from, to - 1] of \i `words`
+ */
+C_DSA_API void clear_bits(uint64_t *words, size_t from, size_t to) {
+  if (from >= to) return;
+  size_t first = from / C_DSA_WORD_BITS, last = (to - 1) / C_DSA_WORD_BITS;
+  uint64_t head = ~(uint64_t)0 << (from % C_DSA_WORD_BITS), tail = tail_mask_bits(to);
+  if (first == last) {
+    words[first] &= ~(head & tail);
+    return;
+  }
+  words[first] &= ~head;
+  if (last > first + 1) memset(words + first + 1, 0, sizeof(uint64_t) * (last - first - 1));
+  words[last] &= ~tail;
+}
+
+C_DSA_API void fill_words(uint64_t *words, size_t n, uint64_t word) {
+  for (size_t i = 0; i < n; i++) {
+    words[i] = word;
+  }
+}
+
+C_DSA_API void and_words(uint64_t *dst, const uint64_t *src, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    dst[i] &= src[i];
+  }
+}
+
+C_DSA_API void or_words(uint64_t *dst, const uint64_t *src, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    dst[i] |= src[i];
+  }
+}
+
+C_DSA_API void xor_words(uint64_t *dst, const uint64_t *src, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    dst[i] ^= src[i];
+  }
+}
+
+#endif // __C_DSA_BOOL_KERNELS_H__
@@ -0,0 +1,38 @@
+/**
+ * @file double/DynamicArray.h
+ * @brief a growable array of double precision floats header
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details This library introduces a structure \c `DynamicArray_double` that behaves
+ * the same as \c `StrictArray_double` but grows geometrically by \i `growth_factor`
+ * once \i `size` reach \i `capacity`, giving amortized O(1) append.
+ * Growing is done with \c `realloc` on the whole block, so every function that
+ * may grow the array takes a pointer to the \c `DynamicArray_double` pointer.
+ *
+ * The structure and APIs are generated by \c `DEFINE_DYNAMIC_ARRAY`, see
+ * generic/DynamicArray_template.h for the details of every function.
+ *
+ * DynamicArray_double's APIs:
+ * @li new_T : dynamically create type T on the heap
+ * @li new_T_with_allocator : dynamically create type T with an \c `Allocator`
+ * @li create_T, create_T_with_allocator : create type T through an out-parameter
+ * @li from_T : dynamically clone type T on the heap of the same type
+ * @li create_from_T : clone type T through an out-parameter
+ * @li free_T : deallocate type T
+ * @li push_back_T : insert data to type T on last position, growing if needed
+ * @li pop_back_T : remove last element in type T
+ * @li get_item_T : get the pointer to item on \i `index`
+ * @li clear_T : reset the data in T
+ * @li reserve_T : make sure T can hold at least \i `cap` elements
+ * @li shrink_to_fit_T : release the unused capacity of T
+ * @li set_growth_factor_T : change how fast T grows
+ */
+#ifndef __C_DSA_DOUBLE_DYNAMIC_ARRAY_H__
+#define __C_DSA_DOUBLE_DYNAMIC_ARRAY_H__
+
+#include "../generic/DynamicArray_template.h"
+
+DEFINE_DYNAMIC_ARRAY(double, double)
+
+#endif // __C_DSA_DOUBLE_DYNAMIC_ARRAY_H__
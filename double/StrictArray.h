@@ -0,0 +1,44 @@
+/**
+ * @file double/StrictArray.h
+ * @brief a structured array header
+ * @author andarling
+ * @date 14/10/2026
+ * 
+ * @details This library introduces a structure \c `StrictArray_double` that behaves the 
+ * same as normal array of double precision floats but is allocated explicitly on heap, and 
+ * also have the \i `size` and \i `capacity` attributes.
+ * \b `Stricter` means the only operation available is inserting and removing at the
+ * back, read and change data at any point. Once the \i `size` reach \i `capacity`
+ * then the array is no longer insertable.
+ * 
+ * The structure and APIs are generated by \c `DEFINE_STRICT_ARRAY`, see
+ * generic/StrictArray_template.h for the details of every function.
+ * 
+ * StrictArray_double's APIs:
+ * @li new_T : dynamically create type T on the heap
+ * @li new_T_with_allocator : dynamically create type T with an \c `Allocator`
+ * @li create_T, create_T_with_allocator : create type T through an out-parameter
+ * @li init_T : create type T in a caller-provided buffer
+ * @li T_bytes_required : the size of the buffer \c `init_T` needs
+ * @li new_T_aligned, create_T_aligned : create type T with its elements aligned
+ * @li alignment_T : the alignment of the elements of type T
+ * @li from_T : dynamically clone type T on the heap of the same type
+ * @li create_from_T : clone type T through an out-parameter
+ * @li clone_shrink_T : clone type T with a capacity of its size
+ * @li copy_into_T : copy type T into another one, reusing its storage
+ * @li free_T : deallocate type T
+ * @li push_back_T : insert data to type T on last position
+ * @li append_range_T : insert many data to type T on last positions
+ * @li pop_back_T : remove last element in type T
+ * @li pop_back_n_T : remove many last elements in type T
+ * @li get_item_T : get the pointer to item on \i `index`
+ * @li clear_T : reset the data in T
+ */
+#ifndef __C_DSA_DOUBLE_STRICT_ARRAY_H__
+#define __C_DSA_DOUBLE_STRICT_ARRAY_H__
+
+#include "../generic/StrictArray_template.h"
+
+DEFINE_STRICT_ARRAY(double, double)
+
+#endif // __C_DSA_DOUBLE_STRICT_ARRAY_H__
@@ -0,0 +1,30 @@
+/**
+ * @file float/ArrayView.h
+ * @brief a non-owning view over single precision floats
+ * @author andarling
+ * @date 14/10/2026
+ * 
+ * @details This library introduces a structure \c `ArrayView_float`, a view over
+ * some elements of a \c `StrictArray_float`, an \c `Array_float` or another view,
+ * made without allocation nor copy.
+ * 
+ * The structure and APIs are generated by \c `DEFINE_ARRAY_VIEW`, see
+ * generic/ArrayView_template.h for the details of every function.
+ * 
+ * ArrayView_float's APIs:
+ * @li view_T : a view over every element of type T
+ * @li slice_T : a view over the elements [begin, end - 1] of type T
+ * @li strided_T : a view over one element every \i `step` in [begin, end - 1] of type T
+ * @li subview_ArrayView_float : a view over the elements [begin, end - 1] of a view
+ * @li get_item_ArrayView_float : get the pointer to the item on \i `index` of a view
+ */
+#ifndef __C_DSA_FLOAT_ARRAY_VIEW_H__
+#define __C_DSA_FLOAT_ARRAY_VIEW_H__
+
+#include "../generic/ArrayView_template.h"
+#include "StrictArray.h"
+#include "Array.h"
+
+DEFINE_ARRAY_VIEW(float, float)
+
+#endif // __C_DSA_FLOAT_ARRAY_VIEW_H__
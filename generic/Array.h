@@ -10,8 +10,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "../utils/config.h"
 #include "../utils/Result.h"
 #include "../utils/status.h"
+#include "../utils/Allocator.h"
+#include "../utils/AlignedAllocator.h"
+#include "../utils/instrument.h"
+#include "../utils/checked.h"
 
 typedef struct Array Array;
 /**
@@ -19,12 +24,101 @@ typedef struct Array Array;
  * @author andarling
  * @date 20/09/2025
  * @brief a struct for normal generic array
+ * 
+ * The \i `allocator` which allocated the array is kept to deallocate it, it is
+ * a null pointer if the array lives in a caller-provided buffer.
  */
 struct Array {
   size_t capacity, type_size;
+  const Allocator *allocator;
   char data[];
 };
 
+/**
+ * @fn status_t create_Array_with_allocator(Array **out, void *data, size_t size, size_t capacity, size_t type_size, const Allocator *allocator)
+ * 
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `new_Array_with_allocator` but the array is returned
+ * through \i `out` and only a status code is returned, so no \c `Result` has
+ * to be copied nor unpacked
+ * 
+ * @param out where the address of the array is written, a null pointer on error
+ * (\i `out` cannot be NULL)
+ * @param allocator the allocator to use, it must outlive the array
+ * (\i `allocator` cannot be NULL)
+ * 
+ * @return \c `NO_ERROR`, \c `SEGFAULT` for a null \i `out` or \i `allocator`,
+ * \c `INVALID_SIZE` for invalid sizes or \c `HEAP_FAILURE`
+ */
+C_DSA_API status_t create_Array_with_allocator(Array **out, void *data, size_t size, size_t capacity,
+                                     size_t type_size, const Allocator *allocator) {
+  if (C_DSA_UNLIKELY(!out)) return SEGFAULT;
+  *out = NULL;
+  if (!data) {
+    size = 0;
+  }
+  if (C_DSA_UNLIKELY(!allocator)) return SEGFAULT;
+  if (C_DSA_UNLIKELY(capacity < size || type_size <= 0)) return INVALID_SIZE;
+  size_t bytes;
+  if (C_DSA_UNLIKELY(checked_bytes(sizeof(Array), capacity, type_size, &bytes))) return INVALID_SIZE;
+
+  Array *result = (Array*)allocator->alloc(allocator->ctx, bytes);
+  if (C_DSA_UNLIKELY(!result)) return HEAP_FAILURE;
+  result->capacity = capacity, result->type_size = type_size;
+  result->allocator = allocator;
+  if (size) memcpy(result->data, data, size * type_size);
+  C_DSA_COUNT_ALLOC(C_DSA_ARRAY, bytes);
+  *out = result;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t create_Array(Array **out, void *data, size_t size, size_t capacity, size_t type_size)
+ * 
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `create_Array_with_allocator` on the heap
+ */
+C_DSA_API status_t create_Array(Array **out, void *data, size_t size, size_t capacity, size_t type_size) {
+  return create_Array_with_allocator(out, data, size, capacity, type_size, &heap_allocator);
+}
+
+/**
+ * @fn Result new_Array_with_allocator(void *data, size_t size, size_t capacity, size_t type_size, const Allocator *allocator)
+ * 
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `new_Array` but the array is allocated, and later
+ * deallocated by \c `free_Array`, through \i `allocator`
+ * 
+ * @param allocator the allocator to use, it must outlive the array
+ * (\i `allocator` cannot be NULL)
+ * 
+ * @return a \i `Result` variable indicating an error or if no error, the 
+ * allocated data
+ */
+C_DSA_API Result new_Array_with_allocator(void *data, size_t size, size_t capacity, size_t type_size,
+                                const Allocator *allocator) {
+  Array *result;
+  status_t status = create_Array_with_allocator(&result, data, size, capacity, type_size, allocator);
+  if (C_DSA_LIKELY(status == NO_ERROR)) {
+    return (Result) {
+      .ok = NO_ERROR,
+      .data = result
+    };
+  }
+  const char *error_msg = status == SEGFAULT ? "ValueError: cannot access a null pointer\n"
+                        : status == HEAP_FAILURE ? "AllocationError: Not enough memory in the heap"
+                        : data && capacity < size ? "SizeError: size is negative or capacity is less than size\n"
+                        : type_size <= 0 ? "SizeError: Type cannot have less than 1 byte\n"
+                        : "SizeError: Capacity is too big\n";
+  return (Result) {
+    .ok = status,
+    .error_msg = error_msg
+  };
+}
+
 /**
  * @fn Result new_Array(int *data, size_t size, size_t capacity, size_t type_size)
  * 
@@ -45,39 +139,143 @@ struct Array {
  * @return a \i `Result` variable indicating an error or if no error, the 
  * allocated data
  */
-Result new_Array(void *data, size_t size, size_t capacity, size_t type_size) {
-  if (!data) {
-    size = 0;
+C_DSA_API Result new_Array(void *data, size_t size, size_t capacity, size_t type_size) {
+  return new_Array_with_allocator(data, size, capacity, type_size, &heap_allocator);
+}
+
+DEFINE_ALIGNED_ALLOCATORS(Array, sizeof(Array))
+
+/**
+ * @fn status_t create_Array_aligned(Array **out, void *data, size_t size, size_t capacity, size_t type_size, size_t alignment)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `create_Array`, with the elements aligned to \i `alignment`
+ * 
+ * The array is allocated through \c `Array_aligned_allocator(alignment)`, which
+ * pads the heap block so that \i `data` starts on an \i `alignment` boundary
+ * and the array can be read with aligned vector loads. Clones made through
+ * \c `from_Array` are aligned the same way.
+ * 
+ * @param alignment the alignment of the elements in bytes
+ * (a power of two in [\c `C_DSA_MIN_ALIGNMENT`, \c `C_DSA_MAX_ALIGNMENT`])
+ * 
+ * @return 0 if success, \c `INVALID_SIZE` for an invalid \i `alignment` and
+ * non-zero if another error occurs
+ */
+C_DSA_API status_t create_Array_aligned(Array **out, void *data, size_t size, size_t capacity,
+                                   size_t type_size, size_t alignment) {
+  const Allocator *allocator = Array_aligned_allocator(alignment);
+  if (C_DSA_UNLIKELY(!allocator)) {
+    if (out) *out = NULL;
+    return out ? INVALID_SIZE : SEGFAULT;
   }
-  if (capacity < size) {
+  return create_Array_with_allocator(out, data, size, capacity, type_size, allocator);
+}
+
+/**
+ * @fn Result new_Array_aligned(void *data, size_t size, size_t capacity, size_t type_size, size_t alignment)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `create_Array_aligned`, returning a \c `Result`
+ */
+C_DSA_API Result new_Array_aligned(void *data, size_t size, size_t capacity, size_t type_size,
+                                size_t alignment) {
+  const Allocator *allocator = Array_aligned_allocator(alignment);
+  if (!allocator) {
     return (Result) {
       .ok = INVALID_SIZE,
-      .error_msg = "SizeError: size is negative or capacity is less than size\n"
+      .error_msg = "SizeError: Alignment is not a power of two in the supported range\n"
     };
   }
-  if (type_size <= 0) {
+  return new_Array_with_allocator(data, size, capacity, type_size, allocator);
+}
+
+/**
+ * @fn size_t alignment_Array(const Array *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the alignment of the elements of \i `arr`: the greatest power of two,
+ * up to \c `C_DSA_MAX_ALIGNMENT`, dividing the address of \i `data`
+ * 
+ * It holds for any array, not only the ones made by \c `new_Array_aligned`.
+ * 
+ * @param arr the array
+ * (arr is not a null pointer)
+ */
+C_DSA_API size_t alignment_Array(const Array *arr) {
+  return alignment_of(arr->data);
+}
+
+/**
+ * @fn size_t Array_bytes_required(size_t capacity, size_t type_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the size in bytes of an \c `Array` of \i `capacity` elements
+ * 
+ * @param capacity the desired capacity
+ * @param type_size the size in bytes of each elements
+ * 
+ * @return the number of bytes a buffer given to \c `init_Array` needs, or 0 if
+ * it does not fit in a \c `size_t`
+ */
+C_DSA_API size_t Array_bytes_required(size_t capacity, size_t type_size) {
+  size_t bytes;
+  return checked_bytes(sizeof(Array), capacity, type_size, &bytes) == NO_ERROR ? bytes : 0;
+}
+
+/**
+ * @fn Result init_Array(void *buffer, size_t buffer_bytes, size_t type_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief lay out an \c `Array` in a caller-provided buffer
+ * 
+ * No allocation is made and the elements are not initialised, the capacity is
+ * the number of elements fitting in the buffer after the header.
+ * \c `free_Array` does not deallocate such an array.
+ * 
+ * @param buffer the storage of the array, it must outlive the array
+ * (aligned to \c `_Alignof(Array)`)
+ * @param buffer_bytes the size of \i `buffer`
+ * (\i `buffer_bytes` cannot be less than \c `Array_bytes_required(0, type_size)`)
+ * @param type_size the size in bytes of each elemenets
+ * (\i `type_size` cannot be less than 1)
+ * 
+ * @return a \i `Result` variable indicating an error or if no error, the array
+ * (at the address of \i `buffer`)
+ */
+C_DSA_API Result init_Array(void *buffer, size_t buffer_bytes, size_t type_size) {
+  if (!buffer) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  if ((size_t)buffer % _Alignof(Array)) {
     return (Result) {
       .ok = INVALID_SIZE,
-      .error_msg = "SizeError: Type cannot have less than 1 byte\n"
+      .error_msg = "SizeError: Buffer is not aligned for the array header\n"
     };
   }
-
-  Array *result = (Array*)malloc(sizeof(Array) + capacity * type_size);
-  if (!result) {
+  if (type_size <= 0) {
     return (Result) {
-      .ok = HEAP_FAILURE,
-      .error_msg = "AllocationError: Not enough memory in the heap"
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Type cannot have less than 1 byte\n"
     };
   }
-  else {
-    result->capacity = capacity, result->type_size = type_size;
-    memcpy(result->data, data, size * type_size);
-
+  if (buffer_bytes < sizeof(Array)) {
     return (Result) {
-      .ok = NO_ERROR,
-      .data = result
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Buffer is smaller than the array header\n"
     };
   }
+
+  Array *result = (Array*)buffer;
+  result->capacity = (buffer_bytes - sizeof(Array)) / type_size, result->type_size = type_size;
+  result->allocator = NULL;
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
 }
 
 /**
@@ -86,18 +284,50 @@ Result new_Array(void *data, size_t size, size_t capacity, size_t type_size) {
  * @date 20/09/2025
  * @brief return a clone to the data
  * 
+ * The clone is allocated with the same allocator as \i `from`, or on the heap
+ * if \i `from` lives in a caller-provided buffer.
+ * An \c `Array` has no size, all its \i `capacity` elements are its content
+ * and are copied.
+ * 
  * @param from a pointer to data
  * 
  * @return a \i `Result` variable whether an error occured or not
  */
-Result from_Array(Array *from) {
+C_DSA_API Result from_Array(Array *from) {
   if (!from) {
     return (Result) {
       .ok = SEGFAULT,
       .error_msg = "ValueError: cannot access a null pointer\n"
     };
   }
-  return new_Array(from->data, from->capacity, from->capacity, from->type_size);
+  Result result = new_Array_with_allocator(from->data, from->capacity, from->capacity, from->type_size,
+                                           from->allocator ? from->allocator : &heap_allocator);
+  if (result.ok == NO_ERROR) C_DSA_COUNT_CLONE(C_DSA_ARRAY, from->capacity * from->type_size);
+  return result;
+}
+
+/**
+ * @fn status_t create_from_Array(Array **out, const Array *from)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `from_Array`, returning the clone through \i `out`
+ * 
+ * @param out where the address of the clone is written, a null pointer on error
+ * @param from a pointer to data
+ * 
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t create_from_Array(Array **out, const Array *from) {
+  if (C_DSA_UNLIKELY(!out)) return SEGFAULT;
+  if (C_DSA_UNLIKELY(!from)) {
+    *out = NULL;
+    return SEGFAULT;
+  }
+  status_t status = create_Array_with_allocator(out, (void*)from->data, from->capacity, from->capacity,
+                                                from->type_size,
+                                                from->allocator ? from->allocator : &heap_allocator);
+  if (status == NO_ERROR) C_DSA_COUNT_CLONE(C_DSA_ARRAY, from->capacity * from->type_size);
+  return status;
 }
 
 /**
@@ -106,11 +336,18 @@ Result from_Array(Array *from) {
  * @date 20/09/2025
  * @brief deallocate data and set pointer to NULL
  * 
+ * An array created by \c `init_Array` is not deallocated.
+ * 
  * @param to_delete a pointer to the allocated data pointer
  */
-void free_Array(Array **to_delete) {
+C_DSA_API void free_Array(Array **to_delete) {
   if (!to_delete || !(*to_delete)) return;
-  free(*to_delete);
+  const Allocator *allocator = (*to_delete)->allocator;
+  if (allocator) {
+    size_t bytes = sizeof(Array) + (*to_delete)->capacity * (*to_delete)->type_size;
+    C_DSA_COUNT_FREE(C_DSA_ARRAY, bytes);
+    allocator->free(allocator->ctx, *to_delete, bytes);
+  }
   *to_delete = NULL;
 }
 
@@ -125,12 +362,69 @@ void free_Array(Array **to_delete) {
  * 
  * @return pointer to the data at \i `index`
  */
-void *get_item_Array(Array *from, size_t index) {
+C_DSA_API void *get_item_Array(Array *from, size_t index) {
   if (!from) return NULL;
-  if (index < 0 || index >= from->capacity) {
+  if (index >= from->capacity) {
     return NULL;
   }
   return from->data + index * from->type_size;
 }
 
+/**
+ * @fn static inline void *at_unchecked_Array(Array *arr, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the \i `index`-th element without any check
+ * 
+ * The fast path of \c `get_item_Array` for tight loops, \i `arr` must not be
+ * a null pointer and \i `index` must be in [0, \i `capacity` - 1].
+ */
+static inline void *at_unchecked_Array(Array *arr, size_t index) {
+  return arr->data + arr->type_size * index;
+}
+
+/**
+ * @fn static inline void *data_ptr_Array(Array *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the first element, \i `arr` must not be a null pointer
+ */
+static inline void *data_ptr_Array(Array *arr) {
+  return arr->data;
+}
+
+/**
+ * @fn static inline void *begin_Array(Array *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the first element, \i `arr` must not be a null pointer
+ */
+static inline void *begin_Array(Array *arr) {
+  return arr->data;
+}
+
+/**
+ * @fn static inline void *end_Array(Array *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer past the last element, \i `arr` must not be a null pointer
+ */
+static inline void *end_Array(Array *arr) {
+  return arr->data + arr->type_size * arr->capacity;
+}
+
+/**
+ * @def FOREACH_Array(arr, T, it)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief iterate \i `it` (a \i `T` pointer) over the elements of \i `arr`
+ * 
+ * The base pointer and the end are computed once, so every step is a pointer
+ * increment. \i `T` must be the element type (\c `sizeof(T)` == \i `type_size`),
+ * with the type specialised arrays it can be used as is, e.g.
+ * \c `FOREACH_Array(arr_int, int, it) { *it = 0; }`.
+ */
+#define FOREACH_Array(arr, T, it) \
+  for (T *it = (T*)(arr)->data, *it##_end = it + (arr)->capacity; it != it##_end; ++it)
+
 #endif // __C_DSA_GENERIC_ARRAY__
\ No newline at end of file
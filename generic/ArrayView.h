@@ -0,0 +1,232 @@
+/**
+ * @file ArrayView.h
+ * @brief a generic non-owning view over the elements of an array
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details This library introduces a structure \c `ArrayView`, a pointer to the
+ * first element, a \i `size`, the \i `type_size` and a \i `stride` (the
+ * distance between two elements of the view, counted in elements of the
+ * underlying array, 1 for a contiguous view).
+ * A view is a plain value: it is made without allocation nor copy, it is
+ * passed and returned by value or through out-parameters, and there is nothing
+ * to free. It is valid as long as the elements it points to.
+ * Views are made from \c `Array` (over [0, \i `capacity` - 1]), \c `StrictArray`
+ * (over [0, \i `size` - 1]) and other views, see generic/ArrayView_template.h
+ * for the views of the type specialised arrays.
+ *
+ * ArrayView's APIs:
+ * @li view_T : a view over every element of type T
+ * @li slice_T : a view over the elements [begin, end - 1] of type T
+ * @li strided_T : a view over one element every \i `step` in [begin, end - 1] of type T
+ * @li subview_ArrayView : a view over the elements [begin, end - 1] of a view
+ * @li get_item_ArrayView : get the pointer to the item on \i `index` of a view
+ * @li at_unchecked_ArrayView : the same without any check
+ */
+#ifndef __C_DSA_GENERIC_ARRAY_VIEW_H__
+#define __C_DSA_GENERIC_ARRAY_VIEW_H__
+
+#include <stddef.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/checked.h"
+#include "StrictArray.h"
+#include "Array.h"
+
+typedef struct ArrayView ArrayView;
+
+/**
+ * @struct ArrayView
+ * @author andarling
+ * @date 14/10/2026
+ * @brief \i `size` elements of \i `type_size` bytes, \i `stride` elements apart,
+ * starting at \i `data`
+ */
+struct ArrayView {
+  char *data;
+  size_t size, type_size, stride;
+};
+
+/**
+ * @brief the view over one element every \i `step` of [begin, end - 1] of
+ * \i `n` elements starting at \i `data`
+ */
+C_DSA_API status_t strided_bytes(char *data, size_t n, size_t type_size, size_t stride,
+                                 size_t begin, size_t end, size_t step, ArrayView *out) {
+  if (!out) return SEGFAULT;
+  if (begin > end || end > n) return INVALID_INDEX;
+  if (!step) return INVALID_SIZE;
+  size_t offset, view_stride;
+  if (checked_mul(stride, begin, &offset) || checked_mul(offset, type_size, &offset)
+      || checked_mul(stride, step, &view_stride)) {
+    return INVALID_SIZE;
+  }
+  out->data = data + offset;
+  // end - begin + step - 1 wraps around for a step close to SIZE_MAX
+  out->size = (end - begin) / step + ((end - begin) % step != 0);
+  out->type_size = type_size;
+  out->stride = view_stride;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t view_StrictArray(StrictArray *arr, ArrayView *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write to \i `out` a view over the [0, \i `size` - 1] elements of the array
+ *
+ * @param[in] arr a pointer to \c `StrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[out] out the view
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t view_StrictArray(StrictArray *arr, ArrayView *out) {
+  if (!arr) return SEGFAULT;
+  return strided_bytes(arr->data, arr->size, arr->type_size, 1, 0, arr->size, 1, out);
+}
+
+/**
+ * @fn status_t slice_StrictArray(StrictArray *arr, size_t begin, size_t end, ArrayView *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write to \i `out` a view over the [begin, end - 1] elements of the array
+ *
+ * @param[in] arr a pointer to \c `StrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] begin the first element of the view
+ * @param[in] end the element after the last one of the view
+ * (begin <= end <= \i `size`, else \c `INVALID_INDEX` is returned)
+ * @param[out] out the view
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t slice_StrictArray(StrictArray *arr, size_t begin, size_t end, ArrayView *out) {
+  if (!arr) return SEGFAULT;
+  return strided_bytes(arr->data, arr->size, arr->type_size, 1, begin, end, 1, out);
+}
+
+/**
+ * @fn status_t strided_StrictArray(StrictArray *arr, size_t begin, size_t end, size_t step, ArrayView *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write to \i `out` a view over the elements begin, begin + step, ...
+ * before \i `end` of the array
+ *
+ * @param[in] arr a pointer to \c `StrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] begin the first element of the view
+ * @param[in] end the bound of the view
+ * (begin <= end <= \i `size`, else \c `INVALID_INDEX` is returned)
+ * @param[in] step the distance between two elements of the view
+ * (step > 0, and the stride of the view must fit in a \c `size_t`, else
+ * \c `INVALID_SIZE` is returned)
+ * @param[out] out the view
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t strided_StrictArray(StrictArray *arr, size_t begin, size_t end, size_t step, ArrayView *out) {
+  if (!arr) return SEGFAULT;
+  return strided_bytes(arr->data, arr->size, arr->type_size, 1, begin, end, step, out);
+}
+
+/**
+ * @fn status_t view_Array(Array *arr, ArrayView *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write to \i `out` a view over the [0, \i `capacity` - 1] elements of the array
+ */
+C_DSA_API status_t view_Array(Array *arr, ArrayView *out) {
+  if (!arr) return SEGFAULT;
+  return strided_bytes(arr->data, arr->capacity, arr->type_size, 1, 0, arr->capacity, 1, out);
+}
+
+/**
+ * @fn status_t slice_Array(Array *arr, size_t begin, size_t end, ArrayView *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write to \i `out` a view over the [begin, end - 1] elements of the array
+ *
+ * The same as \c `slice_StrictArray`, with end <= \i `capacity`.
+ */
+C_DSA_API status_t slice_Array(Array *arr, size_t begin, size_t end, ArrayView *out) {
+  if (!arr) return SEGFAULT;
+  return strided_bytes(arr->data, arr->capacity, arr->type_size, 1, begin, end, 1, out);
+}
+
+/**
+ * @fn status_t strided_Array(Array *arr, size_t begin, size_t end, size_t step, ArrayView *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write to \i `out` a view over the elements begin, begin + step, ...
+ * before \i `end` of the array
+ *
+ * The same as \c `strided_StrictArray`, with end <= \i `capacity`.
+ */
+C_DSA_API status_t strided_Array(Array *arr, size_t begin, size_t end, size_t step, ArrayView *out) {
+  if (!arr) return SEGFAULT;
+  return strided_bytes(arr->data, arr->capacity, arr->type_size, 1, begin, end, step, out);
+}
+
+/**
+ * @fn status_t subview_ArrayView(const ArrayView *view, size_t begin, size_t end, ArrayView *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write to \i `out` a view over the [begin, end - 1] elements of \i `view`
+ *
+ * \i `out` may be \i `view`.
+ *
+ * @param[in] view a pointer to \c `ArrayView` type
+ * (if view is a null pointer then an error of invalid instance is returned)
+ * @param[in] begin the first element of the view
+ * @param[in] end the element after the last one of the view
+ * (begin <= end <= \i `size`, else \c `INVALID_INDEX` is returned)
+ * @param[out] out the view
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t subview_ArrayView(const ArrayView *view, size_t begin, size_t end, ArrayView *out) {
+  if (!view) return SEGFAULT;
+  return strided_bytes(view->data, view->size, view->type_size, view->stride, begin, end, 1, out);
+}
+
+/**
+ * @fn status_t strided_ArrayView(const ArrayView *view, size_t begin, size_t end, size_t step, ArrayView *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write to \i `out` a view over the elements begin, begin + step, ...
+ * before \i `end` of \i `view`
+ *
+ * The same as \c `strided_StrictArray`, with end <= \i `size` of the view.
+ */
+C_DSA_API status_t strided_ArrayView(const ArrayView *view, size_t begin, size_t end, size_t step, ArrayView *out) {
+  if (!view) return SEGFAULT;
+  return strided_bytes(view->data, view->size, view->type_size, view->stride, begin, end, step, out);
+}
+
+/**
+ * @fn void *get_item_ArrayView(const ArrayView *view, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the desired elements
+ *
+ * This function returns a pointer to the desired elements, if it is out-of-bound
+ * (outside of [0, \c `size` - 1]), the output is a null pointer
+ */
+C_DSA_API void *get_item_ArrayView(const ArrayView *view, size_t index) {
+  if (!view || index >= view->size) return NULL;
+  return view->data + view->type_size * view->stride * index;
+}
+
+/**
+ * @fn static inline void *at_unchecked_ArrayView(const ArrayView *view, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the \i `index`-th element without any check
+ */
+static inline void *at_unchecked_ArrayView(const ArrayView *view, size_t index) {
+  return view->data + view->type_size * view->stride * index;
+}
+
+#endif // __C_DSA_GENERIC_ARRAY_VIEW_H__
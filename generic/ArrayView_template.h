@@ -0,0 +1,120 @@
+/**
+ * @file ArrayView_template.h
+ * @brief a generator for views over the type specialised arrays
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details \c `DEFINE_ARRAY_VIEW(T, suffix)` emits a structure
+ * \c `ArrayView_suffix`, a non-owning view over elements of type \i `T`, and its
+ * constructors from \c `StrictArray_suffix`, \c `Array_suffix` and other views,
+ * so both arrays must be generated before (\c `DEFINE_STRICT_ARRAY` and
+ * \c `DEFINE_ARRAY` with the same \i `T` and \i `suffix`).
+ * The \i `stride` is counted in elements, views are plain values, see
+ * generic/ArrayView.h.
+ *
+ * Generated APIs (V stands for \c `ArrayView_suffix`, A for \c `StrictArray_suffix`
+ * or \c `Array_suffix`):
+ * @li status_t view_A(A *arr, V *out) : a view over every element of \i `arr`
+ * @li status_t slice_A(A *arr, size_t begin, size_t end, V *out) : a view over
+ * the elements [begin, end - 1] of \i `arr`
+ * @li status_t strided_A(A *arr, size_t begin, size_t end, size_t step, V *out) :
+ * a view over one element every \i `step` in [begin, end - 1] of \i `arr`
+ * @li status_t subview_V(const V *view, size_t begin, size_t end, V *out) : a
+ * view over the elements [begin, end - 1] of \i `view`
+ * @li status_t strided_V(const V *view, size_t begin, size_t end, size_t step,
+ * V *out) : a view over one element every \i `step` in [begin, end - 1] of \i `view`
+ * @li T *get_item_V(const V *view, size_t index) : pointer to the \i `index`-th
+ * element, or a null pointer if out of [0, \i `size` - 1]
+ * @li T *at_unchecked_V(const V *view, size_t index) : \c `static inline` pointer
+ * to the \i `index`-th element without any check
+ *
+ * Errors and edge cases behave exactly as in generic/ArrayView.h.
+ */
+#ifndef __C_DSA_GENERIC_ARRAY_VIEW_TEMPLATE_H__
+#define __C_DSA_GENERIC_ARRAY_VIEW_TEMPLATE_H__
+
+#include <stddef.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/checked.h"
+
+#define DEFINE_ARRAY_VIEW(T, suffix)                                           \
+  typedef struct ArrayView_##suffix ArrayView_##suffix;                        \
+                                                                               \
+  struct ArrayView_##suffix {                                                  \
+    T *data;                                                                   \
+    size_t size, stride;                                                       \
+  };                                                                           \
+                                                                               \
+  C_DSA_API status_t make_ArrayView_##suffix(T *data, size_t n, size_t stride, size_t begin, \
+                                                size_t end, size_t step, ArrayView_##suffix *out) { \
+    if (!out) return SEGFAULT;                                                 \
+    if (begin > end || end > n) return INVALID_INDEX;                          \
+    if (!step) return INVALID_SIZE;                                            \
+    size_t offset, view_stride;                                                \
+    if (checked_mul(stride, begin, &offset) || checked_mul(stride, step, &view_stride)) { \
+      return INVALID_SIZE;                                                     \
+    }                                                                          \
+    out->data = data + offset;                                                 \
+    out->size = (end - begin) / step + ((end - begin) % step != 0);            \
+    out->stride = view_stride;                                                 \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t view_StrictArray_##suffix(StrictArray_##suffix *arr, ArrayView_##suffix *out) { \
+    if (!arr) return SEGFAULT;                                                 \
+    return make_ArrayView_##suffix(arr->data, arr->size, 1, 0, arr->size, 1, out); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t slice_StrictArray_##suffix(StrictArray_##suffix *arr, size_t begin, size_t end, \
+                                           ArrayView_##suffix *out) {          \
+    if (!arr) return SEGFAULT;                                                 \
+    return make_ArrayView_##suffix(arr->data, arr->size, 1, begin, end, 1, out); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t strided_StrictArray_##suffix(StrictArray_##suffix *arr, size_t begin, size_t end, \
+                                             size_t step, ArrayView_##suffix *out) { \
+    if (!arr) return SEGFAULT;                                                 \
+    return make_ArrayView_##suffix(arr->data, arr->size, 1, begin, end, step, out); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t view_Array_##suffix(Array_##suffix *arr, ArrayView_##suffix *out) { \
+    if (!arr) return SEGFAULT;                                                 \
+    return make_ArrayView_##suffix(arr->data, arr->capacity, 1, 0, arr->capacity, 1, out); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t slice_Array_##suffix(Array_##suffix *arr, size_t begin, size_t end, \
+                                     ArrayView_##suffix *out) {                \
+    if (!arr) return SEGFAULT;                                                 \
+    return make_ArrayView_##suffix(arr->data, arr->capacity, 1, begin, end, 1, out); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t strided_Array_##suffix(Array_##suffix *arr, size_t begin, size_t end, \
+                                       size_t step, ArrayView_##suffix *out) { \
+    if (!arr) return SEGFAULT;                                                 \
+    return make_ArrayView_##suffix(arr->data, arr->capacity, 1, begin, end, step, out); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t subview_ArrayView_##suffix(const ArrayView_##suffix *view, size_t begin, \
+                                           size_t end, ArrayView_##suffix *out) { \
+    if (!view) return SEGFAULT;                                                \
+    return make_ArrayView_##suffix(view->data, view->size, view->stride, begin, end, 1, out); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t strided_ArrayView_##suffix(const ArrayView_##suffix *view, size_t begin, \
+                                           size_t end, size_t step, ArrayView_##suffix *out) { \
+    if (!view) return SEGFAULT;                                                \
+    return make_ArrayView_##suffix(view->data, view->size, view->stride, begin, end, step, out); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API T *get_item_ArrayView_##suffix(const ArrayView_##suffix *view, size_t index) { \
+    if (!view || index >= view->size) return NULL;                             \
+    return view->data + view->stride * index;                                  \
+  }                                                                            \
+                                                                               \
+  static inline T *at_unchecked_ArrayView_##suffix(const ArrayView_##suffix *view, size_t index) { \
+    return view->data + view->stride * index;                                  \
+  }
+
+#endif // __C_DSA_GENERIC_ARRAY_VIEW_TEMPLATE_H__
@@ -0,0 +1,240 @@
+/**
+ * @file Array_template.h
+ * @brief a generator for type specialised normal arrays
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details \c `DEFINE_ARRAY(T, suffix)` emits a structure \c `Array_suffix`
+ * holding \i `capacity` elements of type \i `T` and the same APIs as the generic
+ * \c `Array`, with \c `sizeof(T)` known at compile time.
+ *
+ * Generated APIs (S stands for \c `Array_suffix`):
+ * @li Result new_S(T *data, size_t size, size_t capacity) : create S on the heap,
+ * copying the first \i `size` elements of \i `data`
+ * @li Result new_S_with_allocator(T *data, size_t size, size_t capacity,
+ * const Allocator *allocator) : create S through \i `allocator`
+ * @li status_t create_S(S **out, T *data, size_t size, size_t capacity),
+ * status_t create_S_with_allocator(S **out, T *data, size_t size, size_t capacity,
+ * const Allocator *allocator) : the same as \i `new_S` and \i `new_S_with_allocator`,
+ * returning a status code and S through \i `out`
+ * @li Result new_S_aligned(T *data, size_t size, size_t capacity, size_t alignment),
+ * status_t create_S_aligned(S **out, T *data, size_t size, size_t capacity,
+ * size_t alignment) : create S with \i `data` aligned to \i `alignment` (a power
+ * of two in [\c `C_DSA_MIN_ALIGNMENT`, \c `C_DSA_MAX_ALIGNMENT`]), its clones are
+ * aligned the same way
+ * @li size_t alignment_S(const S *arr) : the alignment of \i `data`, at most
+ * \c `C_DSA_MAX_ALIGNMENT`
+ * @li size_t S_bytes_required(size_t capacity) : the size of a buffer holding S
+ * with \i `capacity` elements
+ * @li Result init_S(void *buffer, size_t buffer_bytes) : lay out S in a
+ * caller-provided buffer, without allocation
+ * @li Result from_S(S *from) : clone S with the allocator of \i `from` (or on the
+ * heap if \i `from` lives in a caller-provided buffer)
+ * @li status_t create_from_S(S **out, const S *from) : the same as \i `from_S`
+ * through \i `out`
+ * @li void free_S(S **to_delete) : deallocate S (unless it was created by
+ * \i `init_S`) and set the pointer to NULL
+ * @li T *get_item_S(S *from, size_t index) : pointer to the \i `index`-th
+ * element, or a null pointer if out of [0, \i `capacity` - 1]
+ * @li T *at_unchecked_S(S *arr, size_t index) : \c `static inline` pointer to the
+ * \i `index`-th element without any check (index in [0, \i `capacity` - 1])
+ * @li T *data_ptr_S(S *arr), T *begin_S(S *arr), T *end_S(S *arr) :
+ * \c `static inline` pointers to the first and past the last elements
+ *
+ * The \c `FOREACH_Array` macro of the generic header also iterates S.
+ *
+ * Errors and edge cases behave exactly as in generic/Array.h.
+ */
+#ifndef __C_DSA_GENERIC_ARRAY_TEMPLATE_H__
+#define __C_DSA_GENERIC_ARRAY_TEMPLATE_H__
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/Result.h"
+#include "../utils/status.h"
+#include "../utils/Allocator.h"
+#include "../utils/AlignedAllocator.h"
+#include "../utils/instrument.h"
+#include "../utils/checked.h"
+
+#define DEFINE_ARRAY(T, suffix)                                                \
+  typedef struct Array_##suffix Array_##suffix;                                \
+                                                                               \
+  struct Array_##suffix {                                                      \
+    size_t capacity;                                                           \
+    const Allocator *allocator;                                                \
+    T data[];                                                                  \
+  };                                                                           \
+                                                                               \
+  C_DSA_API status_t create_Array_##suffix##_with_allocator(Array_##suffix **out, T *data, size_t size, \
+                                                     size_t capacity, const Allocator *allocator) { \
+    if (C_DSA_UNLIKELY(!out)) return SEGFAULT;                                 \
+    *out = NULL;                                                               \
+    if (!data) {                                                               \
+      size = 0;                                                                \
+    }                                                                          \
+    if (C_DSA_UNLIKELY(!allocator)) return SEGFAULT;                           \
+    if (C_DSA_UNLIKELY(capacity < size)) return INVALID_SIZE;                  \
+    size_t bytes;                                                              \
+    if (C_DSA_UNLIKELY(checked_bytes(sizeof(Array_##suffix), capacity, sizeof(T), &bytes))) return INVALID_SIZE; \
+    Array_##suffix *result = (Array_##suffix*)allocator->alloc(allocator->ctx, bytes); \
+    if (C_DSA_UNLIKELY(!result)) return HEAP_FAILURE;                          \
+    result->capacity = capacity;                                               \
+    result->allocator = allocator;                                             \
+    if (size) memcpy(result->data, data, size * sizeof(T));                    \
+    C_DSA_COUNT_ALLOC(C_DSA_ARRAY, bytes);                                     \
+    *out = result;                                                             \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t create_Array_##suffix(Array_##suffix **out, T *data, size_t size, size_t capacity) { \
+    return create_Array_##suffix##_with_allocator(out, data, size, capacity, &heap_allocator); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result new_Array_##suffix##_with_allocator(T *data, size_t size, size_t capacity, \
+                                                  const Allocator *allocator) { \
+    Array_##suffix *result;                                                    \
+    status_t status = create_Array_##suffix##_with_allocator(&result, data, size, capacity, allocator); \
+    if (C_DSA_LIKELY(status == NO_ERROR)) {                                    \
+      return (Result) {                                                        \
+        .ok = NO_ERROR,                                                        \
+        .data = result                                                         \
+      };                                                                       \
+    }                                                                          \
+    return (Result) {                                                          \
+      .ok = status,                                                            \
+      .error_msg = status == SEGFAULT ? "ValueError: cannot access a null pointer\n" \
+                 : status == HEAP_FAILURE ? "AllocationError: Not enough memory in the heap" \
+                 : data && capacity < size ? "SizeError: size is negative or capacity is less than size\n" \
+                 : "SizeError: Capacity is too big\n"                          \
+    };                                                                         \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result new_Array_##suffix(T *data, size_t size, size_t capacity) { \
+    return new_Array_##suffix##_with_allocator(data, size, capacity, &heap_allocator); \
+  }                                                                            \
+                                                                               \
+  DEFINE_ALIGNED_ALLOCATORS(Array_##suffix, sizeof(Array_##suffix))            \
+                                                                               \
+  C_DSA_API status_t create_Array_##suffix##_aligned(Array_##suffix **out, T *data, size_t size, size_t capacity, \
+                                            size_t alignment) {                \
+    const Allocator *allocator = Array_##suffix##_aligned_allocator(alignment); \
+    if (C_DSA_UNLIKELY(!allocator)) {                                          \
+      if (out) *out = NULL;                                                    \
+      return out ? INVALID_SIZE : SEGFAULT;                                    \
+    }                                                                          \
+    return create_Array_##suffix##_with_allocator(out, data, size, capacity, allocator); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result new_Array_##suffix##_aligned(T *data, size_t size, size_t capacity, size_t alignment) { \
+    const Allocator *allocator = Array_##suffix##_aligned_allocator(alignment); \
+    if (!allocator) {                                                          \
+      return (Result) {                                                        \
+        .ok = INVALID_SIZE,                                                    \
+        .error_msg = "SizeError: Alignment is not a power of two in the supported range\n" \
+      };                                                                       \
+    }                                                                          \
+    return new_Array_##suffix##_with_allocator(data, size, capacity, allocator); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API size_t alignment_Array_##suffix(const Array_##suffix *arr) {       \
+    return alignment_of(arr->data);                                            \
+  }                                                                            \
+                                                                               \
+  C_DSA_API size_t Array_##suffix##_bytes_required(size_t capacity) {          \
+    size_t bytes;                                                              \
+    return checked_bytes(sizeof(Array_##suffix), capacity, sizeof(T), &bytes) == NO_ERROR ? bytes : 0; \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result init_Array_##suffix(void *buffer, size_t buffer_bytes) {    \
+    if (!buffer) {                                                             \
+      return (Result) {                                                        \
+        .ok = SEGFAULT,                                                        \
+        .error_msg = "ValueError: cannot access a null pointer\n"              \
+      };                                                                       \
+    }                                                                          \
+    if ((size_t)buffer % _Alignof(Array_##suffix)) {                           \
+      return (Result) {                                                        \
+        .ok = INVALID_SIZE,                                                    \
+        .error_msg = "SizeError: Buffer is not aligned for the array header\n" \
+      };                                                                       \
+    }                                                                          \
+    if (buffer_bytes < sizeof(Array_##suffix)) {                               \
+      return (Result) {                                                        \
+        .ok = INVALID_SIZE,                                                    \
+        .error_msg = "SizeError: Buffer is smaller than the array header\n"    \
+      };                                                                       \
+    }                                                                          \
+    Array_##suffix *result = (Array_##suffix*)buffer;                          \
+    result->capacity = (buffer_bytes - sizeof(Array_##suffix)) / sizeof(T);    \
+    result->allocator = NULL;                                                  \
+    return (Result) {                                                          \
+      .ok = NO_ERROR,                                                          \
+      .data = result                                                           \
+    };                                                                         \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result from_Array_##suffix(Array_##suffix *from) {                 \
+    if (!from) {                                                               \
+      return (Result) {                                                        \
+        .ok = SEGFAULT,                                                        \
+        .error_msg = "ValueError: cannot access a null pointer\n"              \
+      };                                                                       \
+    }                                                                          \
+    Result result = new_Array_##suffix##_with_allocator(from->data, from->capacity, \
+                                                        from->capacity,        \
+                                                        from->allocator ? from->allocator : &heap_allocator); \
+    if (result.ok == NO_ERROR) C_DSA_COUNT_CLONE(C_DSA_ARRAY, sizeof(T) * from->capacity); \
+    return result;                                                             \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t create_from_Array_##suffix(Array_##suffix **out, const Array_##suffix *from) { \
+    if (C_DSA_UNLIKELY(!out)) return SEGFAULT;                                 \
+    if (C_DSA_UNLIKELY(!from)) {                                               \
+      *out = NULL;                                                             \
+      return SEGFAULT;                                                         \
+    }                                                                          \
+    status_t status = create_Array_##suffix##_with_allocator(out, (T*)from->data, from->capacity, from->capacity, \
+                                                            from->allocator ? from->allocator : &heap_allocator); \
+    if (status == NO_ERROR) C_DSA_COUNT_CLONE(C_DSA_ARRAY, sizeof(T) * from->capacity); \
+    return status;                                                             \
+  }                                                                            \
+                                                                               \
+  C_DSA_API void free_Array_##suffix(Array_##suffix **to_delete) {             \
+    if (!to_delete || !(*to_delete)) return;                                   \
+    const Allocator *allocator = (*to_delete)->allocator;                      \
+    if (allocator) {                                                           \
+      size_t bytes = sizeof(Array_##suffix) + sizeof(T) * (*to_delete)->capacity; \
+      C_DSA_COUNT_FREE(C_DSA_ARRAY, bytes);                                    \
+      allocator->free(allocator->ctx, *to_delete, bytes);                      \
+    }                                                                          \
+    *to_delete = NULL;                                                         \
+  }                                                                            \
+                                                                               \
+  C_DSA_API T *get_item_Array_##suffix(Array_##suffix *from, size_t index) {   \
+    if (!from) return NULL;                                                    \
+    if (index >= from->capacity) {                                             \
+      return NULL;                                                             \
+    }                                                                          \
+    return from->data + index;                                                 \
+  }                                                                            \
+                                                                               \
+  static inline T *at_unchecked_Array_##suffix(Array_##suffix *arr, size_t index) { \
+    return arr->data + index;                                                  \
+  }                                                                            \
+                                                                               \
+  static inline T *data_ptr_Array_##suffix(Array_##suffix *arr) {              \
+    return arr->data;                                                          \
+  }                                                                            \
+                                                                               \
+  static inline T *begin_Array_##suffix(Array_##suffix *arr) {                 \
+    return arr->data;                                                          \
+  }                                                                            \
+                                                                               \
+  static inline T *end_Array_##suffix(Array_##suffix *arr) {                   \
+    return arr->data + arr->capacity;                                          \
+  }
+
+#endif // __C_DSA_GENERIC_ARRAY_TEMPLATE_H__
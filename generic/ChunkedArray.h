@@ -0,0 +1,359 @@
+/**
+ * @file ChunkedArray.h
+ * @brief a generic append-only array of fixed-size \c `StrictArray` segments
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details This library introduces a structure \c `ChunkedArray`, an unbounded
+ * sequence of \b `any types` made for streams: the elements are appended at the
+ * back and consumed from the front.
+ * The elements live in \c `StrictArray` segments of \i `1 << chunk_shift`
+ * elements, a full segment is never reallocated, so appending never moves an
+ * element and pointers to the elements stay valid until they are released.
+ * \i `segments` indexes the segments in order, the element \i `i` is in segment
+ * \i `(head + i) >> chunk_shift` at offset \i `(head + i) & mask`, \i `head` being
+ * the offset of the first element in the first segment.
+ * \c `release_front_T` drops consumed elements and hands every segment it
+ * empties back to a pool of up to \c `C_DSA_CHUNKED_ARRAY_SPARE` segments,
+ * the next appends reuse them, so a stream consumed as fast as it is produced
+ * holds a bounded number of segments and stops hitting the allocator.
+ *
+ * ChunkedArray's APIs:
+ * @li new_T : dynamically create an empty type T on the heap
+ * @li new_T_with_allocator : dynamically create type T with an \c `Allocator`
+ * @li free_T : deallocate type T and its segments
+ * @li push_back_T : insert an element at the end of T
+ * @li append_range_T : insert many elements at the end of T
+ * @li get_item_T : get the pointer to an element of T
+ * @li next_chunk_T : iterate over the elements of T a segment at a time
+ * @li release_front_T : remove the first elements of T
+ * @li clear_T : remove all elements of T
+ */
+#ifndef __C_DSA_GENERIC_CHUNKED_ARRAY_H__
+#define __C_DSA_GENERIC_CHUNKED_ARRAY_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+#include "StrictArray.h"
+
+/**
+ * @brief the number of released segments kept for reuse
+ */
+#ifndef C_DSA_CHUNKED_ARRAY_SPARE
+#define C_DSA_CHUNKED_ARRAY_SPARE 4
+#endif
+
+#define C_DSA_CHUNKED_ARRAY_MIN_INDEX 8
+
+typedef struct ChunkedArray ChunkedArray;
+
+/**
+ * @struct ChunkedArray
+ * @author andarling
+ * @date 14/10/2026
+ * @brief a sequence of segments holding \i `1 << chunk_shift` elements
+ *
+ * The segments in use are \i `segments[segment_begin]` to
+ * \i `segments[segment_begin + segment_count - 1]`, all full but the last one,
+ * and the first \i `head` elements of the first one are released.
+ * \i `spare` holds \i `spare_count` empty segments.
+ */
+struct ChunkedArray {
+  size_t size, type_size, chunk_shift, head;
+  size_t segment_begin, segment_count, segment_capacity, spare_count;
+  const Allocator *allocator;
+  StrictArray **segments;
+  StrictArray *spare[C_DSA_CHUNKED_ARRAY_SPARE];
+};
+
+C_DSA_API StrictArray *acquire_segment_ChunkedArray(ChunkedArray *arr) {
+  if (arr->spare_count) return arr->spare[--arr->spare_count];
+  Result segment = new_StrictArray_with_allocator(NULL, 0, (size_t)1 << arr->chunk_shift,
+                                                  arr->type_size, arr->allocator);
+  return segment.ok == NO_ERROR ? (StrictArray*)segment.data : NULL;
+}
+
+C_DSA_API void release_segment_ChunkedArray(ChunkedArray *arr, StrictArray *segment) {
+  if (arr->spare_count < C_DSA_CHUNKED_ARRAY_SPARE) {
+    clear_StrictArray(segment);
+    arr->spare[arr->spare_count++] = segment;
+    return;
+  }
+  free_StrictArray(&segment);
+}
+
+/**
+ * @brief append an empty segment to the index, which is compacted when it
+ * reaches its end less than half full and doubled otherwise
+ */
+C_DSA_API status_t add_segment_ChunkedArray(ChunkedArray *arr) {
+  const Allocator *allocator = arr->allocator;
+  if (arr->segment_begin + arr->segment_count == arr->segment_capacity) {
+    size_t cap = arr->segment_capacity;
+    if (arr->segment_count >= cap / 2) {
+      if (cap > SIZE_MAX / 2 / sizeof(StrictArray*)) return HEAP_FAILURE;
+      StrictArray **segments = (StrictArray**)allocator->realloc(
+        allocator->ctx, arr->segments, cap * sizeof(StrictArray*), 2 * cap * sizeof(StrictArray*));
+      if (!segments) return HEAP_FAILURE;
+      arr->segments = segments;
+      arr->segment_capacity = 2 * cap;
+    }
+    memmove(arr->segments, arr->segments + arr->segment_begin, arr->segment_count * sizeof(StrictArray*));
+    arr->segment_begin = 0;
+  }
+  StrictArray *segment = acquire_segment_ChunkedArray(arr);
+  if (!segment) return HEAP_FAILURE;
+  arr->segments[arr->segment_begin + arr->segment_count++] = segment;
+  return NO_ERROR;
+}
+
+// remove the elements after the first size ones, releasing the emptied segments
+C_DSA_API void truncate_ChunkedArray(ChunkedArray *arr, size_t size) {
+  size_t segments = size ? ((arr->head + size - 1) >> arr->chunk_shift) + 1 : 0;
+  while (arr->segment_count > segments) {
+    release_segment_ChunkedArray(arr, arr->segments[arr->segment_begin + --arr->segment_count]);
+  }
+  if (segments) {
+    StrictArray *last = arr->segments[arr->segment_begin + segments - 1];
+    last->size = ((arr->head + size - 1) & (((size_t)1 << arr->chunk_shift) - 1)) + 1;
+  }
+  else {
+    arr->head = 0;
+  }
+  arr->size = size;
+}
+
+/**
+ * @fn Result new_ChunkedArray_with_allocator(size_t chunk_capacity, size_t type_size, const Allocator *allocator)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to an empty chunked array allocated by
+ * \i `allocator`, which also allocates the segments
+ *
+ * No segment is allocated until the first insertion.
+ *
+ * @param[in] chunk_capacity the number of elements of a segment, rounded up to
+ * a power of two
+ * (chunk_capacity > 0)
+ * @param[in] type_size size of every elements in the array
+ * (type_size > 0)
+ * @param[in] allocator the allocator to use, it must outlive the array
+ * (allocator is not a null pointer)
+ *
+ * @return a \c `Result` type to the successfully allocated array or a error message
+ */
+C_DSA_API Result new_ChunkedArray_with_allocator(size_t chunk_capacity, size_t type_size,
+                                                 const Allocator *allocator) {
+  if (!allocator) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  size_t shift = 0;
+  while (shift < sizeof(size_t) * 8 - 1 && ((size_t)1 << shift) < chunk_capacity) shift++;
+  if (!chunk_capacity || !type_size || ((size_t)1 << shift) < chunk_capacity
+      || ((size_t)1 << shift) > SIZE_MAX / type_size) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: chunk_capacity and type_size must be positive\n"
+    };
+  }
+  ChunkedArray *result = (ChunkedArray*)allocator->alloc(allocator->ctx, sizeof(ChunkedArray));
+  StrictArray **segments = (StrictArray**)allocator->alloc(
+    allocator->ctx, C_DSA_CHUNKED_ARRAY_MIN_INDEX * sizeof(StrictArray*));
+  if (!result || !segments) {
+    if (result) allocator->free(allocator->ctx, result, sizeof(ChunkedArray));
+    if (segments) allocator->free(allocator->ctx, segments, C_DSA_CHUNKED_ARRAY_MIN_INDEX * sizeof(StrictArray*));
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+  *result = (ChunkedArray) {
+    .type_size = type_size,
+    .chunk_shift = shift,
+    .segment_capacity = C_DSA_CHUNKED_ARRAY_MIN_INDEX,
+    .allocator = allocator,
+    .segments = segments
+  };
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn Result new_ChunkedArray(size_t chunk_capacity, size_t type_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `new_ChunkedArray_with_allocator` on the heap
+ */
+C_DSA_API Result new_ChunkedArray(size_t chunk_capacity, size_t type_size) {
+  return new_ChunkedArray_with_allocator(chunk_capacity, type_size, &heap_allocator);
+}
+
+/**
+ * @fn void clear_ChunkedArray(ChunkedArray *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove all elements, the segments go back to the pool
+ */
+C_DSA_API void clear_ChunkedArray(ChunkedArray *arr) {
+  if (!arr) return;
+  truncate_ChunkedArray(arr, 0);
+  arr->segment_begin = 0;
+}
+
+/**
+ * @fn void free_ChunkedArray(ChunkedArray **arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief deallocate the array, its segments and the pool, and set the pointer
+ * to NULL
+ */
+C_DSA_API void free_ChunkedArray(ChunkedArray **arr) {
+  if (!arr || !(*arr)) return;
+  ChunkedArray *to_delete = *arr;
+  const Allocator *allocator = to_delete->allocator;
+  for (size_t i = 0; i < to_delete->segment_count; ++i) {
+    free_StrictArray(&to_delete->segments[to_delete->segment_begin + i]);
+  }
+  for (size_t i = 0; i < to_delete->spare_count; ++i) {
+    free_StrictArray(&to_delete->spare[i]);
+  }
+  allocator->free(allocator->ctx, to_delete->segments, to_delete->segment_capacity * sizeof(StrictArray*));
+  allocator->free(allocator->ctx, to_delete, sizeof(ChunkedArray));
+  *arr = NULL;
+}
+
+/**
+ * @fn status_t push_back_ChunkedArray(ChunkedArray *arr, void *value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert \i `value` at the end of the array
+ *
+ * @param[in] arr a pointer to \c `ChunkedArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] value a pointer to the element to copy
+ *
+ * @return 0 if success, \c `HEAP_FAILURE` if a segment cannot be allocated, in
+ * which case the array is unchanged
+ */
+C_DSA_API status_t push_back_ChunkedArray(ChunkedArray *arr, void *value) {
+  if (!arr || !value) return SEGFAULT;
+  if (!arr->segment_count || !((arr->head + arr->size) & (((size_t)1 << arr->chunk_shift) - 1))) {
+    status_t status = add_segment_ChunkedArray(arr);
+    if (status != NO_ERROR) return status;
+  }
+  push_back_StrictArray(arr->segments[arr->segment_begin + arr->segment_count - 1], value);
+  arr->size++;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t append_range_ChunkedArray(ChunkedArray *arr, void *src, size_t count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert the \i `count` elements of \i `src` at the end of the array
+ *
+ * The elements are copied with one \c `memcpy` per segment. Either every
+ * element is inserted or none.
+ *
+ * @return 0 if success, \c `HEAP_FAILURE` if a segment cannot be allocated
+ */
+C_DSA_API status_t append_range_ChunkedArray(ChunkedArray *arr, void *src, size_t count) {
+  if (!arr || (!src && count)) return SEGFAULT;
+  size_t size = arr->size, chunk = (size_t)1 << arr->chunk_shift;
+  const char *from = (const char*)src;
+  while (count) {
+    size_t offset = (arr->head + arr->size) & (chunk - 1);
+    if (!arr->segment_count || !offset) {
+      if (add_segment_ChunkedArray(arr) != NO_ERROR) {
+        truncate_ChunkedArray(arr, size);
+        return HEAP_FAILURE;
+      }
+    }
+    size_t n = chunk - offset < count ? chunk - offset : count;
+    append_range_StrictArray(arr->segments[arr->segment_begin + arr->segment_count - 1], (void*)from, n);
+    from += n * arr->type_size;
+    arr->size += n;
+    count -= n;
+  }
+  return NO_ERROR;
+}
+
+/**
+ * @fn void *get_item_ChunkedArray(ChunkedArray *arr, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the \i `index`-th element from the front, or a
+ * null pointer if it is out of [0, \c `size` - 1]
+ */
+C_DSA_API void *get_item_ChunkedArray(ChunkedArray *arr, size_t index) {
+  if (!arr || index >= arr->size) return NULL;
+  size_t position = arr->head + index;
+  StrictArray *segment = arr->segments[arr->segment_begin + (position >> arr->chunk_shift)];
+  return segment->data + arr->type_size * (position & (((size_t)1 << arr->chunk_shift) - 1));
+}
+
+/**
+ * @fn int next_chunk_ChunkedArray(ChunkedArray *arr, size_t *chunk, void **data, size_t *count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief get the elements of the segment \i `*chunk`
+ *
+ * Start with \i `*chunk` at 0 and call it until it returns 0, the segments
+ * come in order. Elements must not be released meanwhile, but they can be
+ * appended and changed.
+ *
+ * @param[in] arr a pointer to \c `ChunkedArray` type
+ * @param[in, out] chunk the segment to get, set to the next one
+ * (chunk is not a null pointer)
+ * @param[out] data the pointer to the first element of the segment
+ * @param[out] count the number of elements at \i `*data`
+ *
+ * @return 1 if a segment is found, 0 at the end of the array
+ */
+C_DSA_API int next_chunk_ChunkedArray(ChunkedArray *arr, size_t *chunk, void **data, size_t *count) {
+  if (!arr || !chunk || *chunk >= arr->segment_count || !arr->size) return 0;
+  StrictArray *segment = arr->segments[arr->segment_begin + *chunk];
+  size_t skip = *chunk ? 0 : arr->head;
+  if (data) *data = segment->data + arr->type_size * skip;
+  if (count) *count = segment->size - skip;
+  ++*chunk;
+  return 1;
+}
+
+/**
+ * @fn void release_front_ChunkedArray(ChunkedArray *arr, size_t count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove the first \i `count` elements, the segments emptied go back
+ * to the pool
+ *
+ * If \i `count` is greater than \i `size`, all elements are removed. The other
+ * elements keep their address, their indices decrease by \i `count`.
+ */
+C_DSA_API void release_front_ChunkedArray(ChunkedArray *arr, size_t count) {
+  if (!arr) return;
+  if (count >= arr->size) {
+    clear_ChunkedArray(arr);
+    return;
+  }
+  arr->head += count;
+  arr->size -= count;
+  while (arr->head >> arr->chunk_shift) {
+    release_segment_ChunkedArray(arr, arr->segments[arr->segment_begin++]);
+    arr->segment_count--;
+    arr->head -= (size_t)1 << arr->chunk_shift;
+  }
+}
+
+#endif // __C_DSA_GENERIC_CHUNKED_ARRAY_H__
@@ -0,0 +1,284 @@
+/**
+ * @file ConcurrentStrictArray.h
+ * @brief a generic strict array many threads can append to without a lock
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details This library introduces a structure \c `ConcurrentStrictArray`, a
+ * \c `StrictArray` whose appending functions can be called from any number of
+ * threads at the same time.
+ * An append is made of two steps: the slots are reserved by moving the atomic
+ * \i `reserved` counter (a compare-and-swap, so that an append which does not
+ * fit fails with \c `NO_SPACE` and leaves the counter untouched), then the
+ * values are copied without any synchronisation and the slots are committed.
+ * Commits happen in the order of the reservations: a committer waits until
+ * every slot before its own is committed, then moves the atomic \i `size`.
+ * A reader only sees the first \i `size` elements, which are fully written.
+ * Elements cannot be removed, the array is meant to collect results.
+ *
+ * ConcurrentStrictArray's APIs:
+ * @li new_T : dynamically create type T on the heap
+ * @li free_T : deallocate type T
+ * @li reserve_T : reserve slots in type T to write to
+ * @li commit_T : publish reserved slots of type T once they are written
+ * @li push_back_T : insert data to type T on last position
+ * @li append_range_T : insert many data to type T on last positions
+ * @li size_T : the number of elements readers can see in type T
+ * @li get_item_T : get the pointer to a published item on \i `index`
+ */
+#ifndef __C_DSA_GENERIC_CONCURRENT_STRICT_ARRAY_H__
+#define __C_DSA_GENERIC_CONCURRENT_STRICT_ARRAY_H__
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+#endif
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+
+typedef struct ConcurrentStrictArray ConcurrentStrictArray;
+
+/**
+ * @struct ConcurrentStrictArray
+ * @author andarling
+ * @date 14/10/2026
+ * @brief a strict array with atomic reservation and publication counters
+ *
+ * \i `reserved` is the number of slots handed out to appenders and \i `size`
+ * the number of slots committed, both are on their own cache line so that
+ * reserving does not invalidate the line readers poll.
+ */
+struct ConcurrentStrictArray {
+  size_t capacity, type_size;
+  const Allocator *allocator;
+  _Alignas(C_DSA_CACHE_LINE_SIZE) atomic_size_t reserved;
+  _Alignas(C_DSA_CACHE_LINE_SIZE) atomic_size_t size;
+  _Alignas(C_DSA_CACHE_LINE_SIZE) char data[];
+};
+
+/**
+ * @fn Result new_ConcurrentStrictArray(void *data, size_t size, size_t cap, size_t type_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to the allocation
+ *
+ * The array is allocated with \c `aligned_alloc` so that the counters are on
+ * their own cache lines, the first \i `size` elements are copied from \i `data`
+ * and already committed.
+ *
+ * @param[in] data a pointer to an array
+ * (if null pointer then defaults to 0 elements in array)
+ * @param[in] size the size of the \i `data` array
+ * (size >= 0)
+ * @param[in] cap the desired capacity of the returned array
+ * (cap >= size)
+ * @param[in] type_size size of every elements in the array
+ * (type_size > 0)
+ *
+ * @return a \c `Result` type to the successfully allocated data or a error message
+ */
+C_DSA_API Result new_ConcurrentStrictArray(void *data, size_t size, size_t cap, size_t type_size) {
+  if (!data) {
+    size = 0;
+  }
+  if (cap < size) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Size is negative or capacity is less than size\n"
+    };
+  }
+  if (type_size <= 0) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Type cannot have less than 1 byte\n"
+    };
+  }
+  if (cap > ((size_t)-1 - sizeof(ConcurrentStrictArray) - C_DSA_CACHE_LINE_SIZE) / type_size) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Capacity is too big\n"
+    };
+  }
+
+  // aligned_alloc wants a multiple of the alignment
+  size_t bytes = sizeof(ConcurrentStrictArray) + type_size * cap;
+  bytes = (bytes + C_DSA_CACHE_LINE_SIZE - 1) & ~(size_t)(C_DSA_CACHE_LINE_SIZE - 1);
+  ConcurrentStrictArray *result = (ConcurrentStrictArray*)aligned_alloc(_Alignof(ConcurrentStrictArray), bytes);
+  if (!result) {
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+  result->capacity = cap, result->type_size = type_size;
+  // heap_allocator frees with free, which accepts aligned_alloc blocks
+  result->allocator = &heap_allocator;
+  if (size) memcpy(result->data, data, size * type_size);
+  atomic_init(&result->reserved, size);
+  atomic_init(&result->size, size);
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn void free_ConcurrentStrictArray(ConcurrentStrictArray **arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief deallocate the data and set the pointer to NULL
+ *
+ * No other thread may use the array anymore.
+ *
+ * @param[in] arr a pointer to the address of the data
+ * (if arr is a null pointer then exits the function)
+ *
+ * @return void
+ */
+C_DSA_API void free_ConcurrentStrictArray(ConcurrentStrictArray **arr) {
+  if (!arr || !*arr) return;
+  const Allocator *allocator = (*arr)->allocator;
+  if (allocator) allocator->free(allocator->ctx, *arr, sizeof(ConcurrentStrictArray) + (*arr)->type_size * (*arr)->capacity);
+  *arr = NULL;
+}
+
+/**
+ * @fn status_t reserve_ConcurrentStrictArray(ConcurrentStrictArray *arr, size_t count, size_t *index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief reserve \i `count` consecutive slots at the end of the array
+ *
+ * The slots start at \c `arr->data + arr->type_size * *index`, only the caller
+ * writes to them and it must commit them with \c `commit_ConcurrentStrictArray`,
+ * else no later append is ever published.
+ *
+ * @param[in] arr a pointer to \c `ConcurrentStrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] count the number of slots to reserve
+ * @param[out] index the index of the first reserved slot
+ *
+ * @return 0 if success, \c `NO_SPACE` if the slots do not fit (nothing is
+ * reserved) and non-zero if an error occurs
+ */
+C_DSA_API status_t reserve_ConcurrentStrictArray(ConcurrentStrictArray *arr, size_t count, size_t *index) {
+  if (!arr || !index) return SEGFAULT;
+  size_t start = atomic_load_explicit(&arr->reserved, memory_order_relaxed);
+  do {
+    if (count > arr->capacity - start) return NO_SPACE;
+  } while (!atomic_compare_exchange_weak_explicit(&arr->reserved, &start, start + count,
+                                                  memory_order_relaxed, memory_order_relaxed));
+  *index = start;
+  return NO_ERROR;
+}
+
+/**
+ * @fn void commit_ConcurrentStrictArray(ConcurrentStrictArray *arr, size_t index, size_t count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief publish \i `count` written slots starting at \i `index`
+ *
+ * Waits until every slot before \i `index` is committed, so the published
+ * elements are always a prefix of the array. The wait spins for a while, then
+ * yields the processor, in case the thread it waits for is not running.
+ *
+ * @param[in] arr a pointer to \c `ConcurrentStrictArray` type
+ * (if arr is a null pointer then exits the function)
+ * @param[in] index the index returned by \c `reserve_ConcurrentStrictArray`
+ * @param[in] count the number of slots reserved
+ *
+ * @return void
+ */
+C_DSA_API void commit_ConcurrentStrictArray(ConcurrentStrictArray *arr, size_t index, size_t count) {
+  if (!arr) return;
+  for (unsigned spins = 0; atomic_load_explicit(&arr->size, memory_order_acquire) != index; spins++) {
+    // an earlier appender is still copying
+#ifndef __STDC_NO_THREADS__
+    if (spins >= 64) thrd_yield();
+#endif
+  }
+  atomic_store_explicit(&arr->size, index + count, memory_order_release);
+}
+
+/**
+ * @fn status_t push_back_ConcurrentStrictArray(ConcurrentStrictArray *arr, void *value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert \i `value` to the end of the array
+ *
+ * @param[in] arr a pointer to \c `ConcurrentStrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] value a pointer to the value to insert
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t push_back_ConcurrentStrictArray(ConcurrentStrictArray *arr, void *value) {
+  if (!arr || !value) return SEGFAULT;
+  size_t index;
+  status_t status = reserve_ConcurrentStrictArray(arr, 1, &index);
+  if (status) return status;
+  memcpy(arr->data + arr->type_size * index, value, arr->type_size);
+  commit_ConcurrentStrictArray(arr, index, 1);
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t append_range_ConcurrentStrictArray(ConcurrentStrictArray *arr, void *src, size_t count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert \i `count` elements from \i `src` to the end of the array
+ *
+ * The elements are reserved at once and stay consecutive, if there is not
+ * enough space nothing is inserted.
+ *
+ * @param[in] arr a pointer to \c `ConcurrentStrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] src a pointer to the elements to insert
+ * (if src is a null pointer then an error of invalid instance is returned)
+ * @param[in] count the number of elements in \i `src`
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t append_range_ConcurrentStrictArray(ConcurrentStrictArray *arr, void *src, size_t count) {
+  if (!arr || (!src && count)) return SEGFAULT;
+  if (!count) return NO_ERROR;
+  size_t index;
+  status_t status = reserve_ConcurrentStrictArray(arr, count, &index);
+  if (status) return status;
+  memcpy(arr->data + arr->type_size * index, src, arr->type_size * count);
+  commit_ConcurrentStrictArray(arr, index, count);
+  return NO_ERROR;
+}
+
+/**
+ * @fn size_t size_ConcurrentStrictArray(ConcurrentStrictArray *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the number of committed elements, which are safe to read
+ */
+C_DSA_API size_t size_ConcurrentStrictArray(ConcurrentStrictArray *arr) {
+  if (!arr) return 0;
+  return atomic_load_explicit(&arr->size, memory_order_acquire);
+}
+
+/**
+ * @fn void *get_item_ConcurrentStrictArray(ConcurrentStrictArray *arr, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the desired elements
+ *
+ * This function returns a pointer to the desired elements, if it is not
+ * committed yet (outside of [0, \c `size` - 1]), the output is a null pointer
+ */
+C_DSA_API void *get_item_ConcurrentStrictArray(ConcurrentStrictArray *arr, size_t index) {
+  if (!arr || index >= atomic_load_explicit(&arr->size, memory_order_acquire)) {
+    return NULL;
+  }
+  return arr->data + arr->type_size * index;
+}
+
+#endif // __C_DSA_GENERIC_CONCURRENT_STRICT_ARRAY_H__
@@ -0,0 +1,375 @@
+/**
+ * @file Deque.h
+ * @brief a generic double-ended queue header made of fixed-size chunks
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details This library introduces a structure \c `Deque`, a growable sequence
+ * of \b `any types` with O(1) insertion and removal at both ends.
+ * The elements live in chunks of \c `C_DSA_DEQUE_CHUNK_BYTES` bytes (rounded to
+ * a power of two elements, at least one) and \i `map` holds the pointers to the
+ * chunks. Element \i `i` is at the absolute position \i `begin` + \i `i`, that is
+ * in chunk \i `position >> chunk_shift` at offset \i `position & mask`, so an
+ * access is a shift, a mask and two loads.
+ * Only the chunks covering the elements are allocated, plus one spare chunk
+ * kept aside so a queue going back and forth over a chunk boundary does not
+ * hit the allocator. When an end runs out of map, the chunk pointers are
+ * re-centred (and the map doubled if it is more than half full): elements never
+ * move, so pointers to them stay valid until they are popped.
+ *
+ * Deque's APIs:
+ * @li new_T : dynamically create an empty type T on the heap
+ * @li new_T_with_allocator : dynamically create type T with an \c `Allocator`
+ * @li free_T : deallocate type T
+ * @li push_back_T, push_front_T : insert an element at an end of T
+ * @li pop_back_T, pop_front_T : remove the element at an end of T
+ * @li front_T, back_T : get the pointer to the element at an end of T
+ * @li get_item_T : get the pointer to an element of T
+ * @li clear_T : remove all elements of T
+ */
+#ifndef __C_DSA_GENERIC_DEQUE_H__
+#define __C_DSA_GENERIC_DEQUE_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+
+#ifndef C_DSA_DEQUE_CHUNK_BYTES
+#define C_DSA_DEQUE_CHUNK_BYTES 4096
+#endif
+
+#define C_DSA_DEQUE_MIN_MAP 8
+
+typedef struct Deque Deque;
+
+/**
+ * @struct Deque
+ * @author andarling
+ * @date 14/10/2026
+ * @brief a double-ended queue of chunks holding \i `1 << chunk_shift` elements
+ *
+ * The elements are at the positions [\i `begin`, \i `begin` + \i `size`), the
+ * chunks of \i `map` outside of them are null pointers. \i `spare` is a free
+ * chunk or a null pointer.
+ */
+struct Deque {
+  size_t size, type_size, begin, chunk_shift, map_capacity;
+  const Allocator *allocator;
+  char **map;
+  char *spare;
+};
+
+// the number of bytes of a chunk
+C_DSA_API size_t chunk_bytes_Deque(const Deque *deque) {
+  return deque->type_size << deque->chunk_shift;
+}
+
+C_DSA_API char *acquire_chunk_Deque(Deque *deque) {
+  char *chunk = deque->spare;
+  if (chunk) {
+    deque->spare = NULL;
+    return chunk;
+  }
+  return (char*)deque->allocator->alloc(deque->allocator->ctx, chunk_bytes_Deque(deque));
+}
+
+C_DSA_API void release_chunk_Deque(Deque *deque, char *chunk) {
+  if (!deque->spare) {
+    deque->spare = chunk;
+    return;
+  }
+  deque->allocator->free(deque->allocator->ctx, chunk, chunk_bytes_Deque(deque));
+}
+
+/**
+ * @brief moves the chunk pointers to the middle of the map, doubling it while
+ * less than two free entries would be left on each side of the used ones
+ */
+C_DSA_API status_t recenter_Deque(Deque *deque) {
+  size_t first = deque->begin >> deque->chunk_shift;
+  size_t used = deque->size ? ((deque->begin + deque->size - 1) >> deque->chunk_shift) - first + 1 : 0;
+  size_t cap = deque->map_capacity;
+  while (cap < 2 * used + 2) {
+    if (cap > SIZE_MAX / 2 / sizeof(char*)) return HEAP_FAILURE;
+    cap *= 2;
+  }
+
+  char **map = deque->map;
+  if (cap != deque->map_capacity) {
+    map = (char**)deque->allocator->alloc(deque->allocator->ctx, cap * sizeof(char*));
+    if (!map) return HEAP_FAILURE;
+  }
+  size_t target = (cap - used) / 2;
+  char **chunks = deque->map + first;
+  if (map != deque->map) {
+    memcpy(map + target, chunks, used * sizeof(char*));
+    deque->allocator->free(deque->allocator->ctx, deque->map, deque->map_capacity * sizeof(char*));
+  } else {
+    memmove(map + target, chunks, used * sizeof(char*));
+  }
+  memset(map, 0, target * sizeof(char*));
+  memset(map + target + used, 0, (cap - target - used) * sizeof(char*));
+
+  deque->map = map;
+  deque->map_capacity = cap;
+  deque->begin = (target << deque->chunk_shift) + (deque->begin & (((size_t)1 << deque->chunk_shift) - 1));
+  return NO_ERROR;
+}
+
+/**
+ * @fn Result new_Deque_with_allocator(size_t type_size, const Allocator *allocator)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to an empty deque allocated by \i `allocator`
+ *
+ * No chunk is allocated until the first insertion.
+ *
+ * @param[in] type_size size of every elements in the deque
+ * (type_size > 0)
+ * @param[in] allocator the allocator to use, it must outlive the deque
+ * (allocator is not a null pointer)
+ *
+ * @return a \c `Result` type to the successfully allocated deque or a error message
+ */
+C_DSA_API Result new_Deque_with_allocator(size_t type_size, const Allocator *allocator) {
+  if (!allocator) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  if (!type_size) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: type_size must be positive\n"
+    };
+  }
+  Deque *result = (Deque*)allocator->alloc(allocator->ctx, sizeof(Deque));
+  char **map = (char**)allocator->alloc(allocator->ctx, C_DSA_DEQUE_MIN_MAP * sizeof(char*));
+  if (!result || !map) {
+    if (result) allocator->free(allocator->ctx, result, sizeof(Deque));
+    if (map) allocator->free(allocator->ctx, map, C_DSA_DEQUE_MIN_MAP * sizeof(char*));
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+  size_t shift = 0;
+  while ((type_size << (shift + 1)) <= C_DSA_DEQUE_CHUNK_BYTES) shift++;
+  memset(map, 0, C_DSA_DEQUE_MIN_MAP * sizeof(char*));
+  *result = (Deque) {
+    .size = 0,
+    .type_size = type_size,
+    .begin = (C_DSA_DEQUE_MIN_MAP / 2) << shift,
+    .chunk_shift = shift,
+    .map_capacity = C_DSA_DEQUE_MIN_MAP,
+    .allocator = allocator,
+    .map = map,
+    .spare = NULL
+  };
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn Result new_Deque(size_t type_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `new_Deque_with_allocator` on the heap
+ */
+C_DSA_API Result new_Deque(size_t type_size) {
+  return new_Deque_with_allocator(type_size, &heap_allocator);
+}
+
+/**
+ * @fn void clear_Deque(Deque *deque)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove all elements, deallocating every chunk but the spare one
+ */
+C_DSA_API void clear_Deque(Deque *deque) {
+  if (!deque) return;
+  if (deque->size) {
+    size_t first = deque->begin >> deque->chunk_shift;
+    size_t last = (deque->begin + deque->size - 1) >> deque->chunk_shift;
+    for (size_t i = first; i <= last; ++i) {
+      release_chunk_Deque(deque, deque->map[i]);
+      deque->map[i] = NULL;
+    }
+  }
+  deque->size = 0;
+  deque->begin = (deque->map_capacity / 2) << deque->chunk_shift;
+}
+
+/**
+ * @fn void free_Deque(Deque **deque)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief deallocate the deque and its chunks and set the pointer to NULL
+ */
+C_DSA_API void free_Deque(Deque **deque) {
+  if (!deque || !(*deque)) return;
+  Deque *to_delete = *deque;
+  const Allocator *allocator = to_delete->allocator;
+  clear_Deque(to_delete);
+  if (to_delete->spare) allocator->free(allocator->ctx, to_delete->spare, chunk_bytes_Deque(to_delete));
+  allocator->free(allocator->ctx, to_delete->map, to_delete->map_capacity * sizeof(char*));
+  allocator->free(allocator->ctx, to_delete, sizeof(Deque));
+  *deque = NULL;
+}
+
+/**
+ * @fn status_t push_back_Deque(Deque *deque, void *value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert \i `value` at the end of the deque
+ *
+ * @param[in] deque a pointer to \c `Deque` type
+ * (if deque is a null pointer then an error of invalid instance is returned)
+ * @param[in] value a pointer to the element to copy
+ *
+ * @return 0 if success, \c `HEAP_FAILURE` if a chunk or the map cannot be
+ * allocated, in which case the deque is unchanged
+ */
+C_DSA_API status_t push_back_Deque(Deque *deque, void *value) {
+  if (!deque || !value) return SEGFAULT;
+  size_t mask = ((size_t)1 << deque->chunk_shift) - 1;
+  size_t position = deque->begin + deque->size;
+  if (!deque->size || !(position & mask)) {
+    if ((position >> deque->chunk_shift) >= deque->map_capacity) {
+      status_t status = recenter_Deque(deque);
+      if (status != NO_ERROR) return status;
+      position = deque->begin + deque->size;
+    }
+    char *chunk = acquire_chunk_Deque(deque);
+    if (!chunk) return HEAP_FAILURE;
+    deque->map[position >> deque->chunk_shift] = chunk;
+  }
+  memcpy(deque->map[position >> deque->chunk_shift] + deque->type_size * (position & mask),
+         value, deque->type_size);
+  deque->size++;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t push_front_Deque(Deque *deque, void *value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert \i `value` at the beginning of the deque
+ *
+ * @return the same as \c `push_back_Deque`
+ */
+C_DSA_API status_t push_front_Deque(Deque *deque, void *value) {
+  if (!deque || !value) return SEGFAULT;
+  size_t mask = ((size_t)1 << deque->chunk_shift) - 1;
+  if (!deque->size || !(deque->begin & mask)) {
+    if (!deque->begin) {
+      status_t status = recenter_Deque(deque);
+      if (status != NO_ERROR) return status;
+    }
+    char *chunk = acquire_chunk_Deque(deque);
+    if (!chunk) return HEAP_FAILURE;
+    deque->map[(deque->begin - 1) >> deque->chunk_shift] = chunk;
+  }
+  size_t position = --deque->begin;
+  memcpy(deque->map[position >> deque->chunk_shift] + deque->type_size * (position & mask),
+         value, deque->type_size);
+  deque->size++;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t pop_back_Deque(Deque *deque, void *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove the last element of the deque
+ *
+ * @param[in] deque a pointer to \c `Deque` type
+ * (if deque is a null pointer then an error of invalid instance is returned)
+ * @param[out] out a pointer to room for one element
+ * (if null pointer then the element is dropped)
+ *
+ * @return 0 if success, \c `EMPTY_CONTAINER` if the deque is empty
+ */
+C_DSA_API status_t pop_back_Deque(Deque *deque, void *out) {
+  if (!deque) return SEGFAULT;
+  if (!deque->size) return EMPTY_CONTAINER;
+  size_t mask = ((size_t)1 << deque->chunk_shift) - 1;
+  size_t position = deque->begin + --deque->size;
+  char *chunk = deque->map[position >> deque->chunk_shift];
+  if (out) memcpy(out, chunk + deque->type_size * (position & mask), deque->type_size);
+  if (!deque->size || !(position & mask)) {
+    release_chunk_Deque(deque, chunk);
+    deque->map[position >> deque->chunk_shift] = NULL;
+  }
+  if (!deque->size) deque->begin = (deque->map_capacity / 2) << deque->chunk_shift;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t pop_front_Deque(Deque *deque, void *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove the first element of the deque
+ *
+ * @return the same as \c `pop_back_Deque`
+ */
+C_DSA_API status_t pop_front_Deque(Deque *deque, void *out) {
+  if (!deque) return SEGFAULT;
+  if (!deque->size) return EMPTY_CONTAINER;
+  size_t mask = ((size_t)1 << deque->chunk_shift) - 1;
+  size_t position = deque->begin++;
+  char *chunk = deque->map[position >> deque->chunk_shift];
+  if (out) memcpy(out, chunk + deque->type_size * (position & mask), deque->type_size);
+  deque->size--;
+  if (!deque->size || !(deque->begin & mask)) {
+    release_chunk_Deque(deque, chunk);
+    deque->map[position >> deque->chunk_shift] = NULL;
+  }
+  if (!deque->size) deque->begin = (deque->map_capacity / 2) << deque->chunk_shift;
+  return NO_ERROR;
+}
+
+/**
+ * @fn void *get_item_Deque(Deque *deque, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the \i `index`-th element from the front, or a
+ * null pointer if it is out of [0, \c `size` - 1]
+ */
+C_DSA_API void *get_item_Deque(Deque *deque, size_t index) {
+  if (!deque || index >= deque->size) return NULL;
+  size_t position = deque->begin + index;
+  return deque->map[position >> deque->chunk_shift]
+       + deque->type_size * (position & (((size_t)1 << deque->chunk_shift) - 1));
+}
+
+/**
+ * @fn void *front_Deque(Deque *deque)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief get the pointer to the first element, or a null pointer if empty
+ */
+C_DSA_API void *front_Deque(Deque *deque) {
+  return get_item_Deque(deque, 0);
+}
+
+/**
+ * @fn void *back_Deque(Deque *deque)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief get the pointer to the last element, or a null pointer if empty
+ */
+C_DSA_API void *back_Deque(Deque *deque) {
+  if (!deque || !deque->size) return NULL;
+  return get_item_Deque(deque, deque->size - 1);
+}
+
+#endif // __C_DSA_GENERIC_DEQUE_H__
@@ -0,0 +1,497 @@
+/**
+ * @file DynamicArray.h
+ * @brief a generic growable array header
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details This library introduces a structure \c `DynamicArray` that behaves the
+ * same as \c `StrictArray` but is no longer bounded by its \i `capacity`: once
+ * \i `size` reach \i `capacity` the block is grown geometrically by
+ * \i `growth_factor`, which gives amortized O(1) append.
+ * The header and the elements live in one block, so growing is done with
+ * \c `realloc` and does not copy when the allocator can extend the block in place.
+ * As the block may move, every function that may grow the array takes a pointer
+ * to the \c `DynamicArray` pointer and updates it.
+ *
+ * DynamicArray's APIs:
+ * @li new_T : dynamically create type T on the heap
+ * @li new_T_with_allocator : dynamically create type T with an \c `Allocator`
+ * @li create_T, create_T_with_allocator : the same as \c `new_T` and
+ * \c `new_T_with_allocator`, returning a status code and the array through an
+ * out-parameter
+ * @li from_T : dynamically clone type T on the heap of the same type
+ * @li create_from_T : the same as \c `from_T` through an out-parameter
+ * @li free_T : deallocate type T
+ * @li push_back_T : insert data to type T on last position, growing if needed
+ * @li pop_back_T : remove last element in type T
+ * @li get_item_T : get the pointer to item on \i `index`
+ * @li at_unchecked_T : get the pointer to item on \i `index` without checks
+ * @li data_ptr_T, begin_T, end_T : get the pointers to the elements' range
+ * @li FOREACH_T : iterate over the elements
+ * @li clear_T : reset the data in T
+ * @li reserve_T : make sure T can hold at least \i `cap` elements
+ * @li shrink_to_fit_T : release the unused capacity of T
+ * @li set_growth_factor_T : change how fast T grows
+ */
+#ifndef __C_DSA_GENERIC_DYNAMIC_ARRAY_H__
+#define __C_DSA_GENERIC_DYNAMIC_ARRAY_H__
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+#include "../utils/instrument.h"
+#include "../utils/checked.h"
+
+/**
+ * @brief the default growth factor of every newly created dynamic array
+ *
+ * It can be overriden by defining it before including this header.
+ */
+#ifndef C_DSA_DYNAMIC_ARRAY_GROWTH_FACTOR
+#define C_DSA_DYNAMIC_ARRAY_GROWTH_FACTOR 2.0
+#endif
+
+typedef struct DynamicArray DynamicArray;
+
+/**
+ * @struct DynamicArray
+ * @author andarling
+ * @date 14/10/2026
+ * @brief a structure represent a growable C-array
+ *
+ * The same layout as \c `StrictArray` with an additional \i `growth_factor`,
+ * the new capacity on growth is \i `capacity` * \i `growth_factor`.
+ * The \i `allocator` which allocated the array is kept to grow and deallocate it.
+ */
+struct DynamicArray {
+  size_t size, capacity, type_size;
+  double growth_factor;
+  const Allocator *allocator;
+  char data[];
+};
+
+/**
+ * @fn status_t create_DynamicArray_with_allocator(DynamicArray **out, void *data, size_t size, size_t cap, size_t type_size, const Allocator *allocator)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief allocate a \c `DynamicArray` through \i `allocator` into \i `*out`
+ *
+ * The same as \c `new_DynamicArray_with_allocator`, but the array is returned
+ * through \i `out` and only a status code is returned, so creating an array
+ * costs no \c `Result` copy nor unpack. \i `*out` is a null pointer on error.
+ *
+ * @param[out] out where the address of the array is written
+ * (out is not a null pointer)
+ * @param[in] allocator the allocator to use, it must outlive the array
+ * (allocator is not a null pointer)
+ *
+ * @return \c `NO_ERROR`, \c `SEGFAULT` for a null \i `out` or \i `allocator`,
+ * \c `INVALID_SIZE` for invalid sizes or \c `HEAP_FAILURE`
+ */
+C_DSA_API status_t create_DynamicArray_with_allocator(DynamicArray **out, void *data, size_t size, size_t cap,
+                                            size_t type_size, const Allocator *allocator) {
+  if (C_DSA_UNLIKELY(!out)) return SEGFAULT;
+  *out = NULL;
+  if (!data) {
+    size = 0;
+  }
+  if (C_DSA_UNLIKELY(!allocator)) return SEGFAULT;
+  if (C_DSA_UNLIKELY(cap < size || type_size <= 0)) return INVALID_SIZE;
+  size_t bytes;
+  if (C_DSA_UNLIKELY(checked_bytes(sizeof(DynamicArray), cap, type_size, &bytes))) return INVALID_SIZE;
+
+  DynamicArray *result = (DynamicArray*)allocator->alloc(allocator->ctx, bytes);
+  if (C_DSA_UNLIKELY(!result)) return HEAP_FAILURE;
+  result->size = size, result->capacity = cap, result->type_size = type_size;
+  result->growth_factor = C_DSA_DYNAMIC_ARRAY_GROWTH_FACTOR;
+  result->allocator = allocator;
+  if (size) memcpy(result->data, data, size * type_size);
+  C_DSA_COUNT_ALLOC(C_DSA_DYNAMIC_ARRAY, bytes);
+  *out = result;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t create_DynamicArray(DynamicArray **out, void *data, size_t size, size_t cap, size_t type_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `create_DynamicArray_with_allocator` on the heap
+ */
+C_DSA_API status_t create_DynamicArray(DynamicArray **out, void *data, size_t size, size_t cap,
+                             size_t type_size) {
+  return create_DynamicArray_with_allocator(out, data, size, cap, type_size, &heap_allocator);
+}
+
+/**
+ * @fn Result new_DynamicArray_with_allocator(void *data, size_t size, size_t cap, size_t type_size, const Allocator *allocator)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to the allocation made by \i `allocator`
+ *
+ * The same as \c `new_DynamicArray`, but the array is allocated, grown and
+ * deallocated through \i `allocator`.
+ * It wraps \c `create_DynamicArray_with_allocator`, which is cheaper when the
+ * error message is not needed.
+ *
+ * @param[in] allocator the allocator to use, it must outlive the array
+ * (allocator is not a null pointer)
+ *
+ * @return a \c `Result` type to the successfully allocated data or a error message
+ */
+C_DSA_API Result new_DynamicArray_with_allocator(void *data, size_t size, size_t cap, size_t type_size,
+                                       const Allocator *allocator) {
+  DynamicArray *result;
+  status_t status = create_DynamicArray_with_allocator(&result, data, size, cap, type_size, allocator);
+  if (C_DSA_LIKELY(status == NO_ERROR)) {
+    return (Result) {
+      .ok = NO_ERROR,
+      .data = result
+    };
+  }
+  const char *error_msg = status == SEGFAULT ? "ValueError: cannot access a null pointer\n"
+                        : status == HEAP_FAILURE ? "AllocationError: Not enough memory in the heap"
+                        : data && cap < size ? "SizeError: Size is negative or capacity is less than size\n"
+                        : type_size <= 0 ? "SizeError: Type cannot have less than 1 byte\n"
+                        : "SizeError: Capacity is too big\n";
+  return (Result) {
+    .ok = status,
+    .error_msg = error_msg
+  };
+}
+
+/**
+ * @fn Result new_DynamicArray(void *data, size_t size, size_t cap, size_t type_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to the allocation
+ *
+ * @param[in] data a pointer to an array
+ * (if null pointer then defaults to 0 elements in array)
+ * @param[in] size the size of the \i `data` array
+ * (size >= 0)
+ * @param[in] cap the initial capacity of the returned \c `DynamicArray`
+ * (cap >= size)
+ * @param[in] type_size size of every elements in the array
+ * (type_size > 0)
+ *
+ * @return a \c `Result` type to the successfully allocated data or a error message
+ */
+C_DSA_API Result new_DynamicArray(void *data, size_t size, size_t cap, size_t type_size) {
+  return new_DynamicArray_with_allocator(data, size, cap, type_size, &heap_allocator);
+}
+
+/**
+ * @fn Result from_DynamicArray(DynamicArray *from)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief creates a copy of an existed \c `DynamicArray`
+ *
+ * The copy keeps the capacity, the growth factor and the allocator of \i `from`.
+ *
+ * @param[in] from an existed \c `DynamicArray` instance
+ * (from is not a null pointer)
+ *
+ * @return the \c `Result` type of the successfully allocated data or an error message
+ */
+C_DSA_API Result from_DynamicArray(DynamicArray *from) {
+  if (!from) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+
+  Result result = new_DynamicArray_with_allocator(from->data, from->size, from->capacity,
+                                                  from->type_size, from->allocator);
+  if (result.ok == NO_ERROR) {
+    C_DSA_COUNT_CLONE(C_DSA_DYNAMIC_ARRAY, from->type_size * from->size);
+    ((DynamicArray*)result.data)->growth_factor = from->growth_factor;
+  }
+  return result;
+}
+
+/**
+ * @fn status_t create_from_DynamicArray(DynamicArray **out, const DynamicArray *from)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `from_DynamicArray`, returning the copy through \i `out`
+ *
+ * @param[out] out where the address of the copy is written, a null pointer on error
+ * (out is not a null pointer)
+ * @param[in] from an existed \c `DynamicArray` instance
+ * (from is not a null pointer)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t create_from_DynamicArray(DynamicArray **out, const DynamicArray *from) {
+  if (C_DSA_UNLIKELY(!out)) return SEGFAULT;
+  if (C_DSA_UNLIKELY(!from)) {
+    *out = NULL;
+    return SEGFAULT;
+  }
+
+  status_t status = create_DynamicArray_with_allocator(out, (void*)from->data, from->size, from->capacity,
+                                                       from->type_size, from->allocator);
+  if (status == NO_ERROR) {
+    (*out)->growth_factor = from->growth_factor;
+    C_DSA_COUNT_CLONE(C_DSA_DYNAMIC_ARRAY, from->type_size * from->size);
+  }
+  return status;
+}
+
+/**
+ * @fn void free_DynamicArray(DynamicArray **arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief deallocate the data and set the pointer to NULL
+ *
+ * @param[in] arr a pointer to the address of the data
+ * (if arr is a null pointer then exits the function)
+ *
+ * @return void
+ */
+C_DSA_API void free_DynamicArray(DynamicArray **arr) {
+  if (!arr || !*arr) return;
+  const Allocator *allocator = (*arr)->allocator;
+  size_t bytes = sizeof(DynamicArray) + (*arr)->type_size * (*arr)->capacity;
+  C_DSA_COUNT_FREE(C_DSA_DYNAMIC_ARRAY, bytes);
+  allocator->free(allocator->ctx, *arr, bytes);
+  *arr = NULL;
+}
+
+/**
+ * @fn status_t reserve_DynamicArray(DynamicArray **arr, size_t cap)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief make sure the array can hold at least \i `cap` elements
+ *
+ * The block is resized with the \i `realloc` of the array's allocator, if the
+ * allocation fails the array is left untouched.
+ *
+ * @param[in, out] arr a pointer to the address of the data
+ * (updated if the block is moved)
+ * @param[in] cap the minimum capacity required
+ *
+ * @return 0 if success, \c `INVALID_SIZE` if the bytes of \i `cap` elements do
+ * not fit in a \c `size_t` and non-zero if another error occurs
+ */
+C_DSA_API status_t reserve_DynamicArray(DynamicArray **arr, size_t cap) {
+  if (!arr || !*arr) return SEGFAULT;
+  if (cap <= (*arr)->capacity) return NO_ERROR;
+
+  const Allocator *allocator = (*arr)->allocator;
+  size_t bytes = sizeof(DynamicArray) + (*arr)->type_size * (*arr)->capacity, grown_bytes;
+  if (checked_bytes(sizeof(DynamicArray), cap, (*arr)->type_size, &grown_bytes)) return INVALID_SIZE;
+  DynamicArray *grown = (DynamicArray*)allocator->realloc(allocator->ctx, *arr, bytes, grown_bytes);
+  if (!grown) return HEAP_FAILURE;
+  C_DSA_COUNT_RESIZE(C_DSA_DYNAMIC_ARRAY, bytes, grown_bytes);
+  grown->capacity = cap;
+  *arr = grown;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t shrink_to_fit_DynamicArray(DynamicArray **arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief reduce the capacity of the array to its size
+ *
+ * @param[in, out] arr a pointer to the address of the data
+ * (updated if the block is moved)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t shrink_to_fit_DynamicArray(DynamicArray **arr) {
+  if (!arr || !*arr) return SEGFAULT;
+  if ((*arr)->size == (*arr)->capacity) return NO_ERROR;
+
+  const Allocator *allocator = (*arr)->allocator;
+  size_t bytes = sizeof(DynamicArray) + (*arr)->type_size * (*arr)->capacity;
+  DynamicArray *shrunk = (DynamicArray*)allocator->realloc(allocator->ctx, *arr, bytes,
+                                                           sizeof(DynamicArray) + (*arr)->type_size * (*arr)->size);
+  if (!shrunk) return HEAP_FAILURE;
+  C_DSA_COUNT_RESIZE(C_DSA_DYNAMIC_ARRAY, bytes, sizeof(DynamicArray) + shrunk->type_size * shrunk->size);
+  shrunk->capacity = shrunk->size;
+  *arr = shrunk;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t set_growth_factor_DynamicArray(DynamicArray *arr, double factor)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief change the factor the capacity is multiplied by on every growth
+ *
+ * @param[in] arr a pointer to \c `DynamicArray` type
+ * @param[in] factor the new growth factor
+ * (factor > 1)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t set_growth_factor_DynamicArray(DynamicArray *arr, double factor) {
+  if (!arr) return SEGFAULT;
+  if (!(factor > 1.0)) return INVALID_SIZE;
+  arr->growth_factor = factor;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t push_back_DynamicArray(DynamicArray **arr, void *value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert \i `value` to the end of the array, growing it if it is full
+ *
+ * \i `value` may point to an element of the array itself.
+ *
+ * @param[in, out] arr a pointer to the address of the data
+ * (updated if the block is moved)
+ * @param[in] value a pointer to the value to insert
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t push_back_DynamicArray(DynamicArray **arr, void *value) {
+  if (!arr || !*arr) return SEGFAULT;
+  DynamicArray *self = *arr;
+  size_t size = self->size, type_size = self->type_size;
+
+  if (size == self->capacity) {
+    // a capacity beyond SIZE_MAX is clamped, reserve_DynamicArray rejects it
+    double scaled = (double)self->capacity * self->growth_factor;
+    size_t cap = scaled < (double)SIZE_MAX ? (size_t)scaled : SIZE_MAX;
+    if (cap <= self->capacity) cap = self->capacity + 1;
+
+    // value may be an element of the array, which moves with the block
+    char *from = (char*)value;
+    int inside = from >= self->data && from < self->data + size * type_size;
+    size_t offset = inside ? (size_t)(from - self->data) : 0;
+
+    status_t status = reserve_DynamicArray(arr, cap);
+    if (status != NO_ERROR) {
+      C_DSA_COUNT_FAILED_PUSH(C_DSA_DYNAMIC_ARRAY);
+      return status;
+    }
+    self = *arr;
+    if (inside) value = self->data + offset;
+  }
+  memcpy(self->data + type_size * size, value, type_size);
+  self->size++;
+  C_DSA_COUNT_PUSH(C_DSA_DYNAMIC_ARRAY, 1);
+  return NO_ERROR;
+}
+
+/**
+ * @fn void pop_back_DynamicArray(DynamicArray *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove the last elements in \c `DynamicArray`
+ *
+ * The capacity is kept, use \c `shrink_to_fit_DynamicArray` to release it.
+ *
+ * @param[in] arr a pointer to \c `DynamicArray` type
+ * (if arr is a null pointer then exits the function)
+ *
+ * @return void
+ */
+C_DSA_API void pop_back_DynamicArray(DynamicArray *arr) {
+  if (!arr) return;
+  if (arr->size) {
+    arr->size--;
+    C_DSA_COUNT_POP(C_DSA_DYNAMIC_ARRAY, 1);
+  }
+}
+
+/**
+ * @fn void clear_DynamicArray(DynamicArray *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove all elements in array
+ *
+ * @param[in] arr a pointer to \c `DynamicArray` type
+ * (if arr is a null pointer then exits the function)
+ *
+ * @return void
+ */
+C_DSA_API void clear_DynamicArray(DynamicArray *arr) {
+  if (!arr) return;
+  arr->size = 0;
+}
+
+/**
+ * @fn void *get_item_DynamicArray(DynamicArray *arr, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the desired elements
+ *
+ * The pointer is invalidated by any function that may grow or shrink the array.
+ *
+ * @return a pointer to the \i `index`-th element, if it is out-of-bound
+ * (outside of [0, \c `size` - 1]), the output is a null pointer
+ */
+C_DSA_API void *get_item_DynamicArray(DynamicArray *arr, size_t index) {
+  if (!arr || index >= arr->size) return NULL;
+  return arr->data + arr->type_size * index;
+}
+
+/**
+ * @fn static inline void *at_unchecked_DynamicArray(DynamicArray *arr, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the \i `index`-th element without any check
+ *
+ * The fast path of \c `get_item_DynamicArray` for tight loops, \i `arr` must not be
+ * a null pointer and \i `index` must be in [0, \i `size` - 1].
+ * The pointer is invalidated by any function that may grow or shrink the array.
+ */
+static inline void *at_unchecked_DynamicArray(DynamicArray *arr, size_t index) {
+  return arr->data + arr->type_size * index;
+}
+
+/**
+ * @fn static inline void *data_ptr_DynamicArray(DynamicArray *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the first element, \i `arr` must not be a null pointer
+ */
+static inline void *data_ptr_DynamicArray(DynamicArray *arr) {
+  return arr->data;
+}
+
+/**
+ * @fn static inline void *begin_DynamicArray(DynamicArray *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the first element, \i `arr` must not be a null pointer
+ */
+static inline void *begin_DynamicArray(DynamicArray *arr) {
+  return arr->data;
+}
+
+/**
+ * @fn static inline void *end_DynamicArray(DynamicArray *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer past the last element, \i `arr` must not be a null pointer
+ */
+static inline void *end_DynamicArray(DynamicArray *arr) {
+  return arr->data + arr->type_size * arr->size;
+}
+
+/**
+ * @def FOREACH_DynamicArray(arr, T, it)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief iterate \i `it` (a \i `T` pointer) over the elements of \i `arr`
+ *
+ * The base pointer and the end are computed once, so every step is a pointer
+ * increment. \i `T` must be the element type (\c `sizeof(T)` == \i `type_size`),
+ * with the type specialised arrays it can be used as is, e.g.
+ * \c `FOREACH_DynamicArray(arr_int, int, it) { *it = 0; }`.
+ */
+#define FOREACH_DynamicArray(arr, T, it) \
+  for (T *it = (T*)(arr)->data, *it##_end = it + (arr)->size; it != it##_end; ++it)
+
+#endif // __C_DSA_GENERIC_DYNAMIC_ARRAY_H__
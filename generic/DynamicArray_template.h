@@ -0,0 +1,247 @@
+/**
+ * @file DynamicArray_template.h
+ * @brief a generator for type specialised growable arrays
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details \c `DEFINE_DYNAMIC_ARRAY(T, suffix)` emits a structure
+ * \c `DynamicArray_suffix` holding elements of type \i `T` and the same APIs as
+ * the generic \c `DynamicArray`, with \c `sizeof(T)` known at compile time.
+ *
+ * Generated APIs (S stands for \c `DynamicArray_suffix`):
+ * @li Result new_S(T *data, size_t size, size_t cap) : create S on the heap
+ * @li Result new_S_with_allocator(T *data, size_t size, size_t cap,
+ * const Allocator *allocator) : create S through \i `allocator`
+ * @li status_t create_S(S **out, T *data, size_t size, size_t cap),
+ * status_t create_S_with_allocator(S **out, T *data, size_t size, size_t cap,
+ * const Allocator *allocator) : the same as \i `new_S` and \i `new_S_with_allocator`,
+ * returning a status code and S through \i `out`
+ * @li Result from_S(S *from) : clone S, keeping its growth factor and allocator
+ * @li status_t create_from_S(S **out, const S *from) : the same as \i `from_S`
+ * through \i `out`
+ * @li void free_S(S **arr) : deallocate S and set the pointer to NULL
+ * @li status_t reserve_S(S **arr, size_t cap) : grow S to at least \i `cap`
+ * @li status_t shrink_to_fit_S(S **arr) : reduce the capacity of S to its size
+ * @li status_t set_growth_factor_S(S *arr, double factor) : change the growth
+ * factor (factor > 1)
+ * @li status_t push_back_S(S **arr, T value) : insert \i `value` on last
+ * position, growing if needed
+ * @li void pop_back_S(S *arr) : remove last element
+ * @li void clear_S(S *arr) : remove all elements
+ * @li T *get_item_S(S *arr, size_t index) : pointer to the \i `index`-th
+ * element, or a null pointer if out of [0, \i `size` - 1]
+ * @li T *at_unchecked_S(S *arr, size_t index) : \c `static inline` pointer to the
+ * \i `index`-th element without any check (index in [0, \i `size` - 1])
+ * @li T *data_ptr_S(S *arr), T *begin_S(S *arr), T *end_S(S *arr) :
+ * \c `static inline` pointers to the first and past the last elements
+ *
+ * The \c `FOREACH_DynamicArray` macro of the generic header also iterates S.
+ *
+ * Errors and edge cases behave exactly as in generic/DynamicArray.h.
+ */
+#ifndef __C_DSA_GENERIC_DYNAMIC_ARRAY_TEMPLATE_H__
+#define __C_DSA_GENERIC_DYNAMIC_ARRAY_TEMPLATE_H__
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+#include "../utils/instrument.h"
+#include "../utils/checked.h"
+
+#ifndef C_DSA_DYNAMIC_ARRAY_GROWTH_FACTOR
+#define C_DSA_DYNAMIC_ARRAY_GROWTH_FACTOR 2.0
+#endif
+
+#define DEFINE_DYNAMIC_ARRAY(T, suffix)                                        \
+  typedef struct DynamicArray_##suffix DynamicArray_##suffix;                  \
+                                                                               \
+  struct DynamicArray_##suffix {                                               \
+    size_t size, capacity;                                                     \
+    double growth_factor;                                                      \
+    const Allocator *allocator;                                                \
+    T data[];                                                                  \
+  };                                                                           \
+                                                                               \
+  C_DSA_API status_t create_DynamicArray_##suffix##_with_allocator(DynamicArray_##suffix **out, T *data, size_t size, \
+                                                     size_t cap, const Allocator *allocator) { \
+    if (C_DSA_UNLIKELY(!out)) return SEGFAULT;                                 \
+    *out = NULL;                                                               \
+    if (!data) {                                                               \
+      size = 0;                                                                \
+    }                                                                          \
+    if (C_DSA_UNLIKELY(!allocator)) return SEGFAULT;                           \
+    if (C_DSA_UNLIKELY(cap < size)) return INVALID_SIZE;                       \
+    size_t bytes;                                                              \
+    if (C_DSA_UNLIKELY(checked_bytes(sizeof(DynamicArray_##suffix), cap, sizeof(T), &bytes))) return INVALID_SIZE; \
+    DynamicArray_##suffix *result = (DynamicArray_##suffix*)allocator->alloc(allocator->ctx, bytes); \
+    if (C_DSA_UNLIKELY(!result)) return HEAP_FAILURE;                          \
+    result->size = size, result->capacity = cap;                               \
+    result->growth_factor = C_DSA_DYNAMIC_ARRAY_GROWTH_FACTOR;                 \
+    result->allocator = allocator;                                             \
+    if (size) memcpy(result->data, data, size * sizeof(T));                    \
+    C_DSA_COUNT_ALLOC(C_DSA_DYNAMIC_ARRAY, bytes);                             \
+    *out = result;                                                             \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t create_DynamicArray_##suffix(DynamicArray_##suffix **out, T *data, size_t size, size_t cap) { \
+    return create_DynamicArray_##suffix##_with_allocator(out, data, size, cap, &heap_allocator); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result new_DynamicArray_##suffix##_with_allocator(T *data, size_t size, size_t cap, \
+                                                  const Allocator *allocator) { \
+    DynamicArray_##suffix *result;                                             \
+    status_t status = create_DynamicArray_##suffix##_with_allocator(&result, data, size, cap, allocator); \
+    if (C_DSA_LIKELY(status == NO_ERROR)) {                                    \
+      return (Result) {                                                        \
+        .ok = NO_ERROR,                                                        \
+        .data = result                                                         \
+      };                                                                       \
+    }                                                                          \
+    return (Result) {                                                          \
+      .ok = status,                                                            \
+      .error_msg = status == SEGFAULT ? "ValueError: cannot access a null pointer\n" \
+                 : status == HEAP_FAILURE ? "AllocationError: Not enough memory in the heap" \
+                 : data && cap < size ? "SizeError: size is negative or capacity is less than size\n" \
+                 : "SizeError: Capacity is too big\n"                          \
+    };                                                                         \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result new_DynamicArray_##suffix(T *data, size_t size, size_t cap) { \
+    return new_DynamicArray_##suffix##_with_allocator(data, size, cap, &heap_allocator); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result from_DynamicArray_##suffix(DynamicArray_##suffix *from) {   \
+    if (!from) {                                                               \
+      return (Result) {                                                        \
+        .ok = SEGFAULT,                                                        \
+        .error_msg = "ValueError: cannot access a null pointer\n"              \
+      };                                                                       \
+    }                                                                          \
+    Result result = new_DynamicArray_##suffix##_with_allocator(                \
+      from->data, from->size, from->capacity, from->allocator);                \
+    if (result.ok == NO_ERROR) {                                               \
+      C_DSA_COUNT_CLONE(C_DSA_DYNAMIC_ARRAY, sizeof(T) * from->size);          \
+      ((DynamicArray_##suffix*)result.data)->growth_factor = from->growth_factor; \
+    }                                                                          \
+    return result;                                                             \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t create_from_DynamicArray_##suffix(DynamicArray_##suffix **out, const DynamicArray_##suffix *from) { \
+    if (C_DSA_UNLIKELY(!out)) return SEGFAULT;                                 \
+    if (C_DSA_UNLIKELY(!from)) {                                               \
+      *out = NULL;                                                             \
+      return SEGFAULT;                                                         \
+    }                                                                          \
+    status_t status = create_DynamicArray_##suffix##_with_allocator(out, (T*)from->data, from->size, from->capacity, \
+                                                        from->allocator);      \
+    if (status == NO_ERROR) {                                                  \
+      (*out)->growth_factor = from->growth_factor;                             \
+      C_DSA_COUNT_CLONE(C_DSA_DYNAMIC_ARRAY, sizeof(T) * from->size);          \
+    }                                                                          \
+    return status;                                                             \
+  }                                                                            \
+                                                                               \
+  C_DSA_API void free_DynamicArray_##suffix(DynamicArray_##suffix **arr) {     \
+    if (!arr || !*arr) return;                                                 \
+    const Allocator *allocator = (*arr)->allocator;                            \
+    size_t bytes = sizeof(DynamicArray_##suffix) + sizeof(T) * (*arr)->capacity; \
+    C_DSA_COUNT_FREE(C_DSA_DYNAMIC_ARRAY, bytes);                              \
+    allocator->free(allocator->ctx, *arr, bytes);                              \
+    *arr = NULL;                                                               \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t reserve_DynamicArray_##suffix(DynamicArray_##suffix **arr, size_t cap) { \
+    if (!arr || !*arr) return SEGFAULT;                                        \
+    if (cap <= (*arr)->capacity) return NO_ERROR;                              \
+    const Allocator *allocator = (*arr)->allocator;                            \
+    size_t bytes;                                                              \
+    if (checked_bytes(sizeof(DynamicArray_##suffix), cap, sizeof(T), &bytes)) return INVALID_SIZE; \
+    DynamicArray_##suffix *grown = (DynamicArray_##suffix*)allocator->realloc( \
+      allocator->ctx, *arr, sizeof(DynamicArray_##suffix) + sizeof(T) * (*arr)->capacity, bytes); \
+    if (!grown) return HEAP_FAILURE;                                           \
+    C_DSA_COUNT_RESIZE(C_DSA_DYNAMIC_ARRAY, sizeof(DynamicArray_##suffix) + sizeof(T) * grown->capacity, bytes); \
+    grown->capacity = cap;                                                     \
+    *arr = grown;                                                              \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t shrink_to_fit_DynamicArray_##suffix(DynamicArray_##suffix **arr) { \
+    if (!arr || !*arr) return SEGFAULT;                                        \
+    if ((*arr)->size == (*arr)->capacity) return NO_ERROR;                     \
+    const Allocator *allocator = (*arr)->allocator;                            \
+    DynamicArray_##suffix *shrunk = (DynamicArray_##suffix*)allocator->realloc( \
+      allocator->ctx, *arr, sizeof(DynamicArray_##suffix) + sizeof(T) * (*arr)->capacity, \
+      sizeof(DynamicArray_##suffix) + sizeof(T) * (*arr)->size);               \
+    if (!shrunk) return HEAP_FAILURE;                                          \
+    C_DSA_COUNT_RESIZE(C_DSA_DYNAMIC_ARRAY, sizeof(DynamicArray_##suffix) + sizeof(T) * shrunk->capacity, \
+                       sizeof(DynamicArray_##suffix) + sizeof(T) * shrunk->size); \
+    shrunk->capacity = shrunk->size;                                           \
+    *arr = shrunk;                                                             \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t set_growth_factor_DynamicArray_##suffix(DynamicArray_##suffix *arr, \
+                                                   double factor) {            \
+    if (!arr) return SEGFAULT;                                                 \
+    if (!(factor > 1.0)) return INVALID_SIZE;                                  \
+    arr->growth_factor = factor;                                               \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t push_back_DynamicArray_##suffix(DynamicArray_##suffix **arr, T value) { \
+    if (!arr || !*arr) return SEGFAULT;                                        \
+    if ((*arr)->size == (*arr)->capacity) {                                    \
+      double scaled = (double)(*arr)->capacity * (*arr)->growth_factor;        \
+      size_t cap = scaled < (double)SIZE_MAX ? (size_t)scaled : SIZE_MAX;      \
+      if (cap <= (*arr)->capacity) cap = (*arr)->capacity + 1;                 \
+      status_t status = reserve_DynamicArray_##suffix(arr, cap);               \
+      if (status != NO_ERROR) {                                                \
+        C_DSA_COUNT_FAILED_PUSH(C_DSA_DYNAMIC_ARRAY);                          \
+        return status;                                                         \
+      }                                                                        \
+    }                                                                          \
+    (*arr)->data[(*arr)->size++] = value;                                      \
+    C_DSA_COUNT_PUSH(C_DSA_DYNAMIC_ARRAY, 1);                                  \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API void pop_back_DynamicArray_##suffix(DynamicArray_##suffix *arr) {  \
+    if (!arr) return;                                                          \
+    if (arr->size) {                                                           \
+      arr->size--;                                                             \
+      C_DSA_COUNT_POP(C_DSA_DYNAMIC_ARRAY, 1);                                 \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  C_DSA_API void clear_DynamicArray_##suffix(DynamicArray_##suffix *arr) {     \
+    if (!arr) return;                                                          \
+    arr->size = 0;                                                             \
+  }                                                                            \
+                                                                               \
+  C_DSA_API T *get_item_DynamicArray_##suffix(DynamicArray_##suffix *arr, size_t index) { \
+    if (!arr || index >= arr->size) return NULL;                               \
+    return arr->data + index;                                                  \
+  }                                                                            \
+                                                                               \
+  static inline T *at_unchecked_DynamicArray_##suffix(DynamicArray_##suffix *arr, size_t index) { \
+    return arr->data + index;                                                  \
+  }                                                                            \
+                                                                               \
+  static inline T *data_ptr_DynamicArray_##suffix(DynamicArray_##suffix *arr) { \
+    return arr->data;                                                          \
+  }                                                                            \
+                                                                               \
+  static inline T *begin_DynamicArray_##suffix(DynamicArray_##suffix *arr) {   \
+    return arr->data;                                                          \
+  }                                                                            \
+                                                                               \
+  static inline T *end_DynamicArray_##suffix(DynamicArray_##suffix *arr) {     \
+    return arr->data + arr->size;                                              \
+  }
+
+#endif // __C_DSA_GENERIC_DYNAMIC_ARRAY_TEMPLATE_H__
@@ -0,0 +1,615 @@
+/**
+ * @file HashMap.h
+ * @brief a generic open-addressing hash map with SIMD-probed control bytes
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details This library introduces a structure \c `HashMap` mapping keys of
+ * \i `key_size` bytes to values of \i `value_size` bytes (a \i `value_size` of 0
+ * makes it a hash set), in the spirit of Swiss tables: the slots live in one
+ * flat array and every slot has a control byte, in a separate array, which is
+ * either empty, deleted, or holds the low 7 bits of the hash of its key.
+ * A lookup loads the control bytes of a group of \c `C_DSA_HASH_GROUP` slots at
+ * once and compares them with the 7 bits of the searched hash (one SSE2
+ * compare, or a scalar loop when SSE2 is not enabled or \c `C_DSA_NO_SIMD` is
+ * defined), so the keys are only compared for the few slots whose bits match;
+ * it stops at the first group holding an empty slot. The groups are probed
+ * quadratically from the slot given by the other bits of the hash.
+ * The map grows (doubling its capacity) when more than 7/8 of its slots are
+ * used or deleted, so a lookup only visits one or two groups.
+ * Keys are hashed with \i `hash` and compared with \i `equal`, by default the
+ * bytes of the keys are hashed and compared. The keys and values are copied
+ * into the map, a key must not be modified while it is in the map.
+ * The header and the table are allocated through the \i `allocator` of the map,
+ * e.g. an \c `Arena` for maps living as long as a request.
+ * Growing the map moves its slots, pointers to keys or values are only valid
+ * until the next insertion.
+ *
+ * HashMap's APIs:
+ * @li new_T : dynamically create type T on the heap
+ * @li new_T_with_allocator : dynamically create type T with an \c `Allocator`
+ * @li free_T : deallocate type T
+ * @li reserve_T : make sure T can hold \i `count` keys without growing
+ * @li insert_T : insert or replace the value of a key in T
+ * @li insert_many_T : insert many keys in T with one growth
+ * @li find_T : get the pointer to the value of a key
+ * @li contains_T : whether a key is in T
+ * @li erase_T : remove a key from T
+ * @li clear_T : remove all keys from T
+ * @li next_T : iterate over the keys and values of T
+ * @li hash_bytes : the default hash function
+ */
+#ifndef __C_DSA_GENERIC_HASH_MAP_H__
+#define __C_DSA_GENERIC_HASH_MAP_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+
+#if !defined(C_DSA_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#include <emmintrin.h>
+#define C_DSA_HASH_MAP_SSE2
+#endif
+
+#define C_DSA_HASH_GROUP 16
+#define C_DSA_CTRL_EMPTY ((int8_t)-128)
+#define C_DSA_CTRL_DELETED ((int8_t)-2)
+
+/**
+ * @brief hash \i `key` of \i `key_size` bytes
+ */
+typedef size_t (*HashFunction)(const void *key, size_t key_size);
+
+/**
+ * @brief non-zero if the keys \i `a` and \i `b` of \i `key_size` bytes are equal
+ */
+typedef int (*EqualFunction)(const void *a, const void *b, size_t key_size);
+
+typedef struct HashMap HashMap;
+
+/**
+ * @struct HashMap
+ * @author andarling
+ * @date 14/10/2026
+ * @brief a table of \i `capacity` slots (a power of two, at least
+ * \c `C_DSA_HASH_GROUP`) and their control bytes
+ *
+ * A slot is a key followed by its value at \i `value_offset`, slots are
+ * \i `slot_size` bytes apart. The \i `ctrl` array has \c `C_DSA_HASH_GROUP`
+ * more bytes than slots, mirroring the first ones, so a group can be loaded
+ * from any slot. \i `growth_left` is the number of empty slots which can still
+ * be filled before growing.
+ */
+struct HashMap {
+  size_t size, capacity, growth_left;
+  size_t key_size, value_size, value_offset, slot_size;
+  HashFunction hash;
+  EqualFunction equal;
+  const Allocator *allocator;
+  int8_t *ctrl;
+  char *slots;
+};
+
+/**
+ * @fn size_t hash_bytes(const void *key, size_t key_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief hash the bytes of \i `key`, eight at a time
+ */
+C_DSA_API size_t hash_bytes(const void *key, size_t key_size) {
+  const unsigned char *bytes = (const unsigned char*)key;
+  uint64_t hash = 0x243f6a8885a308d3u ^ key_size;
+  while (key_size >= 8) {
+    uint64_t word;
+    memcpy(&word, bytes, 8);
+    hash = (hash ^ word) * 0x9e3779b97f4a7c15u;
+    hash ^= hash >> 29;
+    bytes += 8, key_size -= 8;
+  }
+  if (key_size) {
+    uint64_t word = 0;
+    memcpy(&word, bytes, key_size);
+    hash = (hash ^ word) * 0x9e3779b97f4a7c15u;
+  }
+  hash ^= hash >> 32;
+  return (size_t)hash;
+}
+
+C_DSA_API int equal_bytes(const void *a, const void *b, size_t key_size) {
+  return !memcmp(a, b, key_size);
+}
+
+// mask is not 0
+C_DSA_API unsigned ctz_group_HashMap(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+  return (unsigned)__builtin_ctz(mask);
+#else
+  unsigned count = 0;
+  while (!(mask & 1)) mask >>= 1, count++;
+  return count;
+#endif
+}
+
+// mask is not 0
+C_DSA_API unsigned highest_group_HashMap(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+  return 31u - (unsigned)__builtin_clz(mask);
+#else
+  unsigned index = 0;
+  while (mask >>= 1) index++;
+  return index;
+#endif
+}
+
+/**
+ * @brief the bit i is set if the i-th control byte of the group is \i `h2`
+ */
+C_DSA_API uint32_t match_group_HashMap(const int8_t *group, int8_t h2) {
+#ifdef C_DSA_HASH_MAP_SSE2
+  __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+  return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(h2)));
+#else
+  uint32_t mask = 0;
+  for (unsigned i = 0; i < C_DSA_HASH_GROUP; i++) mask |= (uint32_t)(group[i] == h2) << i;
+  return mask;
+#endif
+}
+
+/**
+ * @brief the bit i is set if the i-th control byte of the group is empty
+ */
+C_DSA_API uint32_t match_empty_group_HashMap(const int8_t *group) {
+  return match_group_HashMap(group, C_DSA_CTRL_EMPTY);
+}
+
+/**
+ * @brief the bit i is set if the i-th control byte of the group is empty or
+ * deleted, which are the negative ones
+ */
+C_DSA_API uint32_t match_free_group_HashMap(const int8_t *group) {
+#ifdef C_DSA_HASH_MAP_SSE2
+  return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+  uint32_t mask = 0;
+  for (unsigned i = 0; i < C_DSA_HASH_GROUP; i++) mask |= (uint32_t)(group[i] < 0) << i;
+  return mask;
+#endif
+}
+
+// the 7 bits stored in the control byte and the bits choosing the first group
+C_DSA_API int8_t h2_HashMap(size_t hash) {
+  return (int8_t)(hash & 0x7f);
+}
+
+C_DSA_API size_t h1_HashMap(size_t hash) {
+  return hash >> 7;
+}
+
+/**
+ * @brief write the control byte of \i `index` and its mirror
+ */
+C_DSA_API void set_ctrl_HashMap(int8_t *ctrl, size_t capacity, size_t index, int8_t value) {
+  ctrl[index] = value;
+  if (index < C_DSA_HASH_GROUP) ctrl[capacity + index] = value;
+}
+
+/**
+ * @brief the capacity holding \i `count` keys without growing
+ */
+C_DSA_API size_t capacity_for_HashMap(size_t count) {
+  size_t capacity = C_DSA_HASH_GROUP;
+  while (capacity - capacity / 8 < count) {
+    if (capacity > SIZE_MAX / 2) return 0;
+    capacity <<= 1;
+  }
+  return capacity;
+}
+
+/**
+ * @brief the bytes of a table of \i `capacity` slots, whose slots start at
+ * \i `*slots_offset`, or 0 if it overflows
+ */
+C_DSA_API size_t table_bytes_HashMap(size_t capacity, size_t slot_size, size_t *slots_offset) {
+  size_t ctrl_bytes = capacity + C_DSA_HASH_GROUP;
+  *slots_offset = (ctrl_bytes + sizeof(max_align_t) - 1) / sizeof(max_align_t) * sizeof(max_align_t);
+  if (slot_size && capacity > (SIZE_MAX - *slots_offset) / slot_size) return 0;
+  return *slots_offset + capacity * slot_size;
+}
+
+/**
+ * @brief whether no group holding \i `index` was ever full, then no probe
+ * sequence went past it and it can become empty instead of deleted
+ */
+C_DSA_API int was_never_full_HashMap(const int8_t *ctrl, size_t capacity, size_t index) {
+  size_t before = (index - C_DSA_HASH_GROUP) & (capacity - 1);
+  uint32_t empty_after = match_empty_group_HashMap(ctrl + index);
+  uint32_t empty_before = match_empty_group_HashMap(ctrl + before);
+  // the empty slots around index are less than a group width apart
+  return empty_after && empty_before
+      && ctz_group_HashMap(empty_after) + (C_DSA_HASH_GROUP - 1 - highest_group_HashMap(empty_before))
+         < C_DSA_HASH_GROUP;
+}
+
+/**
+ * @brief the first empty or deleted slot on the probe sequence of \i `hash`
+ */
+C_DSA_API size_t find_free_HashMap(const int8_t *ctrl, size_t capacity, size_t hash) {
+  size_t mask = capacity - 1, pos = h1_HashMap(hash) & mask, step = 0;
+  while (1) {
+    uint32_t free_slots = match_free_group_HashMap(ctrl + pos);
+    if (free_slots) return (pos + ctz_group_HashMap(free_slots)) & mask;
+    step += C_DSA_HASH_GROUP;
+    pos = (pos + step) & mask;
+  }
+}
+
+/**
+ * @brief the slot holding \i `key`, or \i `capacity` if it is not in the map
+ */
+C_DSA_API size_t find_slot_HashMap(const HashMap *map, const void *key, size_t hash) {
+  size_t mask = map->capacity - 1, pos = h1_HashMap(hash) & mask, step = 0;
+  int8_t h2 = h2_HashMap(hash);
+  while (1) {
+    const int8_t *group = map->ctrl + pos;
+    uint32_t matches = match_group_HashMap(group, h2);
+    while (matches) {
+      size_t index = (pos + ctz_group_HashMap(matches)) & mask;
+      if (map->equal(map->slots + map->slot_size * index, key, map->key_size)) return index;
+      matches &= matches - 1;
+    }
+    if (match_empty_group_HashMap(group)) return map->capacity;
+    step += C_DSA_HASH_GROUP;
+    pos = (pos + step) & mask;
+  }
+}
+
+/**
+ * @brief move every key of \i `map` to a new table of \i `capacity` slots
+ */
+C_DSA_API status_t rehash_HashMap(HashMap *map, size_t capacity) {
+  size_t slots_offset, bytes = table_bytes_HashMap(capacity, map->slot_size, &slots_offset);
+  if (!bytes) return INVALID_SIZE;
+  int8_t *ctrl = (int8_t*)map->allocator->alloc(map->allocator->ctx, bytes);
+  if (!ctrl) return HEAP_FAILURE;
+  char *slots = (char*)ctrl + slots_offset;
+  memset(ctrl, C_DSA_CTRL_EMPTY, capacity + C_DSA_HASH_GROUP);
+
+  for (size_t i = 0; i < map->capacity; i++) {
+    if (map->ctrl[i] < 0) continue;
+    char *slot = map->slots + map->slot_size * i;
+    size_t hash = map->hash(slot, map->key_size);
+    size_t index = find_free_HashMap(ctrl, capacity, hash);
+    set_ctrl_HashMap(ctrl, capacity, index, h2_HashMap(hash));
+    memcpy(slots + map->slot_size * index, slot, map->slot_size);
+  }
+
+  if (map->ctrl) {
+    size_t old_offset, old_bytes = table_bytes_HashMap(map->capacity, map->slot_size, &old_offset);
+    map->allocator->free(map->allocator->ctx, map->ctrl, old_bytes);
+  }
+  map->ctrl = ctrl, map->slots = slots;
+  map->capacity = capacity;
+  map->growth_left = capacity - capacity / 8 - map->size;
+  return NO_ERROR;
+}
+
+// the greatest power of two dividing n, at most the alignment of max_align_t
+C_DSA_API size_t natural_alignment_HashMap(size_t n) {
+  size_t alignment = 1;
+  while (alignment < sizeof(max_align_t) && !(n & alignment)) alignment <<= 1;
+  return n ? alignment : 1;
+}
+
+/**
+ * @fn Result new_HashMap_with_allocator(size_t key_size, size_t value_size, HashFunction hash, EqualFunction equal, size_t capacity, const Allocator *allocator)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to an empty map allocated by \i `allocator`
+ *
+ * @param[in] key_size the size in bytes of every key
+ * (key_size > 0)
+ * @param[in] value_size the size in bytes of every value
+ * (0 for a hash set)
+ * @param[in] hash the hash function of the keys
+ * (if null pointer then defaults to \c `hash_bytes`)
+ * @param[in] equal the comparison of the keys, equal keys must have equal hashes
+ * (if null pointer then defaults to comparing the bytes)
+ * @param[in] capacity the number of keys the map holds before growing
+ * @param[in] allocator the allocator to use, it must outlive the map
+ * (allocator is not a null pointer)
+ *
+ * @return a \c `Result` type to the successfully allocated map or a error message
+ */
+C_DSA_API Result new_HashMap_with_allocator(size_t key_size, size_t value_size, HashFunction hash,
+                                            EqualFunction equal, size_t capacity,
+                                            const Allocator *allocator) {
+  if (!allocator) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  if (!key_size) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Key cannot have less than 1 byte\n"
+    };
+  }
+  size_t slots = capacity_for_HashMap(capacity);
+  if (!slots || key_size > SIZE_MAX / 4 || value_size > SIZE_MAX / 4) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Capacity is too big\n"
+    };
+  }
+
+  HashMap *result = (HashMap*)allocator->alloc(allocator->ctx, sizeof(HashMap));
+  if (!result) {
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+  size_t key_alignment = natural_alignment_HashMap(key_size);
+  size_t value_alignment = value_size ? natural_alignment_HashMap(value_size) : 1;
+  size_t slot_alignment = key_alignment > value_alignment ? key_alignment : value_alignment;
+  result->size = result->capacity = result->growth_left = 0;
+  result->key_size = key_size, result->value_size = value_size;
+  result->value_offset = (key_size + value_alignment - 1) / value_alignment * value_alignment;
+  result->slot_size = (result->value_offset + value_size + slot_alignment - 1) / slot_alignment * slot_alignment;
+  result->hash = hash ? hash : hash_bytes;
+  result->equal = equal ? equal : equal_bytes;
+  result->allocator = allocator;
+  result->ctrl = NULL, result->slots = NULL;
+
+  status_t status = rehash_HashMap(result, slots);
+  if (status != NO_ERROR) {
+    allocator->free(allocator->ctx, result, sizeof(HashMap));
+    return (Result) {
+      .ok = status,
+      .error_msg = status == HEAP_FAILURE ? "AllocationError: Not enough memory in the heap"
+                                          : "SizeError: Capacity is too big\n"
+    };
+  }
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn Result new_HashMap(size_t key_size, size_t value_size, HashFunction hash, EqualFunction equal, size_t capacity)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `new_HashMap_with_allocator` on the heap
+ */
+C_DSA_API Result new_HashMap(size_t key_size, size_t value_size, HashFunction hash, EqualFunction equal,
+                             size_t capacity) {
+  return new_HashMap_with_allocator(key_size, value_size, hash, equal, capacity, &heap_allocator);
+}
+
+/**
+ * @fn void free_HashMap(HashMap **map)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief deallocate the table and the map and set the pointer to NULL
+ *
+ * @param[in] map a pointer to the address of the map
+ * (if map is a null pointer then exits the function)
+ *
+ * @return void
+ */
+C_DSA_API void free_HashMap(HashMap **map) {
+  if (!map || !*map) return;
+  const Allocator *allocator = (*map)->allocator;
+  size_t slots_offset, bytes = table_bytes_HashMap((*map)->capacity, (*map)->slot_size, &slots_offset);
+  allocator->free(allocator->ctx, (*map)->ctrl, bytes);
+  allocator->free(allocator->ctx, *map, sizeof(HashMap));
+  *map = NULL;
+}
+
+/**
+ * @fn status_t reserve_HashMap(HashMap *map, size_t count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief make sure the map holds \i `count` keys without growing
+ *
+ * @param[in] map a pointer to \c `HashMap` type
+ * @param[in] count the number of keys
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t reserve_HashMap(HashMap *map, size_t count) {
+  if (!map) return SEGFAULT;
+  if (count <= map->size + map->growth_left) return NO_ERROR;
+  size_t capacity = capacity_for_HashMap(count);
+  if (!capacity) return INVALID_SIZE;
+  return rehash_HashMap(map, capacity);
+}
+
+/**
+ * @fn status_t insert_HashMap(HashMap *map, const void *key, const void *value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert \i `key` with \i `value`, or replace its value if it is in the map
+ *
+ * When no empty slot is left, the map grows, or is only rebuilt at the same
+ * capacity to drop the deleted slots if they are most of the used ones.
+ *
+ * @param[in] map a pointer to \c `HashMap` type
+ * @param[in] key a pointer to the key
+ * (key is not a null pointer)
+ * @param[in] value a pointer to the value
+ * (if null pointer then the value is zeroed, or left as is if the key is in the map)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t insert_HashMap(HashMap *map, const void *key, const void *value) {
+  if (!map || !key) return SEGFAULT;
+  size_t hash = map->hash(key, map->key_size);
+  size_t index = find_slot_HashMap(map, key, hash);
+  if (index != map->capacity) {
+    if (value) memcpy(map->slots + map->slot_size * index + map->value_offset, value, map->value_size);
+    return NO_ERROR;
+  }
+
+  index = find_free_HashMap(map->ctrl, map->capacity, hash);
+  if (C_DSA_UNLIKELY(!map->growth_left && map->ctrl[index] == C_DSA_CTRL_EMPTY)) {
+    size_t capacity = map->size < map->capacity / 2 ? map->capacity : map->capacity * 2;
+    if (capacity < map->capacity) return INVALID_SIZE;
+    status_t status = rehash_HashMap(map, capacity);
+    if (status != NO_ERROR) return status;
+    index = find_free_HashMap(map->ctrl, map->capacity, hash);
+  }
+  if (map->ctrl[index] == C_DSA_CTRL_EMPTY) map->growth_left--;
+  set_ctrl_HashMap(map->ctrl, map->capacity, index, h2_HashMap(hash));
+  char *slot = map->slots + map->slot_size * index;
+  memcpy(slot, key, map->key_size);
+  if (value) memcpy(slot + map->value_offset, value, map->value_size);
+  else memset(slot + map->value_offset, 0, map->value_size);
+  map->size++;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t insert_many_HashMap(HashMap *map, const void *keys, const void *values, size_t count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert \i `count` keys and their values, growing the map at most once
+ *
+ * @param[in] map a pointer to \c `HashMap` type
+ * @param[in] keys the \i `count` contiguous keys
+ * (keys is not a null pointer unless count is 0)
+ * @param[in] values the \i `count` contiguous values
+ * (if null pointer then the values are zeroed)
+ * @param[in] count the number of keys
+ *
+ * @return 0 if success and non-zero if an error occurs, the keys before the
+ * failing one are inserted
+ */
+C_DSA_API status_t insert_many_HashMap(HashMap *map, const void *keys, const void *values, size_t count) {
+  if (!map || (!keys && count)) return SEGFAULT;
+  if (count > SIZE_MAX - map->size) return INVALID_SIZE;
+  status_t status = reserve_HashMap(map, map->size + count);
+  if (status != NO_ERROR) return status;
+  const char *key = (const char*)keys, *value = (const char*)values;
+  for (size_t i = 0; i < count; i++) {
+    status = insert_HashMap(map, key + map->key_size * i, value ? value + map->value_size * i : NULL);
+    if (status != NO_ERROR) return status;
+  }
+  return NO_ERROR;
+}
+
+/**
+ * @fn void *find_HashMap(HashMap *map, const void *key)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief get the pointer to the value of \i `key`
+ *
+ * @param[in] map a pointer to \c `HashMap` type
+ * @param[in] key a pointer to the key
+ *
+ * @return the pointer to the value, valid until the next insertion, or a null
+ * pointer if \i `key` is not in the map
+ */
+C_DSA_API void *find_HashMap(HashMap *map, const void *key) {
+  if (!map || !key) return NULL;
+  size_t index = find_slot_HashMap(map, key, map->hash(key, map->key_size));
+  if (index == map->capacity) return NULL;
+  return map->slots + map->slot_size * index + map->value_offset;
+}
+
+/**
+ * @fn int contains_HashMap(HashMap *map, const void *key)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief 1 if \i `key` is in the map, 0 otherwise
+ */
+C_DSA_API int contains_HashMap(HashMap *map, const void *key) {
+  return find_HashMap(map, key) != NULL;
+}
+
+/**
+ * @fn status_t erase_HashMap(HashMap *map, const void *key)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove \i `key` and its value from the map
+ *
+ * The slot is marked deleted, so the probe sequences crossing it go on, unless
+ * its group has an empty slot, then no sequence crosses it and it becomes empty.
+ *
+ * @param[in] map a pointer to \c `HashMap` type
+ * @param[in] key a pointer to the key
+ *
+ * @return 0 if success, \c `INVALID_INDEX` if \i `key` is not in the map
+ */
+C_DSA_API status_t erase_HashMap(HashMap *map, const void *key) {
+  if (!map || !key) return SEGFAULT;
+  size_t index = find_slot_HashMap(map, key, map->hash(key, map->key_size));
+  if (index == map->capacity) return INVALID_INDEX;
+
+  if (was_never_full_HashMap(map->ctrl, map->capacity, index)) {
+    set_ctrl_HashMap(map->ctrl, map->capacity, index, C_DSA_CTRL_EMPTY);
+    map->growth_left++;
+  }
+  else {
+    set_ctrl_HashMap(map->ctrl, map->capacity, index, C_DSA_CTRL_DELETED);
+  }
+  map->size--;
+  return NO_ERROR;
+}
+
+/**
+ * @fn void clear_HashMap(HashMap *map)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove every key, keeping the capacity
+ */
+C_DSA_API void clear_HashMap(HashMap *map) {
+  if (!map) return;
+  memset(map->ctrl, C_DSA_CTRL_EMPTY, map->capacity + C_DSA_HASH_GROUP);
+  map->size = 0;
+  map->growth_left = map->capacity - map->capacity / 8;
+}
+
+/**
+ * @fn int next_HashMap(HashMap *map, size_t *index, void **key, void **value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief find the next key from the slot \i `*index` on
+ *
+ * Start with \i `*index` at 0 and call it until it returns 0, the keys come in
+ * no particular order. The map must not be modified meanwhile, but the values
+ * can be.
+ *
+ * @param[in] map a pointer to \c `HashMap` type
+ * @param[in, out] index the slot to start from, set to the one after the key found
+ * (index is not a null pointer)
+ * @param[out] key the pointer to the key found
+ * (if null pointer then ignored)
+ * @param[out] value the pointer to its value
+ * (if null pointer then ignored)
+ *
+ * @return 1 if a key is found, 0 at the end of the map
+ */
+C_DSA_API int next_HashMap(HashMap *map, size_t *index, void **key, void **value) {
+  if (!map || !index) return 0;
+  for (size_t i = *index; i < map->capacity; i++) {
+    if (map->ctrl[i] < 0) continue;
+    char *slot = map->slots + map->slot_size * i;
+    if (key) *key = slot;
+    if (value) *value = slot + map->value_offset;
+    *index = i + 1;
+    return 1;
+  }
+  *index = map->capacity;
+  return 0;
+}
+
+#endif // __C_DSA_GENERIC_HASH_MAP_H__
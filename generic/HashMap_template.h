@@ -0,0 +1,252 @@
+/**
+ * @file HashMap_template.h
+ * @brief a generator for type specialised hash maps
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details \c `DEFINE_HASH_MAP(K, V, suffix, hash, equal)` emits a structure
+ * \c `HashMap_suffix` mapping keys of type \i `K` to values of type \i `V`, with
+ * the same table as the generic \c `HashMap` (see generic/HashMap.h) but with
+ * typed slots, so hashing and comparing the keys are inlined calls of
+ * \i `hash` (\c `size_t hash(K key)`) and \i `equal` (\c `int equal(K a, K b)`),
+ * which can be functions or function-like macros.
+ * \i `K` and \i `V` must be copyable by assignment.
+ *
+ * Generated APIs (S stands for \c `HashMap_suffix`):
+ * @li Result new_S(size_t capacity) : create S on the heap, holding
+ * \i `capacity` keys before growing
+ * @li Result new_S_with_allocator(size_t capacity, const Allocator *allocator) :
+ * create S through \i `allocator`
+ * @li void free_S(S **map) : deallocate S and set the pointer to NULL
+ * @li status_t reserve_S(S *map, size_t count) : make sure S holds \i `count`
+ * keys without growing
+ * @li status_t insert_S(S *map, K key, V value) : insert \i `key` or replace its
+ * value
+ * @li status_t insert_many_S(S *map, const K *keys, const V *values, size_t count) :
+ * insert \i `count` keys growing at most once
+ * @li V *find_S(S *map, K key) : pointer to the value of \i `key`, or a null
+ * pointer if it is not in S
+ * @li int contains_S(S *map, K key) : whether \i `key` is in S
+ * @li status_t erase_S(S *map, K key) : remove \i `key`, \c `INVALID_INDEX` if it
+ * is not in S
+ * @li void clear_S(S *map) : remove all keys
+ * @li int next_S(S *map, size_t *index, K **key, V **value) : iterate over the
+ * keys and values
+ *
+ * Errors and edge cases behave exactly as in generic/HashMap.h.
+ */
+#ifndef __C_DSA_GENERIC_HASH_MAP_TEMPLATE_H__
+#define __C_DSA_GENERIC_HASH_MAP_TEMPLATE_H__
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+#include "HashMap.h"
+
+#define DEFINE_HASH_MAP(K, V, suffix, hash, equal)                             \
+  typedef struct HashMapSlot_##suffix HashMapSlot_##suffix;                    \
+  typedef struct HashMap_##suffix HashMap_##suffix;                            \
+                                                                               \
+  struct HashMapSlot_##suffix {                                                \
+    K key;                                                                     \
+    V value;                                                                   \
+  };                                                                           \
+                                                                               \
+  struct HashMap_##suffix {                                                    \
+    size_t size, capacity, growth_left;                                        \
+    const Allocator *allocator;                                                \
+    int8_t *ctrl;                                                              \
+    HashMapSlot_##suffix *slots;                                               \
+  };                                                                           \
+                                                                               \
+  C_DSA_API size_t find_slot_HashMap_##suffix(const HashMap_##suffix *map, K key, size_t key_hash) { \
+    size_t mask = map->capacity - 1, pos = h1_HashMap(key_hash) & mask, step = 0; \
+    int8_t h2 = h2_HashMap(key_hash);                                          \
+    while (1) {                                                                \
+      const int8_t *group = map->ctrl + pos;                                   \
+      uint32_t matches = match_group_HashMap(group, h2);                       \
+      while (matches) {                                                        \
+        size_t index = (pos + ctz_group_HashMap(matches)) & mask;              \
+        if (equal(map->slots[index].key, key)) return index;                   \
+        matches &= matches - 1;                                                \
+      }                                                                        \
+      if (match_empty_group_HashMap(group)) return map->capacity;              \
+      step += C_DSA_HASH_GROUP;                                                \
+      pos = (pos + step) & mask;                                               \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t rehash_HashMap_##suffix(HashMap_##suffix *map, size_t capacity) { \
+    size_t slots_offset, bytes = table_bytes_HashMap(capacity, sizeof(HashMapSlot_##suffix), &slots_offset); \
+    if (!bytes) return INVALID_SIZE;                                           \
+    int8_t *ctrl = (int8_t*)map->allocator->alloc(map->allocator->ctx, bytes); \
+    if (!ctrl) return HEAP_FAILURE;                                            \
+    HashMapSlot_##suffix *slots = (HashMapSlot_##suffix*)((char*)ctrl + slots_offset); \
+    memset(ctrl, C_DSA_CTRL_EMPTY, capacity + C_DSA_HASH_GROUP);               \
+    for (size_t i = 0; i < map->capacity; i++) {                               \
+      if (map->ctrl[i] < 0) continue;                                          \
+      size_t key_hash = hash(map->slots[i].key);                               \
+      size_t index = find_free_HashMap(ctrl, capacity, key_hash);              \
+      set_ctrl_HashMap(ctrl, capacity, index, h2_HashMap(key_hash));           \
+      slots[index] = map->slots[i];                                            \
+    }                                                                          \
+    if (map->ctrl) {                                                           \
+      size_t old_offset, old_bytes = table_bytes_HashMap(map->capacity, sizeof(HashMapSlot_##suffix), \
+                                                         &old_offset);         \
+      map->allocator->free(map->allocator->ctx, map->ctrl, old_bytes);         \
+    }                                                                          \
+    map->ctrl = ctrl, map->slots = slots;                                      \
+    map->capacity = capacity;                                                  \
+    map->growth_left = capacity - capacity / 8 - map->size;                    \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result new_HashMap_##suffix##_with_allocator(size_t capacity, const Allocator *allocator) { \
+    if (!allocator) {                                                          \
+      return (Result) {                                                        \
+        .ok = SEGFAULT,                                                        \
+        .error_msg = "ValueError: cannot access a null pointer\n"              \
+      };                                                                       \
+    }                                                                          \
+    size_t slots = capacity_for_HashMap(capacity);                             \
+    if (!slots) {                                                              \
+      return (Result) {                                                        \
+        .ok = INVALID_SIZE,                                                    \
+        .error_msg = "SizeError: Capacity is too big\n"                        \
+      };                                                                       \
+    }                                                                          \
+    HashMap_##suffix *result = (HashMap_##suffix*)allocator->alloc(allocator->ctx, sizeof(HashMap_##suffix)); \
+    if (!result) {                                                             \
+      return (Result) {                                                        \
+        .ok = HEAP_FAILURE,                                                    \
+        .error_msg = "AllocationError: Not enough memory in the heap"          \
+      };                                                                       \
+    }                                                                          \
+    result->size = result->capacity = result->growth_left = 0;                 \
+    result->allocator = allocator;                                             \
+    result->ctrl = NULL, result->slots = NULL;                                 \
+    status_t status = rehash_HashMap_##suffix(result, slots);                  \
+    if (status != NO_ERROR) {                                                  \
+      allocator->free(allocator->ctx, result, sizeof(HashMap_##suffix));       \
+      return (Result) {                                                        \
+        .ok = status,                                                          \
+        .error_msg = status == HEAP_FAILURE ? "AllocationError: Not enough memory in the heap" \
+                                            : "SizeError: Capacity is too big\n" \
+      };                                                                       \
+    }                                                                          \
+    return (Result) {                                                          \
+      .ok = NO_ERROR,                                                          \
+      .data = result                                                           \
+    };                                                                         \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result new_HashMap_##suffix(size_t capacity) {                     \
+    return new_HashMap_##suffix##_with_allocator(capacity, &heap_allocator);   \
+  }                                                                            \
+                                                                               \
+  C_DSA_API void free_HashMap_##suffix(HashMap_##suffix **map) {               \
+    if (!map || !*map) return;                                                 \
+    const Allocator *allocator = (*map)->allocator;                            \
+    size_t slots_offset, bytes = table_bytes_HashMap((*map)->capacity, sizeof(HashMapSlot_##suffix), \
+                                                     &slots_offset);           \
+    allocator->free(allocator->ctx, (*map)->ctrl, bytes);                      \
+    allocator->free(allocator->ctx, *map, sizeof(HashMap_##suffix));           \
+    *map = NULL;                                                               \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t reserve_HashMap_##suffix(HashMap_##suffix *map, size_t count) { \
+    if (!map) return SEGFAULT;                                                 \
+    if (count <= map->size + map->growth_left) return NO_ERROR;                \
+    size_t capacity = capacity_for_HashMap(count);                             \
+    if (!capacity) return INVALID_SIZE;                                        \
+    return rehash_HashMap_##suffix(map, capacity);                             \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t insert_HashMap_##suffix(HashMap_##suffix *map, K key, V value) { \
+    if (!map) return SEGFAULT;                                                 \
+    size_t key_hash = hash(key);                                               \
+    size_t index = find_slot_HashMap_##suffix(map, key, key_hash);             \
+    if (index != map->capacity) {                                              \
+      map->slots[index].value = value;                                         \
+      return NO_ERROR;                                                         \
+    }                                                                          \
+    index = find_free_HashMap(map->ctrl, map->capacity, key_hash);             \
+    if (C_DSA_UNLIKELY(!map->growth_left && map->ctrl[index] == C_DSA_CTRL_EMPTY)) { \
+      size_t capacity = map->size < map->capacity / 2 ? map->capacity : map->capacity * 2; \
+      if (capacity < map->capacity) return INVALID_SIZE;                       \
+      status_t status = rehash_HashMap_##suffix(map, capacity);                \
+      if (status != NO_ERROR) return status;                                   \
+      index = find_free_HashMap(map->ctrl, map->capacity, key_hash);           \
+    }                                                                          \
+    if (map->ctrl[index] == C_DSA_CTRL_EMPTY) map->growth_left--;              \
+    set_ctrl_HashMap(map->ctrl, map->capacity, index, h2_HashMap(key_hash));   \
+    map->slots[index].key = key;                                               \
+    map->slots[index].value = value;                                           \
+    map->size++;                                                               \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t insert_many_HashMap_##suffix(HashMap_##suffix *map, const K *keys, const V *values, \
+                                                  size_t count) {              \
+    if (!map || ((!keys || !values) && count)) return SEGFAULT;                \
+    if (count > SIZE_MAX - map->size) return INVALID_SIZE;                     \
+    status_t status = reserve_HashMap_##suffix(map, map->size + count);        \
+    if (status != NO_ERROR) return status;                                     \
+    for (size_t i = 0; i < count; i++) {                                       \
+      status = insert_HashMap_##suffix(map, keys[i], values[i]);               \
+      if (status != NO_ERROR) return status;                                   \
+    }                                                                          \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API V *find_HashMap_##suffix(HashMap_##suffix *map, K key) {           \
+    if (!map) return NULL;                                                     \
+    size_t index = find_slot_HashMap_##suffix(map, key, hash(key));            \
+    if (index == map->capacity) return NULL;                                   \
+    return &map->slots[index].value;                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API int contains_HashMap_##suffix(HashMap_##suffix *map, K key) {      \
+    return find_HashMap_##suffix(map, key) != NULL;                            \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t erase_HashMap_##suffix(HashMap_##suffix *map, K key) {    \
+    if (!map) return SEGFAULT;                                                 \
+    size_t index = find_slot_HashMap_##suffix(map, key, hash(key));            \
+    if (index == map->capacity) return INVALID_INDEX;                          \
+    if (was_never_full_HashMap(map->ctrl, map->capacity, index)) {             \
+      set_ctrl_HashMap(map->ctrl, map->capacity, index, C_DSA_CTRL_EMPTY);     \
+      map->growth_left++;                                                      \
+    }                                                                          \
+    else {                                                                     \
+      set_ctrl_HashMap(map->ctrl, map->capacity, index, C_DSA_CTRL_DELETED);   \
+    }                                                                          \
+    map->size--;                                                               \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API void clear_HashMap_##suffix(HashMap_##suffix *map) {               \
+    if (!map) return;                                                          \
+    memset(map->ctrl, C_DSA_CTRL_EMPTY, map->capacity + C_DSA_HASH_GROUP);     \
+    map->size = 0;                                                             \
+    map->growth_left = map->capacity - map->capacity / 8;                      \
+  }                                                                            \
+                                                                               \
+  C_DSA_API int next_HashMap_##suffix(HashMap_##suffix *map, size_t *index, K **key, V **value) { \
+    if (!map || !index) return 0;                                              \
+    for (size_t i = *index; i < map->capacity; i++) {                          \
+      if (map->ctrl[i] < 0) continue;                                          \
+      if (key) *key = &map->slots[i].key;                                      \
+      if (value) *value = &map->slots[i].value;                                \
+      *index = i + 1;                                                          \
+      return 1;                                                                \
+    }                                                                          \
+    *index = map->capacity;                                                    \
+    return 0;                                                                  \
+  }
+
+#endif // __C_DSA_GENERIC_HASH_MAP_TEMPLATE_H__
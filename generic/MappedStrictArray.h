@@ -0,0 +1,335 @@
+/**
+ * @file MappedStrictArray.h
+ * @brief a generic strict array stored in a memory-mapped file
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details This library introduces a structure \c `MappedStrictArray`, the
+ * handle of a file mapped with POSIX \c `mmap` which holds a \c `StrictArray`.
+ * The file is laid out as a \c `MappedFileHeader` (magic, version, byte order
+ * and word size, so a file written on another machine is rejected instead of
+ * misread), then a \c `StrictArray` header and its \i `data`, exactly as in
+ * memory. \c `array_MappedStrictArray` returns a pointer to that header inside
+ * the mapping, so every \c `StrictArray` function works on it, and opening a
+ * file reads nothing: pages are loaded when they are first touched.
+ * The array's \i `allocator` is a null pointer, so \c `free_StrictArray` does not
+ * deallocate it, \c `close_MappedStrictArray` unmaps it.
+ * Changes reach the file when the kernel writes the pages back, or when
+ * \c `sync_MappedStrictArray` is called. An array opened read-only must not be
+ * modified.
+ * The functions need POSIX.1-2008, e.g. \c `_POSIX_C_SOURCE` 200809L defined
+ * before including any header.
+ *
+ * MappedStrictArray's APIs:
+ * @li create_T : create a file holding an empty array and map it
+ * @li open_T : map an existing file, read-only or read-write
+ * @li close_T : unmap the file and deallocate type T
+ * @li array_T : the \c `StrictArray` stored in the file
+ * @li grow_T : increase the capacity of the array and of the file
+ * @li sync_T : write the changes back to the file
+ */
+#ifndef __C_DSA_GENERIC_MAPPED_STRICT_ARRAY_H__
+#define __C_DSA_GENERIC_MAPPED_STRICT_ARRAY_H__
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "StrictArray.h"
+
+#define C_DSA_MAPPED_MAGIC "C_DSA_SA"
+#define C_DSA_MAPPED_VERSION 1u
+#define C_DSA_MAPPED_BYTE_ORDER 0x01020304u
+
+typedef struct MappedFileHeader MappedFileHeader;
+typedef struct MappedStrictArray MappedStrictArray;
+
+/**
+ * @struct MappedFileHeader
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the first 64 bytes of a file holding a \c `StrictArray`
+ *
+ * \i `byte_order` is \c `C_DSA_MAPPED_BYTE_ORDER` written in the byte order of
+ * the machine and \i `word_size` is \c `sizeof(size_t)`, as the
+ * \c `StrictArray` header is stored as is.
+ */
+struct MappedFileHeader {
+  char magic[8];
+  uint32_t version, byte_order, word_size, reserved;
+  char padding[40];
+};
+
+_Static_assert(sizeof(MappedFileHeader) == 64, "MappedFileHeader must be 64 bytes");
+
+/**
+ * @struct MappedStrictArray
+ * @author andarling
+ * @date 14/10/2026
+ * @brief an open file descriptor and its mapping of \i `map_bytes` bytes
+ */
+struct MappedStrictArray {
+  int fd, writable;
+  void *map;
+  size_t map_bytes;
+};
+
+C_DSA_API size_t MappedStrictArray_bytes(size_t cap, size_t type_size) {
+  return sizeof(MappedFileHeader) + sizeof(StrictArray) + type_size * cap;
+}
+
+C_DSA_API StrictArray *header_MappedStrictArray(void *map) {
+  return (StrictArray*)((char*)map + sizeof(MappedFileHeader));
+}
+
+C_DSA_API Result io_error_MappedStrictArray(MappedStrictArray *result, int fd, const char *msg) {
+  if (fd >= 0) close(fd);
+  free(result);
+  return (Result) {
+    .ok = IO_FAILURE,
+    .error_msg = msg
+  };
+}
+
+/**
+ * @fn Result create_MappedStrictArray(const char *path, size_t cap, size_t type_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief create (or truncate) the file at \i `path` with an empty array and map it
+ *
+ * @param[in] path the path of the file
+ * (path is not a null pointer)
+ * @param[in] cap the capacity of the array
+ * @param[in] type_size size of every elements in the array
+ * (type_size > 0)
+ *
+ * @return a \c `Result` type to the read-write \c `MappedStrictArray` or a error message
+ */
+C_DSA_API Result create_MappedStrictArray(const char *path, size_t cap, size_t type_size) {
+  if (!path) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  if (type_size <= 0) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Type cannot have less than 1 byte\n"
+    };
+  }
+  if (cap > ((size_t)-1 - MappedStrictArray_bytes(0, 1)) / type_size) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Capacity is too big\n"
+    };
+  }
+  MappedStrictArray *result = (MappedStrictArray*)malloc(sizeof(MappedStrictArray));
+  if (!result) {
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+
+  int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) return io_error_MappedStrictArray(result, fd, "IOError: cannot create the file\n");
+  size_t bytes = MappedStrictArray_bytes(cap, type_size);
+  if (ftruncate(fd, (off_t)bytes)) return io_error_MappedStrictArray(result, fd, "IOError: cannot resize the file\n");
+  void *map = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (map == MAP_FAILED) return io_error_MappedStrictArray(result, fd, "IOError: cannot map the file\n");
+
+  MappedFileHeader *header = (MappedFileHeader*)map;
+  memset(header, 0, sizeof(MappedFileHeader));
+  memcpy(header->magic, C_DSA_MAPPED_MAGIC, sizeof(header->magic));
+  header->version = C_DSA_MAPPED_VERSION;
+  header->byte_order = C_DSA_MAPPED_BYTE_ORDER;
+  header->word_size = (uint32_t)sizeof(size_t);
+  StrictArray *arr = header_MappedStrictArray(map);
+  arr->size = 0, arr->capacity = cap, arr->type_size = type_size;
+  arr->allocator = NULL;
+
+  result->fd = fd, result->writable = 1;
+  result->map = map, result->map_bytes = bytes;
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn Result open_MappedStrictArray(const char *path, int writable)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief map the array stored in the file at \i `path`
+ *
+ * The header is checked against the magic, the version, the byte order and
+ * the word size of this machine and against the size of the file, and the
+ * array must have no allocator, as written by \c `create_MappedStrictArray`.
+ *
+ * @param[in] path the path of the file
+ * (path is not a null pointer)
+ * @param[in] writable non-zero to map the file read-write, zero for read-only
+ *
+ * @return a \c `Result` type to the \c `MappedStrictArray` or a error message
+ */
+C_DSA_API Result open_MappedStrictArray(const char *path, int writable) {
+  if (!path) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  MappedStrictArray *result = (MappedStrictArray*)malloc(sizeof(MappedStrictArray));
+  if (!result) {
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+
+  int fd = open(path, writable ? O_RDWR : O_RDONLY);
+  if (fd < 0) return io_error_MappedStrictArray(result, fd, "IOError: cannot open the file\n");
+  struct stat info;
+  if (fstat(fd, &info)) return io_error_MappedStrictArray(result, fd, "IOError: cannot read the size of the file\n");
+  size_t bytes = (size_t)info.st_size;
+  if (bytes < MappedStrictArray_bytes(0, 0)) {
+    return io_error_MappedStrictArray(result, fd, "FormatError: the file is too small to hold an array\n");
+  }
+  void *map = mmap(NULL, bytes, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+  if (map == MAP_FAILED) return io_error_MappedStrictArray(result, fd, "IOError: cannot map the file\n");
+
+  const MappedFileHeader *header = (const MappedFileHeader*)map;
+  const StrictArray *arr = header_MappedStrictArray(map);
+  const char *error = NULL;
+  if (memcmp(header->magic, C_DSA_MAPPED_MAGIC, sizeof(header->magic))) {
+    error = "FormatError: the file does not hold an array\n";
+  }
+  else if (header->version != C_DSA_MAPPED_VERSION) {
+    error = "FormatError: unsupported version of the file\n";
+  }
+  else if (header->byte_order != C_DSA_MAPPED_BYTE_ORDER || header->word_size != sizeof(size_t)) {
+    error = "FormatError: the file was written by a machine of another byte order or word size\n";
+  }
+  else if (arr->type_size <= 0 || arr->size > arr->capacity ||
+           arr->capacity > (bytes - MappedStrictArray_bytes(0, 0)) / arr->type_size) {
+    error = "FormatError: the array does not fit in the file\n";
+  }
+  else if (arr->allocator) {
+    // a pointer read from a file would be called by from_StrictArray and free_StrictArray
+    error = "FormatError: the array in the file has an allocator\n";
+  }
+  if (error) {
+    munmap(map, bytes);
+    return io_error_MappedStrictArray(result, fd, error);
+  }
+
+  result->fd = fd, result->writable = writable != 0;
+  result->map = map, result->map_bytes = bytes;
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn void close_MappedStrictArray(MappedStrictArray **mapped)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief unmap and close the file, deallocate the handle and set the pointer to NULL
+ *
+ * The pages not written back yet are still written back by the kernel, call
+ * \c `sync_MappedStrictArray` before to wait for them.
+ *
+ * @param[in] mapped a pointer to the address of the handle
+ * (if mapped is a null pointer then exits the function)
+ *
+ * @return void
+ */
+C_DSA_API void close_MappedStrictArray(MappedStrictArray **mapped) {
+  if (!mapped || !*mapped) return;
+  munmap((*mapped)->map, (*mapped)->map_bytes);
+  close((*mapped)->fd);
+  free(*mapped);
+  *mapped = NULL;
+}
+
+/**
+ * @fn StrictArray *array_MappedStrictArray(MappedStrictArray *mapped)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the \c `StrictArray` stored in the mapping
+ *
+ * The pointer is valid until the handle is closed or grown.
+ *
+ * @return a pointer to the array or a null pointer if mapped is a null pointer
+ */
+C_DSA_API StrictArray *array_MappedStrictArray(MappedStrictArray *mapped) {
+  if (!mapped) return NULL;
+  return header_MappedStrictArray(mapped->map);
+}
+
+/**
+ * @fn status_t grow_MappedStrictArray(MappedStrictArray *mapped, size_t cap)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief increase the capacity of the array to \i `cap`
+ *
+ * The file is extended with \c `ftruncate` (the new elements read as zeros) and
+ * mapped again, so the pointers to the array (and its elements) taken before
+ * are invalid, the array must be taken again with \c `array_MappedStrictArray`.
+ * If \i `cap` is not greater than the capacity nothing is done.
+ *
+ * @param[in] mapped a pointer to a read-write \c `MappedStrictArray`
+ * (if mapped is a null pointer then an error of invalid instance is returned)
+ * @param[in] cap the new capacity
+ *
+ * @return 0 if success and non-zero if an error occurs (then the array is left
+ * as it was)
+ */
+C_DSA_API status_t grow_MappedStrictArray(MappedStrictArray *mapped, size_t cap) {
+  if (!mapped) return SEGFAULT;
+  if (!mapped->writable) return IO_FAILURE;
+  StrictArray *arr = header_MappedStrictArray(mapped->map);
+  if (cap <= arr->capacity) return NO_ERROR;
+  if (cap > ((size_t)-1 - MappedStrictArray_bytes(0, 1)) / arr->type_size) return INVALID_SIZE;
+
+  size_t bytes = MappedStrictArray_bytes(cap, arr->type_size);
+  if (bytes > mapped->map_bytes && ftruncate(mapped->fd, (off_t)bytes)) return IO_FAILURE;
+  // the new mapping is made before the old one is released, so that a
+  // failure leaves the array usable
+  void *map = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, mapped->fd, 0);
+  if (map == MAP_FAILED) return IO_FAILURE;
+  munmap(mapped->map, mapped->map_bytes);
+  mapped->map = map, mapped->map_bytes = bytes;
+  header_MappedStrictArray(map)->capacity = cap;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t sync_MappedStrictArray(MappedStrictArray *mapped, int wait)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write the changes of the mapping back to the file with \c `msync`
+ *
+ * @param[in] mapped a pointer to \c `MappedStrictArray` type
+ * (if mapped is a null pointer then an error of invalid instance is returned)
+ * @param[in] wait non-zero to return once the pages are written, zero to only
+ * schedule the writes
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t sync_MappedStrictArray(MappedStrictArray *mapped, int wait) {
+  if (!mapped) return SEGFAULT;
+  if (msync(mapped->map, mapped->map_bytes, wait ? MS_SYNC : MS_ASYNC)) return IO_FAILURE;
+  return NO_ERROR;
+}
+
+#endif // __C_DSA_GENERIC_MAPPED_STRICT_ARRAY_H__
@@ -0,0 +1,368 @@
+/**
+ * @file RingBuffer.h
+ * @brief a generic lock-free single-producer/single-consumer ring buffer header
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details This library introduces a structure \c `RingBuffer`, a fixed capacity
+ * FIFO queue of \b `any types` made to hand elements from one thread (the
+ * producer) to another one (the consumer) without a lock.
+ * The layout follows \c `StrictArray` (\i `capacity`, \i `type_size` and the
+ * elements in \i `data`), but the size is not stored: the producer only writes
+ * \i `tail` and the consumer only writes \i `head`, both are C11 atomics on
+ * their own cache line, so the two threads never write to the same cache line
+ * (the elements apart). Each side also keeps a copy of the other side's counter
+ * and only reloads it when the queue looks full (or empty).
+ * The capacity is always a power of two, so a position is a counter masked by
+ * \i `mask` and the counters are never wrapped.
+ * At most one thread may call the try_push functions and one thread the
+ * try_pop functions at the same time, every other function must not run
+ * concurrently with them.
+ *
+ * RingBuffer's APIs:
+ * @li new_T : dynamically create type T on the heap
+ * @li init_T : create type T in a caller-provided buffer
+ * @li T_bytes_required : the size of the buffer \c `init_T` needs
+ * @li T_round_capacity : the capacity T gets for a requested capacity
+ * @li free_T : deallocate type T
+ * @li try_push_T : insert an element at the back of T if it is not full
+ * @li try_push_n_T : insert as many elements as possible at the back of T
+ * @li try_pop_T : remove the element at the front of T if it is not empty
+ * @li try_pop_n_T : remove as many elements as possible from the front of T
+ * @li size_T : the number of elements in T
+ */
+#ifndef __C_DSA_GENERIC_RING_BUFFER_H__
+#define __C_DSA_GENERIC_RING_BUFFER_H__
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+#include "../utils/checked.h"
+
+typedef struct RingBuffer RingBuffer;
+
+/**
+ * @struct RingBuffer
+ * @author andarling
+ * @date 14/10/2026
+ * @brief a fixed capacity queue shared by one producer and one consumer
+ *
+ * \i `head` is the number of elements ever popped (written by the consumer),
+ * \i `tail` the number of elements ever pushed (written by the producer),
+ * \i `cached_tail` and \i `cached_head` are the last values of the other
+ * side's counter seen by the consumer and the producer.
+ * The \i `allocator` which allocated the buffer is kept to deallocate it, it is
+ * a null pointer if the buffer lives in a caller-provided buffer.
+ */
+struct RingBuffer {
+  size_t capacity, type_size, mask;
+  const Allocator *allocator;
+  _Alignas(C_DSA_CACHE_LINE_SIZE) atomic_size_t head;
+  size_t cached_tail;
+  _Alignas(C_DSA_CACHE_LINE_SIZE) atomic_size_t tail;
+  size_t cached_head;
+  _Alignas(C_DSA_CACHE_LINE_SIZE) char data[];
+};
+
+/**
+ * @fn size_t RingBuffer_round_capacity(size_t cap)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the smallest power of two greater or equal to \i `cap`
+ *
+ * @return the capacity of a ring buffer created with \i `cap`, or 0 if it does
+ * not fit in a \c `size_t`
+ */
+C_DSA_API size_t RingBuffer_round_capacity(size_t cap) {
+  size_t result = 1;
+  while (result < cap) {
+    if (result > (size_t)-1 / 2) return 0;
+    result <<= 1;
+  }
+  return result;
+}
+
+/**
+ * @fn size_t RingBuffer_bytes_required(size_t cap, size_t type_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the size in bytes of a \c `RingBuffer` of \i `cap` elements
+ *
+ * @param[in] cap the desired capacity, rounded up to a power of two
+ * @param[in] type_size size of every elements in the buffer
+ *
+ * @return the number of bytes a buffer given to \c `init_RingBuffer` needs, or
+ * 0 if it does not fit in a \c `size_t`
+ */
+C_DSA_API size_t RingBuffer_bytes_required(size_t cap, size_t type_size) {
+  size_t capacity = RingBuffer_round_capacity(cap), bytes;
+  if (!capacity || checked_bytes(sizeof(RingBuffer), capacity, type_size, &bytes)) return 0;
+  return bytes;
+}
+
+/**
+ * @fn Result new_RingBuffer(size_t cap, size_t type_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to a new empty ring buffer
+ *
+ * The buffer is allocated with \c `aligned_alloc` so that the counters are on
+ * their own cache lines.
+ *
+ * @param[in] cap the desired capacity, rounded up to a power of two
+ * (cap > 0)
+ * @param[in] type_size size of every elements in the buffer
+ * (type_size > 0)
+ *
+ * @return a \c `Result` type to the successfully allocated data or a error message
+ */
+C_DSA_API Result new_RingBuffer(size_t cap, size_t type_size) {
+  if (cap <= 0 || type_size <= 0) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Capacity or type cannot be less than 1\n"
+    };
+  }
+  size_t capacity = RingBuffer_round_capacity(cap);
+  if (!capacity || capacity > ((size_t)-1 - sizeof(RingBuffer) - C_DSA_CACHE_LINE_SIZE) / type_size) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Capacity is too big\n"
+    };
+  }
+
+  // aligned_alloc wants a multiple of the alignment
+  size_t bytes = sizeof(RingBuffer) + type_size * capacity;
+  bytes = (bytes + C_DSA_CACHE_LINE_SIZE - 1) & ~(size_t)(C_DSA_CACHE_LINE_SIZE - 1);
+  RingBuffer *result = (RingBuffer*)aligned_alloc(_Alignof(RingBuffer), bytes);
+  if (!result) {
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+  result->capacity = capacity, result->type_size = type_size, result->mask = capacity - 1;
+  // heap_allocator frees with free, which accepts aligned_alloc blocks
+  result->allocator = &heap_allocator;
+  atomic_init(&result->head, 0);
+  atomic_init(&result->tail, 0);
+  result->cached_tail = result->cached_head = 0;
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn Result init_RingBuffer(void *buffer, size_t buffer_bytes, size_t type_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief lay out an empty \c `RingBuffer` in a caller-provided buffer
+ *
+ * No allocation is made, the buffer can live on the stack, in static or in
+ * shared memory and must outlive the ring buffer. The capacity is the biggest
+ * power of two of elements fitting in the buffer after the header.
+ * \c `free_RingBuffer` does not deallocate such a ring buffer.
+ *
+ * @param[in] buffer the storage of the ring buffer
+ * (aligned to \c `_Alignof(RingBuffer)`)
+ * @param[in] buffer_bytes the size of \i `buffer`
+ * (buffer_bytes >= \c `RingBuffer_bytes_required(1, type_size)`)
+ * @param[in] type_size size of every elements in the buffer
+ * (type_size > 0)
+ *
+ * @return a \c `Result` type to the ring buffer (at the address of \i `buffer`)
+ * or a error message
+ */
+C_DSA_API Result init_RingBuffer(void *buffer, size_t buffer_bytes, size_t type_size) {
+  if (!buffer) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  if ((size_t)buffer % _Alignof(RingBuffer)) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Buffer is not aligned for the ring buffer header\n"
+    };
+  }
+  if (type_size <= 0) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Type cannot have less than 1 byte\n"
+    };
+  }
+  if (buffer_bytes < sizeof(RingBuffer) + type_size) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Buffer cannot hold the header and one element\n"
+    };
+  }
+
+  size_t fit = (buffer_bytes - sizeof(RingBuffer)) / type_size, capacity = 1;
+  while (capacity <= fit / 2) capacity <<= 1;
+
+  RingBuffer *result = (RingBuffer*)buffer;
+  result->capacity = capacity, result->type_size = type_size, result->mask = capacity - 1;
+  result->allocator = NULL;
+  atomic_init(&result->head, 0);
+  atomic_init(&result->tail, 0);
+  result->cached_tail = result->cached_head = 0;
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn void free_RingBuffer(RingBuffer **rb)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief deallocate the data and set the pointer to NULL
+ *
+ * A ring buffer created by \c `init_RingBuffer` is not deallocated.
+ *
+ * @param[in] rb a pointer to the address of the data
+ * (if rb is a null pointer then exits the function)
+ *
+ * @return void
+ */
+C_DSA_API void free_RingBuffer(RingBuffer **rb) {
+  if (!rb || !*rb) return;
+  const Allocator *allocator = (*rb)->allocator;
+  if (allocator) allocator->free(allocator->ctx, *rb, sizeof(RingBuffer) + (*rb)->type_size * (*rb)->capacity);
+  *rb = NULL;
+}
+
+/**
+ * @fn size_t try_push_n_RingBuffer(RingBuffer *rb, void *src, size_t count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert up to \i `count` elements from \i `src` at the back of the queue
+ *
+ * Only called by the producer. The elements are copied with at most two
+ * \c `memcpy` and published to the consumer at once.
+ *
+ * @param[in] rb a pointer to \c `RingBuffer` type
+ * @param[in] src a pointer to the elements to insert
+ * @param[in] count the number of elements in \i `src`
+ *
+ * @return the number of elements inserted (0 if rb or src is a null pointer)
+ */
+C_DSA_API size_t try_push_n_RingBuffer(RingBuffer *rb, void *src, size_t count) {
+  if (!rb || !src) return 0;
+  size_t tail = atomic_load_explicit(&rb->tail, memory_order_relaxed);
+  size_t free_slots = rb->capacity - (tail - rb->cached_head);
+  if (free_slots < count) {
+    rb->cached_head = atomic_load_explicit(&rb->head, memory_order_acquire);
+    free_slots = rb->capacity - (tail - rb->cached_head);
+    if (count > free_slots) count = free_slots;
+  }
+  if (!count) return 0;
+
+  size_t type_size = rb->type_size, start = tail & rb->mask;
+  size_t first = rb->capacity - start < count ? rb->capacity - start : count;
+  memcpy(rb->data + type_size * start, src, type_size * first);
+  memcpy(rb->data, (char*)src + type_size * first, type_size * (count - first));
+  atomic_store_explicit(&rb->tail, tail + count, memory_order_release);
+  return count;
+}
+
+/**
+ * @fn status_t try_push_RingBuffer(RingBuffer *rb, void *value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert \i `value` at the back of the queue if it is not full
+ *
+ * Only called by the producer.
+ *
+ * @param[in] rb a pointer to \c `RingBuffer` type
+ * (if rb is a null pointer then an error of invalid instance is returned)
+ * @param[in] value a pointer to the value to insert
+ *
+ * @return 0 if success, \c `NO_SPACE` if the queue is full and non-zero if an
+ * error occurs
+ */
+C_DSA_API status_t try_push_RingBuffer(RingBuffer *rb, void *value) {
+  if (!rb || !value) return SEGFAULT;
+  return try_push_n_RingBuffer(rb, value, 1) ? NO_ERROR : NO_SPACE;
+}
+
+/**
+ * @fn size_t try_pop_n_RingBuffer(RingBuffer *rb, void *dst, size_t count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove up to \i `count` elements from the front of the queue into \i `dst`
+ *
+ * Only called by the consumer. The elements are copied with at most two
+ * \c `memcpy` and their slots are given back to the producer at once.
+ *
+ * @param[in] rb a pointer to \c `RingBuffer` type
+ * @param[in] dst a pointer to room for \i `count` elements
+ * @param[in] count the maximum number of elements to remove
+ *
+ * @return the number of elements removed (0 if rb or dst is a null pointer)
+ */
+C_DSA_API size_t try_pop_n_RingBuffer(RingBuffer *rb, void *dst, size_t count) {
+  if (!rb || !dst) return 0;
+  size_t head = atomic_load_explicit(&rb->head, memory_order_relaxed);
+  size_t available = rb->cached_tail - head;
+  if (available < count) {
+    rb->cached_tail = atomic_load_explicit(&rb->tail, memory_order_acquire);
+    available = rb->cached_tail - head;
+    if (count > available) count = available;
+  }
+  if (!count) return 0;
+
+  size_t type_size = rb->type_size, start = head & rb->mask;
+  size_t first = rb->capacity - start < count ? rb->capacity - start : count;
+  memcpy(dst, rb->data + type_size * start, type_size * first);
+  memcpy((char*)dst + type_size * first, rb->data, type_size * (count - first));
+  atomic_store_explicit(&rb->head, head + count, memory_order_release);
+  return count;
+}
+
+/**
+ * @fn status_t try_pop_RingBuffer(RingBuffer *rb, void *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove the element at the front of the queue into \i `out`
+ *
+ * Only called by the consumer.
+ *
+ * @param[in] rb a pointer to \c `RingBuffer` type
+ * (if rb is a null pointer then an error of invalid instance is returned)
+ * @param[out] out a pointer to room for one element
+ *
+ * @return 0 if success, \c `EMPTY_CONTAINER` if the queue is empty and non-zero
+ * if an error occurs
+ */
+C_DSA_API status_t try_pop_RingBuffer(RingBuffer *rb, void *out) {
+  if (!rb || !out) return SEGFAULT;
+  return try_pop_n_RingBuffer(rb, out, 1) ? NO_ERROR : EMPTY_CONTAINER;
+}
+
+/**
+ * @fn size_t size_RingBuffer(RingBuffer *rb)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the number of elements in the queue
+ *
+ * When the producer or the consumer is running, it is only a snapshot in
+ * [0, \i `capacity`].
+ */
+C_DSA_API size_t size_RingBuffer(RingBuffer *rb) {
+  if (!rb) return 0;
+  size_t head = atomic_load_explicit(&rb->head, memory_order_acquire);
+  size_t tail = atomic_load_explicit(&rb->tail, memory_order_acquire);
+  // head may have moved (and tail with it) between the two loads
+  return tail - head < rb->capacity ? tail - head : rb->capacity;
+}
+
+#endif // __C_DSA_GENERIC_RING_BUFFER_H__
@@ -0,0 +1,212 @@
+/**
+ * @file RingBuffer_template.h
+ * @brief a generator for type specialised lock-free ring buffers
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details \c `DEFINE_RING_BUFFER(T, suffix)` emits a structure
+ * \c `RingBuffer_suffix` holding elements of type \i `T` and the same APIs as
+ * the generic \c `RingBuffer`, with the same single-producer/single-consumer
+ * rules, but as \c `sizeof(T)` is known at compile time, single elements are
+ * copied with plain stores instead of a runtime-sized \c `memcpy`.
+ * \i `T` must be copyable by assignment (arithmetic types, pointers or structs).
+ *
+ * Generated APIs (T* stands for the element pointer, S for \c `RingBuffer_suffix`):
+ * @li Result new_S(size_t cap) : create an empty S on the heap, \i `cap` is
+ * rounded up to a power of two
+ * @li size_t S_bytes_required(size_t cap) : the size of a buffer holding S with
+ * \i `cap` elements
+ * @li Result init_S(void *buffer, size_t buffer_bytes) : lay out an empty S in a
+ * caller-provided buffer, without allocation
+ * @li void free_S(S **rb) : deallocate S (unless it was created by \i `init_S`)
+ * and set the pointer to NULL
+ * @li status_t try_push_S(S *rb, T value) : (producer) insert \i `value` at the
+ * back, \c `NO_SPACE` if S is full
+ * @li size_t try_push_n_S(S *rb, T *src, size_t count) : (producer) insert up to
+ * \i `count` values at the back, returns how many were inserted
+ * @li status_t try_pop_S(S *rb, T *out) : (consumer) remove the front element
+ * into \i `out`, \c `EMPTY_CONTAINER` if S is empty
+ * @li size_t try_pop_n_S(S *rb, T *dst, size_t count) : (consumer) remove up to
+ * \i `count` elements into \i `dst`, returns how many were removed
+ * @li size_t size_S(S *rb) : a snapshot of the number of elements
+ *
+ * Errors and edge cases behave exactly as in generic/RingBuffer.h.
+ */
+#ifndef __C_DSA_GENERIC_RING_BUFFER_TEMPLATE_H__
+#define __C_DSA_GENERIC_RING_BUFFER_TEMPLATE_H__
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+#include "../utils/checked.h"
+#include "RingBuffer.h"
+
+#define DEFINE_RING_BUFFER(T, suffix)                                          \
+  typedef struct RingBuffer_##suffix RingBuffer_##suffix;                      \
+                                                                               \
+  struct RingBuffer_##suffix {                                                 \
+    size_t capacity, mask;                                                     \
+    const Allocator *allocator;                                                \
+    _Alignas(C_DSA_CACHE_LINE_SIZE) atomic_size_t head;                        \
+    size_t cached_tail;                                                        \
+    _Alignas(C_DSA_CACHE_LINE_SIZE) atomic_size_t tail;                        \
+    size_t cached_head;                                                        \
+    _Alignas(C_DSA_CACHE_LINE_SIZE) T data[];                                  \
+  };                                                                           \
+                                                                               \
+  C_DSA_API size_t RingBuffer_##suffix##_bytes_required(size_t cap) {          \
+    size_t capacity = RingBuffer_round_capacity(cap), bytes;                   \
+    if (!capacity || checked_bytes(sizeof(RingBuffer_##suffix), capacity, sizeof(T), &bytes)) return 0; \
+    return bytes;                                                              \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result new_RingBuffer_##suffix(size_t cap) {                       \
+    size_t capacity = RingBuffer_round_capacity(cap);                          \
+    if (cap <= 0 || !capacity ||                                               \
+        capacity > ((size_t)-1 - sizeof(RingBuffer_##suffix) - C_DSA_CACHE_LINE_SIZE) / sizeof(T)) { \
+      return (Result) {                                                        \
+        .ok = INVALID_SIZE,                                                    \
+        .error_msg = "SizeError: Capacity is less than 1 or too big\n"         \
+      };                                                                       \
+    }                                                                          \
+                                                                               \
+    size_t bytes = sizeof(RingBuffer_##suffix) + sizeof(T) * capacity;         \
+    bytes = (bytes + C_DSA_CACHE_LINE_SIZE - 1) & ~(size_t)(C_DSA_CACHE_LINE_SIZE - 1); \
+    RingBuffer_##suffix *result = (RingBuffer_##suffix*)aligned_alloc(         \
+      _Alignof(RingBuffer_##suffix), bytes);                                   \
+    if (!result) {                                                             \
+      return (Result) {                                                        \
+        .ok = HEAP_FAILURE,                                                    \
+        .error_msg = "AllocationError: Not enough memory in the heap"          \
+      };                                                                       \
+    }                                                                          \
+    result->capacity = capacity, result->mask = capacity - 1;                  \
+    result->allocator = &heap_allocator;                                       \
+    atomic_init(&result->head, 0);                                             \
+    atomic_init(&result->tail, 0);                                             \
+    result->cached_tail = result->cached_head = 0;                             \
+    return (Result) {                                                          \
+      .ok = NO_ERROR,                                                          \
+      .data = result                                                           \
+    };                                                                         \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result init_RingBuffer_##suffix(void *buffer, size_t buffer_bytes) { \
+    if (!buffer) {                                                             \
+      return (Result) {                                                        \
+        .ok = SEGFAULT,                                                        \
+        .error_msg = "ValueError: cannot access a null pointer\n"              \
+      };                                                                       \
+    }                                                                          \
+    if ((size_t)buffer % _Alignof(RingBuffer_##suffix)) {                      \
+      return (Result) {                                                        \
+        .ok = INVALID_SIZE,                                                    \
+        .error_msg = "SizeError: Buffer is not aligned for the ring buffer header\n" \
+      };                                                                       \
+    }                                                                          \
+    if (buffer_bytes < sizeof(RingBuffer_##suffix) + sizeof(T)) {              \
+      return (Result) {                                                        \
+        .ok = INVALID_SIZE,                                                    \
+        .error_msg = "SizeError: Buffer cannot hold the header and one element\n" \
+      };                                                                       \
+    }                                                                          \
+    size_t fit = (buffer_bytes - sizeof(RingBuffer_##suffix)) / sizeof(T), capacity = 1; \
+    while (capacity <= fit / 2) capacity <<= 1;                                \
+                                                                               \
+    RingBuffer_##suffix *result = (RingBuffer_##suffix*)buffer;                \
+    result->capacity = capacity, result->mask = capacity - 1;                  \
+    result->allocator = NULL;                                                  \
+    atomic_init(&result->head, 0);                                             \
+    atomic_init(&result->tail, 0);                                             \
+    result->cached_tail = result->cached_head = 0;                             \
+    return (Result) {                                                          \
+      .ok = NO_ERROR,                                                          \
+      .data = result                                                           \
+    };                                                                         \
+  }                                                                            \
+                                                                               \
+  C_DSA_API void free_RingBuffer_##suffix(RingBuffer_##suffix **rb) {          \
+    if (!rb || !*rb) return;                                                   \
+    const Allocator *allocator = (*rb)->allocator;                             \
+    if (allocator) allocator->free(allocator->ctx, *rb,                        \
+                    sizeof(RingBuffer_##suffix) + sizeof(T) * (*rb)->capacity); \
+    *rb = NULL;                                                                \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t try_push_RingBuffer_##suffix(RingBuffer_##suffix *rb, T value) { \
+    if (!rb) return SEGFAULT;                                                  \
+    size_t tail = atomic_load_explicit(&rb->tail, memory_order_relaxed);       \
+    if (tail - rb->cached_head == rb->capacity) {                              \
+      rb->cached_head = atomic_load_explicit(&rb->head, memory_order_acquire); \
+      if (tail - rb->cached_head == rb->capacity) return NO_SPACE;             \
+    }                                                                          \
+    rb->data[tail & rb->mask] = value;                                         \
+    atomic_store_explicit(&rb->tail, tail + 1, memory_order_release);          \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API size_t try_push_n_RingBuffer_##suffix(RingBuffer_##suffix *rb,     \
+                                                  T *src, size_t count) {      \
+    if (!rb || !src) return 0;                                                 \
+    size_t tail = atomic_load_explicit(&rb->tail, memory_order_relaxed);       \
+    size_t free_slots = rb->capacity - (tail - rb->cached_head);               \
+    if (free_slots < count) {                                                  \
+      rb->cached_head = atomic_load_explicit(&rb->head, memory_order_acquire); \
+      free_slots = rb->capacity - (tail - rb->cached_head);                    \
+      if (count > free_slots) count = free_slots;                              \
+    }                                                                          \
+    if (!count) return 0;                                                      \
+                                                                               \
+    size_t start = tail & rb->mask;                                            \
+    size_t first = rb->capacity - start < count ? rb->capacity - start : count; \
+    memcpy(rb->data + start, src, sizeof(T) * first);                          \
+    memcpy(rb->data, src + first, sizeof(T) * (count - first));                \
+    atomic_store_explicit(&rb->tail, tail + count, memory_order_release);      \
+    return count;                                                              \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t try_pop_RingBuffer_##suffix(RingBuffer_##suffix *rb, T *out) { \
+    if (!rb || !out) return SEGFAULT;                                          \
+    size_t head = atomic_load_explicit(&rb->head, memory_order_relaxed);       \
+    if (head == rb->cached_tail) {                                             \
+      rb->cached_tail = atomic_load_explicit(&rb->tail, memory_order_acquire); \
+      if (head == rb->cached_tail) return EMPTY_CONTAINER;                     \
+    }                                                                          \
+    *out = rb->data[head & rb->mask];                                          \
+    atomic_store_explicit(&rb->head, head + 1, memory_order_release);          \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API size_t try_pop_n_RingBuffer_##suffix(RingBuffer_##suffix *rb,      \
+                                                 T *dst, size_t count) {       \
+    if (!rb || !dst) return 0;                                                 \
+    size_t head = atomic_load_explicit(&rb->head, memory_order_relaxed);       \
+    size_t available = rb->cached_tail - head;                                 \
+    if (available < count) {                                                   \
+      rb->cached_tail = atomic_load_explicit(&rb->tail, memory_order_acquire); \
+      available = rb->cached_tail - head;                                      \
+      if (count > available) count = available;                                \
+    }                                                                          \
+    if (!count) return 0;                                                      \
+                                                                               \
+    size_t start = head & rb->mask;                                            \
+    size_t first = rb->capacity - start < count ? rb->capacity - start : count; \
+    memcpy(dst, rb->data + start, sizeof(T) * first);                          \
+    memcpy(dst + first, rb->data, sizeof(T) * (count - first));                \
+    atomic_store_explicit(&rb->head, head + count, memory_order_release);      \
+    return count;                                                              \
+  }                                                                            \
+                                                                               \
+  C_DSA_API size_t size_RingBuffer_##suffix(RingBuffer_##suffix *rb) {         \
+    if (!rb) return 0;                                                         \
+    size_t head = atomic_load_explicit(&rb->head, memory_order_acquire);       \
+    size_t tail = atomic_load_explicit(&rb->tail, memory_order_acquire);       \
+    return tail - head < rb->capacity ? tail - head : rb->capacity;            \
+  }
+
+#endif // __C_DSA_GENERIC_RING_BUFFER_TEMPLATE_H__
@@ -0,0 +1,220 @@
+/**
+ * @file SharedStrictArray.h
+ * @brief a reference counted, copy-on-write generic strict array
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details This library introduces a structure \c `SharedStrictArray`, a
+ * \c `StrictArray` owned by every handle pointing to it with an atomic
+ * reference count. Cloning a handle only increments the count, so a snapshot
+ * of a big array is free until it is modified.
+ * Reading goes through \c `read_SharedStrictArray`. Writing goes through
+ * \c `mutable_SharedStrictArray`, which copies the array first if another
+ * handle still shares it, so the other handles never see the change.
+ * Every handle is owned by one thread at a time, different handles of the same
+ * array can be cloned, read, written and freed from different threads.
+ *
+ * SharedStrictArray's APIs:
+ * @li share_StrictArray : move a \c `StrictArray` into a new T
+ * @li clone_T : a new handle to the same array as T
+ * @li free_T : release a handle of T, the array is deallocated with the last one
+ * @li read_T : the array of T, for reading only
+ * @li mutable_T : the array of T, copied first if it is shared
+ * @li refcount_T : the number of handles sharing the array of T
+ */
+#ifndef __C_DSA_GENERIC_SHARED_STRICT_ARRAY_H__
+#define __C_DSA_GENERIC_SHARED_STRICT_ARRAY_H__
+
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+#include "StrictArray.h"
+
+typedef struct SharedStrictArray SharedStrictArray;
+
+/**
+ * @struct SharedStrictArray
+ * @author andarling
+ * @date 14/10/2026
+ * @brief a \c `StrictArray` with the number of handles owning it
+ *
+ * The structure is allocated by \i `allocator`, the allocator of the array (or
+ * the heap allocator), and freed by the last handle.
+ */
+struct SharedStrictArray {
+  atomic_size_t refs;
+  const Allocator *allocator;
+  StrictArray *array;
+};
+
+/**
+ * @brief a new handle owning \i `array` alone, or a null pointer
+ */
+C_DSA_API SharedStrictArray *wrap_SharedStrictArray(StrictArray *array) {
+  const Allocator *allocator = array->allocator ? array->allocator : &heap_allocator;
+  SharedStrictArray *shared = (SharedStrictArray*)allocator->alloc(allocator->ctx, sizeof(SharedStrictArray));
+  if (!shared) return NULL;
+  atomic_init(&shared->refs, 1);
+  shared->allocator = allocator;
+  shared->array = array;
+  return shared;
+}
+
+/**
+ * @fn Result share_StrictArray(StrictArray **arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief move the array into a new \c `SharedStrictArray` with one handle
+ *
+ * The elements are not copied, the array now belongs to the handles and
+ * \i `*arr` is set to NULL. An array living in a caller-provided buffer is
+ * copied on the heap first, the buffer can then be reused.
+ *
+ * @param[in,out] arr a pointer to the address of the array
+ * (if arr or *arr is a null pointer then an error of invalid instance is returned)
+ *
+ * @return a \c `Result` type to the handle or an error message
+ */
+C_DSA_API Result share_StrictArray(StrictArray **arr) {
+  if (!arr || !*arr) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+
+  StrictArray *array = *arr;
+  if (!array->allocator) {
+    Result copy = from_StrictArray(array);
+    if (copy.ok != NO_ERROR) return copy;
+    array = (StrictArray*)copy.data;
+  }
+  SharedStrictArray *shared = wrap_SharedStrictArray(array);
+  if (!shared) {
+    if (array != *arr) free_StrictArray(&array);
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+  *arr = NULL;
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = shared
+  };
+}
+
+/**
+ * @fn SharedStrictArray *clone_SharedStrictArray(SharedStrictArray *shared)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a new handle to the array of \i `shared`, without any copy
+ *
+ * @param[in] shared a handle
+ * (if shared is a null pointer then a null pointer is returned)
+ *
+ * @return the new handle, to be released by \c `free_SharedStrictArray`
+ */
+C_DSA_API SharedStrictArray *clone_SharedStrictArray(SharedStrictArray *shared) {
+  if (!shared) return NULL;
+  // the caller owns a handle, so the count cannot drop to 0 meanwhile
+  atomic_fetch_add_explicit(&shared->refs, 1, memory_order_relaxed);
+  return shared;
+}
+
+/**
+ * @fn void free_SharedStrictArray(SharedStrictArray **shared)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief release the handle and set the pointer to NULL
+ *
+ * The last handle deallocates the array.
+ *
+ * @param[in] shared a pointer to the handle
+ * (if shared is a null pointer then exits the function)
+ */
+C_DSA_API void free_SharedStrictArray(SharedStrictArray **shared) {
+  if (!shared || !*shared) return;
+  SharedStrictArray *block = *shared;
+  *shared = NULL;
+  if (atomic_fetch_sub_explicit(&block->refs, 1, memory_order_release) != 1) return;
+  // every write made through the other handles happens before the deallocation
+  atomic_thread_fence(memory_order_acquire);
+  const Allocator *allocator = block->allocator;
+  free_StrictArray(&block->array);
+  allocator->free(allocator->ctx, block, sizeof(SharedStrictArray));
+}
+
+/**
+ * @fn const StrictArray *read_SharedStrictArray(const SharedStrictArray *shared)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the array of the handle, which must not be modified
+ *
+ * The pointer is valid until the handle is released or made mutable.
+ *
+ * @return the array, or a null pointer if \i `shared` is a null pointer
+ */
+C_DSA_API const StrictArray *read_SharedStrictArray(const SharedStrictArray *shared) {
+  return shared ? shared->array : NULL;
+}
+
+/**
+ * @fn status_t mutable_SharedStrictArray(SharedStrictArray **shared, StrictArray **out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write to \i `out` the array of the handle, which can be modified
+ *
+ * If the handle is the only one, its array is returned as is. Otherwise the
+ * array is copied (with the same capacity), \i `*shared` becomes the only
+ * handle of the copy and releases the shared array.
+ *
+ * @param[in,out] shared a pointer to the handle
+ * (if shared or *shared is a null pointer then an error of invalid instance is returned)
+ * @param[out] out the array
+ * (out is not a null pointer)
+ *
+ * @return 0 if success and non-zero if the copy cannot be allocated, in which
+ * case the handle is left untouched
+ */
+C_DSA_API status_t mutable_SharedStrictArray(SharedStrictArray **shared, StrictArray **out) {
+  if (!shared || !*shared || !out) return SEGFAULT;
+  SharedStrictArray *block = *shared;
+  // a count of 1 cannot grow behind our back: only this handle could clone it
+  if (atomic_load_explicit(&block->refs, memory_order_acquire) == 1) {
+    *out = block->array;
+    return NO_ERROR;
+  }
+
+  Result copy = from_StrictArray(block->array);
+  if (copy.ok != NO_ERROR) return copy.ok;
+  StrictArray *array = (StrictArray*)copy.data;
+  SharedStrictArray *unique = wrap_SharedStrictArray(array);
+  if (!unique) {
+    free_StrictArray(&array);
+    return HEAP_FAILURE;
+  }
+  free_SharedStrictArray(shared);
+  *shared = unique;
+  *out = array;
+  return NO_ERROR;
+}
+
+/**
+ * @fn size_t refcount_SharedStrictArray(const SharedStrictArray *shared)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the number of handles sharing the array of \i `shared`
+ *
+ * The count can change at any time if other threads own handles.
+ */
+C_DSA_API size_t refcount_SharedStrictArray(const SharedStrictArray *shared) {
+  if (!shared) return 0;
+  return atomic_load_explicit((atomic_size_t*)&shared->refs, memory_order_relaxed);
+}
+
+#endif // __C_DSA_GENERIC_SHARED_STRICT_ARRAY_H__
@@ -0,0 +1,218 @@
+/**
+ * @file SmallArray_template.h
+ * @brief a generator for type specialised arrays with an inline buffer
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details \c `DEFINE_SMALL_ARRAY(T, N, suffix)` emits a structure
+ * \c `SmallArray_suffix` holding up to \i `N` elements of type \i `T` inside
+ * the structure itself, and the APIs to fill it.
+ * Unlike the other arrays, a small array is not created by a \c `new_`
+ * function: the structure is declared by the caller (on the stack, in another
+ * structure, in an array of structures) and initialised by \c `init_S`, so an
+ * array of at most \i `N` elements costs no allocation at all and its elements
+ * sit next to its header.
+ * When it grows beyond \i `N` elements, the elements spill to a block of its
+ * \c `Allocator`, the inline buffer then holds the pointer to that block, and
+ * \c `destroy_S` must be called to release it. As the structure holds no
+ * pointer to itself, it can be moved with \c `memcpy` or an assignment (the
+ * source must not be used afterwards).
+ * \i `N` must be a positive constant, \i `T` must be copyable by assignment.
+ *
+ * Generated APIs (S stands for \c `SmallArray_suffix`):
+ * @li status_t init_S(S *arr) : initialise an empty S spilling to the heap
+ * @li status_t init_S_with_allocator(S *arr, const Allocator *allocator) :
+ * initialise an empty S spilling through \i `allocator`
+ * @li void destroy_S(S *arr) : release the spilled elements, S is left empty
+ * and can be used again
+ * @li int is_inline_S(const S *arr) : \c `static inline` non-zero while the
+ * elements are stored in the structure
+ * @li status_t reserve_S(S *arr, size_t cap) : make sure S can hold at least
+ * \i `cap` elements
+ * @li status_t shrink_to_fit_S(S *arr) : reduce the capacity of S to its size,
+ * moving the elements back inline if they fit
+ * @li status_t push_back_S(S *arr, T value) : insert \i `value` on last
+ * position, growing if needed
+ * @li status_t append_range_S(S *arr, const T *src, size_t count) : insert
+ * \i `count` values on last positions, growing at most once (\i `src` may point
+ * to elements of S)
+ * @li void pop_back_S(S *arr) : remove last element
+ * @li void pop_back_n_S(S *arr, size_t count) : remove the last \i `count` elements
+ * @li void clear_S(S *arr) : remove all elements, keeping the capacity
+ * @li T *get_item_S(S *arr, size_t index) : pointer to the \i `index`-th element,
+ * or a null pointer if out of [0, \i `size` - 1]
+ * @li T *at_unchecked_S(S *arr, size_t index) : \c `static inline` pointer to the
+ * \i `index`-th element without any check (index in [0, \i `size` - 1])
+ * @li T *data_ptr_S(S *arr), T *begin_S(S *arr), T *end_S(S *arr) :
+ * \c `static inline` pointers to the first and past the last elements
+ *
+ * The pointers to the elements are invalidated by every function that may
+ * grow or shrink S.
+ */
+#ifndef __C_DSA_GENERIC_SMALL_ARRAY_TEMPLATE_H__
+#define __C_DSA_GENERIC_SMALL_ARRAY_TEMPLATE_H__
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Allocator.h"
+#include "../utils/checked.h"
+
+#ifndef C_DSA_SMALL_ARRAY_CAPACITY
+#define C_DSA_SMALL_ARRAY_CAPACITY 16
+#endif
+
+#define DEFINE_SMALL_ARRAY(T, N, suffix)                                       \
+  _Static_assert((N) > 0, "the inline capacity of a small array must be positive"); \
+                                                                               \
+  typedef struct SmallArray_##suffix SmallArray_##suffix;                      \
+                                                                               \
+  struct SmallArray_##suffix {                                                 \
+    /* the elements are inline while capacity == N */                          \
+    size_t size, capacity;                                                     \
+    const Allocator *allocator;                                                \
+    union {                                                                    \
+      T buffer[N];                                                             \
+      T *heap;                                                                 \
+    } storage;                                                                 \
+  };                                                                           \
+                                                                               \
+  static inline int is_inline_SmallArray_##suffix(const SmallArray_##suffix *arr) { \
+    return arr->capacity == (N);                                               \
+  }                                                                            \
+                                                                               \
+  static inline T *data_ptr_SmallArray_##suffix(SmallArray_##suffix *arr) {    \
+    return arr->capacity == (N) ? arr->storage.buffer : arr->storage.heap;     \
+  }                                                                            \
+                                                                               \
+  static inline T *begin_SmallArray_##suffix(SmallArray_##suffix *arr) {       \
+    return data_ptr_SmallArray_##suffix(arr);                                  \
+  }                                                                            \
+                                                                               \
+  static inline T *end_SmallArray_##suffix(SmallArray_##suffix *arr) {         \
+    return data_ptr_SmallArray_##suffix(arr) + arr->size;                      \
+  }                                                                            \
+                                                                               \
+  static inline T *at_unchecked_SmallArray_##suffix(SmallArray_##suffix *arr, size_t index) { \
+    return data_ptr_SmallArray_##suffix(arr) + index;                          \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t init_SmallArray_##suffix##_with_allocator(SmallArray_##suffix *arr, \
+                                                    const Allocator *allocator) { \
+    if (!arr || !allocator) return SEGFAULT;                                   \
+    arr->size = 0, arr->capacity = (N);                                        \
+    arr->allocator = allocator;                                                \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t init_SmallArray_##suffix(SmallArray_##suffix *arr) {      \
+    return init_SmallArray_##suffix##_with_allocator(arr, &heap_allocator);    \
+  }                                                                            \
+                                                                               \
+  C_DSA_API void destroy_SmallArray_##suffix(SmallArray_##suffix *arr) {       \
+    if (!arr) return;                                                          \
+    if (arr->capacity != (N)) {                                                \
+      arr->allocator->free(arr->allocator->ctx, arr->storage.heap, sizeof(T) * arr->capacity); \
+    }                                                                          \
+    arr->size = 0, arr->capacity = (N);                                        \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t reserve_SmallArray_##suffix(SmallArray_##suffix *arr, size_t cap) { \
+    if (!arr) return SEGFAULT;                                                 \
+    if (cap <= arr->capacity) return NO_ERROR;                                 \
+    const Allocator *allocator = arr->allocator;                               \
+    size_t bytes;                                                              \
+    if (checked_mul(cap, sizeof(T), &bytes)) return INVALID_SIZE;              \
+    T *grown;                                                                  \
+    if (arr->capacity == (N)) {                                                \
+      grown = (T*)allocator->alloc(allocator->ctx, bytes);                     \
+      if (!grown) return HEAP_FAILURE;                                         \
+      if (arr->size) memcpy(grown, arr->storage.buffer, sizeof(T) * arr->size); \
+    }                                                                          \
+    else {                                                                     \
+      grown = (T*)allocator->realloc(allocator->ctx, arr->storage.heap,        \
+                                     sizeof(T) * arr->capacity, bytes);        \
+      if (!grown) return HEAP_FAILURE;                                         \
+    }                                                                          \
+    arr->storage.heap = grown;                                                 \
+    arr->capacity = cap;                                                       \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t shrink_to_fit_SmallArray_##suffix(SmallArray_##suffix *arr) { \
+    if (!arr) return SEGFAULT;                                                 \
+    if (arr->capacity == (N) || arr->size == arr->capacity) return NO_ERROR;   \
+    const Allocator *allocator = arr->allocator;                               \
+    T *heap = arr->storage.heap;                                               \
+    if (arr->size <= (N)) {                                                    \
+      memmove(arr->storage.buffer, heap, sizeof(T) * arr->size);               \
+      allocator->free(allocator->ctx, heap, sizeof(T) * arr->capacity);        \
+      arr->capacity = (N);                                                     \
+      return NO_ERROR;                                                         \
+    }                                                                          \
+    T *shrunk = (T*)allocator->realloc(allocator->ctx, heap, sizeof(T) * arr->capacity, \
+                                       sizeof(T) * arr->size);                 \
+    if (!shrunk) return HEAP_FAILURE;                                          \
+    arr->storage.heap = shrunk;                                                \
+    arr->capacity = arr->size;                                                 \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t grow_SmallArray_##suffix(SmallArray_##suffix *arr, size_t needed) { \
+    size_t cap = arr->capacity > SIZE_MAX / 2 ? SIZE_MAX : arr->capacity * 2;  \
+    if (cap < needed) cap = needed;                                            \
+    return reserve_SmallArray_##suffix(arr, cap);                              \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t push_back_SmallArray_##suffix(SmallArray_##suffix *arr, T value) { \
+    if (!arr) return SEGFAULT;                                                 \
+    if (arr->size == arr->capacity) {                                          \
+      status_t status = grow_SmallArray_##suffix(arr, arr->size + 1);          \
+      if (status != NO_ERROR) return status;                                   \
+    }                                                                          \
+    data_ptr_SmallArray_##suffix(arr)[arr->size++] = value;                    \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t append_range_SmallArray_##suffix(SmallArray_##suffix *arr, const T *src, \
+                                                       size_t count) {         \
+    if (!arr || (!src && count)) return SEGFAULT;                              \
+    if (count > arr->capacity - arr->size) {                                   \
+      size_t needed;                                                           \
+      if (checked_add(arr->size, count, &needed)) return INVALID_SIZE;         \
+      /* src may point to elements of the array, which move when it grows */   \
+      const T *data = data_ptr_SmallArray_##suffix(arr);                       \
+      int inside = src >= data && src < data + arr->size;                      \
+      size_t offset = inside ? (size_t)(src - data) : 0;                       \
+      status_t status = grow_SmallArray_##suffix(arr, needed);                 \
+      if (status != NO_ERROR) return status;                                   \
+      if (inside) src = data_ptr_SmallArray_##suffix(arr) + offset;            \
+    }                                                                          \
+    if (count) memcpy(data_ptr_SmallArray_##suffix(arr) + arr->size, src, sizeof(T) * count); \
+    arr->size += count;                                                        \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API void pop_back_SmallArray_##suffix(SmallArray_##suffix *arr) {      \
+    if (!arr) return;                                                          \
+    if (arr->size) arr->size--;                                                \
+  }                                                                            \
+                                                                               \
+  C_DSA_API void pop_back_n_SmallArray_##suffix(SmallArray_##suffix *arr, size_t count) { \
+    if (!arr) return;                                                          \
+    arr->size = count < arr->size ? arr->size - count : 0;                     \
+  }                                                                            \
+                                                                               \
+  C_DSA_API void clear_SmallArray_##suffix(SmallArray_##suffix *arr) {         \
+    if (!arr) return;                                                          \
+    arr->size = 0;                                                             \
+  }                                                                            \
+                                                                               \
+  C_DSA_API T *get_item_SmallArray_##suffix(SmallArray_##suffix *arr, size_t index) { \
+    if (!arr || index >= arr->size) return NULL;                               \
+    return data_ptr_SmallArray_##suffix(arr) + index;                          \
+  }
+
+#endif // __C_DSA_GENERIC_SMALL_ARRAY_TEMPLATE_H__
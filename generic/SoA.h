@@ -0,0 +1,355 @@
+/**
+ * @file SoA.h
+ * @brief a generic structure of arrays header
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details This library introduces a structure \c `SoA` that stores records of
+ * several fields column by column: every field has its own contiguous column
+ * and all the columns share one \i `size` and \i `capacity`, like a
+ * \c `StrictArray` per field. A scan over one field then reads a contiguous
+ * run of values instead of striding through whole records.
+ * The fields are described by their sizes and, optionally, their offsets in a
+ * row, so that rows can be read from and written to a C structure, e.g.
+ * \c `offsetof(struct record, field)`. Without offsets, a row is the fields
+ * packed one after another.
+ * The header, the field description and every column are one allocation, the
+ * columns are aligned to \c `_Alignof(max_align_t)` from the allocation.
+ * As in a \c `StrictArray`, rows are only appended and removed at the end and
+ * once \i `size` reaches \i `capacity` no row can be appended.
+ *
+ * SoA's APIs:
+ * @li new_T : dynamically create type T on the heap
+ * @li new_T_with_allocator : dynamically create type T with an \c `Allocator`
+ * @li free_T : deallocate type T
+ * @li push_back_T : append a row to type T
+ * @li pop_back_T : remove the last row of type T
+ * @li clear_T : remove every row of type T
+ * @li scatter_T : write a row of type T from a record
+ * @li gather_T : read a row of type T into a record
+ * @li column_T : the pointer to the first value of a field of type T
+ * @li get_field_T : the pointer to a field of a row of type T
+ * @li view_column_T : an \c `ArrayView` over a field of type T
+ */
+#ifndef __C_DSA_GENERIC_SOA_H__
+#define __C_DSA_GENERIC_SOA_H__
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+#include "../utils/checked.h"
+#include "ArrayView.h"
+
+typedef struct SoA SoA;
+
+/**
+ * @struct SoA
+ * @author andarling
+ * @date 14/10/2026
+ * @brief \i `field_count` columns of \i `capacity` values sharing one \i `size`
+ *
+ * \i `meta` holds the size of every field, then its offset in a row, then the
+ * offset of its column from the start of the structure. \i `row_bytes` is the
+ * smallest record holding every field at its offset.
+ */
+struct SoA {
+  size_t size, capacity, field_count, row_bytes;
+  const Allocator *allocator;
+  size_t meta[];
+};
+
+/**
+ * @brief the size in bytes of a \c `SoA`, whose column offsets are written to
+ * \i `columns` if it is not a null pointer, or 0 if it does not fit in a
+ * \c `size_t`
+ */
+C_DSA_API size_t SoA_bytes(const size_t *field_sizes, size_t field_count, size_t cap, size_t *columns) {
+  size_t align = _Alignof(max_align_t), bytes, column;
+  if (checked_bytes(sizeof(SoA), field_count, sizeof(size_t) * 3, &bytes)) return 0;
+  for (size_t i = 0; i < field_count; i++) {
+    if (checked_add(bytes, align - 1, &bytes)) return 0;
+    bytes = bytes / align * align;
+    if (columns) columns[i] = bytes;
+    if (checked_mul(field_sizes[i], cap, &column) || checked_add(bytes, column, &bytes)) return 0;
+  }
+  return bytes;
+}
+
+/**
+ * @fn Result new_SoA_with_allocator(const size_t *field_sizes, const size_t *field_offsets, size_t field_count, size_t cap, const Allocator *allocator)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to an empty \c `SoA` allocated by \i `allocator`
+ *
+ * @param[in] field_sizes the size of every field
+ * (field_sizes is not a null pointer and every size > 0)
+ * @param[in] field_offsets the offset of every field in a row
+ * (if null pointer then the fields are packed in order, else every offset plus
+ * the size of its field must fit in a \c `size_t`)
+ * @param[in] field_count the number of fields
+ * (field_count > 0)
+ * @param[in] cap the number of rows the columns can hold
+ * @param[in] allocator the allocator to use, it must outlive the array
+ * (allocator is not a null pointer)
+ *
+ * @return a \c `Result` type to the successfully allocated data or a error message
+ */
+C_DSA_API Result new_SoA_with_allocator(const size_t *field_sizes, const size_t *field_offsets,
+                                        size_t field_count, size_t cap, const Allocator *allocator) {
+  if (!field_sizes || !allocator) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  if (!field_count) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: A record cannot have less than 1 field\n"
+    };
+  }
+  for (size_t i = 0; i < field_count; i++) {
+    if (!field_sizes[i]) {
+      return (Result) {
+        .ok = INVALID_SIZE,
+        .error_msg = "SizeError: Field cannot have less than 1 byte\n"
+      };
+    }
+  }
+  // the offsets come from the caller, the end of a field must fit in a size_t
+  size_t row_bytes = 0, field_end;
+  for (size_t i = 0; i < field_count; i++) {
+    if (checked_add(field_offsets ? field_offsets[i] : row_bytes, field_sizes[i], &field_end)) {
+      return (Result) {
+        .ok = INVALID_SIZE,
+        .error_msg = "SizeError: Field offset is too big\n"
+      };
+    }
+    if (field_end > row_bytes) row_bytes = field_end;
+  }
+
+  size_t bytes = SoA_bytes(field_sizes, field_count, cap, NULL);
+  if (!bytes) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Capacity is too big\n"
+    };
+  }
+  SoA *result = (SoA*)allocator->alloc(allocator->ctx, bytes);
+  if (!result) {
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+  result->size = 0, result->capacity = cap, result->field_count = field_count;
+  result->allocator = allocator;
+  size_t *sizes = result->meta, *offsets = sizes + field_count;
+  SoA_bytes(field_sizes, field_count, cap, offsets + field_count);
+  for (size_t i = 0, packed = 0; i < field_count; i++) {
+    sizes[i] = field_sizes[i];
+    offsets[i] = field_offsets ? field_offsets[i] : packed;
+    packed += sizes[i];
+  }
+  result->row_bytes = row_bytes;
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn Result new_SoA(const size_t *field_sizes, const size_t *field_offsets, size_t field_count, size_t cap)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to an empty \c `SoA` allocated on the heap
+ *
+ * See \c `new_SoA_with_allocator` for the parameters.
+ */
+C_DSA_API Result new_SoA(const size_t *field_sizes, const size_t *field_offsets, size_t field_count, size_t cap) {
+  return new_SoA_with_allocator(field_sizes, field_offsets, field_count, cap, &heap_allocator);
+}
+
+/**
+ * @fn void free_SoA(SoA **soa)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief deallocate the columns and set the pointer to NULL
+ *
+ * @param[in] soa a pointer to the address of the data
+ * (if soa is a null pointer then exits the function)
+ */
+C_DSA_API void free_SoA(SoA **soa) {
+  if (!soa || !*soa) return;
+  const Allocator *allocator = (*soa)->allocator;
+  allocator->free(allocator->ctx, *soa, SoA_bytes((*soa)->meta, (*soa)->field_count, (*soa)->capacity, NULL));
+  *soa = NULL;
+}
+
+/**
+ * @fn static inline char *column_unchecked_SoA(const SoA *soa, size_t field)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the first value of \i `field` without any check
+ */
+static inline char *column_unchecked_SoA(const SoA *soa, size_t field) {
+  return (char*)soa + soa->meta[2 * soa->field_count + field];
+}
+
+/**
+ * @fn status_t scatter_SoA(SoA *soa, size_t index, const void *row)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write every field of the record \i `row` to the row \i `index`
+ *
+ * @param[in] soa a pointer to \c `SoA` type
+ * (if soa is a null pointer then an error of invalid instance is returned)
+ * @param[in] index the row to write
+ * (index in [0, \i `size` - 1], else \c `INVALID_INDEX` is returned)
+ * @param[in] row the record, holding every field at its offset
+ * (row is not a null pointer)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t scatter_SoA(SoA *soa, size_t index, const void *row) {
+  if (!soa || !row) return SEGFAULT;
+  if (index >= soa->size) return INVALID_INDEX;
+  const size_t *sizes = soa->meta, *offsets = sizes + soa->field_count;
+  for (size_t i = 0; i < soa->field_count; i++) {
+    memcpy(column_unchecked_SoA(soa, i) + sizes[i] * index, (const char*)row + offsets[i], sizes[i]);
+  }
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t gather_SoA(const SoA *soa, size_t index, void *row)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief read every field of the row \i `index` into the record \i `row`
+ *
+ * Only the bytes of the fields are written, the padding of \i `row` is left
+ * untouched.
+ *
+ * @param[in] soa a pointer to \c `SoA` type
+ * (if soa is a null pointer then an error of invalid instance is returned)
+ * @param[in] index the row to read
+ * (index in [0, \i `size` - 1], else \c `INVALID_INDEX` is returned)
+ * @param[out] row the record, of at least \i `row_bytes` bytes
+ * (row is not a null pointer)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t gather_SoA(const SoA *soa, size_t index, void *row) {
+  if (!soa || !row) return SEGFAULT;
+  if (index >= soa->size) return INVALID_INDEX;
+  const size_t *sizes = soa->meta, *offsets = sizes + soa->field_count;
+  for (size_t i = 0; i < soa->field_count; i++) {
+    memcpy((char*)row + offsets[i], column_unchecked_SoA(soa, i) + sizes[i] * index, sizes[i]);
+  }
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t push_back_SoA(SoA *soa, const void *row)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief append the record \i `row` as the last row
+ *
+ * @param[in] soa a pointer to \c `SoA` type
+ * (if soa is a null pointer then an error of invalid instance is returned)
+ * @param[in] row the record, holding every field at its offset
+ * (row is not a null pointer)
+ *
+ * @return 0 if success and non-zero if an error occurs (\c `NO_SPACE` if full)
+ */
+C_DSA_API status_t push_back_SoA(SoA *soa, const void *row) {
+  if (!soa || !row) return SEGFAULT;
+  if (soa->size == soa->capacity) return NO_SPACE;
+  soa->size++;
+  return scatter_SoA(soa, soa->size - 1, row);
+}
+
+/**
+ * @fn void pop_back_SoA(SoA *soa)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove the last row
+ *
+ * @param[in] soa a pointer to \c `SoA` type
+ * (if soa is a null pointer then exits the function)
+ */
+C_DSA_API void pop_back_SoA(SoA *soa) {
+  if (!soa) return;
+  if (soa->size) soa->size--;
+}
+
+/**
+ * @fn void clear_SoA(SoA *soa)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove every row
+ */
+C_DSA_API void clear_SoA(SoA *soa) {
+  if (!soa) return;
+  soa->size = 0;
+}
+
+/**
+ * @fn void *column_SoA(SoA *soa, size_t field)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the first value of \i `field`
+ *
+ * The values of the field are contiguous, \i `size` of them are valid.
+ *
+ * @return the pointer, or a null pointer if \i `field` is out of
+ * [0, \i `field_count` - 1]
+ */
+C_DSA_API void *column_SoA(SoA *soa, size_t field) {
+  if (!soa || field >= soa->field_count) return NULL;
+  return column_unchecked_SoA(soa, field);
+}
+
+/**
+ * @fn void *get_field_SoA(SoA *soa, size_t field, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the value of \i `field` in the row \i `index`
+ *
+ * @return the pointer, or a null pointer if \i `field` or \i `index` is out of
+ * bound
+ */
+C_DSA_API void *get_field_SoA(SoA *soa, size_t field, size_t index) {
+  if (!soa || field >= soa->field_count || index >= soa->size) return NULL;
+  return column_unchecked_SoA(soa, field) + soa->meta[field] * index;
+}
+
+/**
+ * @fn status_t view_column_SoA(SoA *soa, size_t field, ArrayView *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write to \i `out` a contiguous view over the \i `size` values of \i `field`
+ *
+ * The view can be given to the algorithms of generic/algorithms.h, note that
+ * sorting a column reorders that field only.
+ *
+ * @param[in] soa a pointer to \c `SoA` type
+ * (if soa is a null pointer then an error of invalid instance is returned)
+ * @param[in] field the field of the view
+ * (field in [0, \i `field_count` - 1], else \c `INVALID_INDEX` is returned)
+ * @param[out] out the view
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t view_column_SoA(SoA *soa, size_t field, ArrayView *out) {
+  if (!soa) return SEGFAULT;
+  if (field >= soa->field_count) return INVALID_INDEX;
+  return strided_bytes(column_unchecked_SoA(soa, field), soa->size, soa->meta[field], 1, 0, soa->size, 1, out);
+}
+
+#endif // __C_DSA_GENERIC_SOA_H__
@@ -0,0 +1,170 @@
+/**
+ * @file Stack.h
+ * @brief a generic fixed capacity stack adaptor over \c `StrictArray`
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details A \c `Stack` is a \c `StrictArray` (the type is an alias), whose
+ * last element is the top: pushing and popping are the appends and removals
+ * of the array, so every \c `StrictArray` function also works on a stack, e.g.
+ * \c `from_StrictArray` to clone it or \c `FOREACH_StrictArray` to walk it from
+ * the bottom. The functions below add the stack vocabulary, copying popped
+ * elements out and moving many elements with one capacity check and one copy.
+ *
+ * Stack's APIs:
+ * @li new_T : dynamically create an empty type T on the heap
+ * @li new_T_with_allocator : dynamically create type T with an \c `Allocator`
+ * @li free_T : deallocate type T
+ * @li push_T : insert an element on top of T
+ * @li push_n_T : insert many elements on top of T
+ * @li pop_T : remove the top element of T
+ * @li pop_n_T : remove many elements from the top of T
+ * @li peek_T : get the pointer to the top element of T
+ */
+#ifndef __C_DSA_GENERIC_STACK_H__
+#define __C_DSA_GENERIC_STACK_H__
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+#include "StrictArray.h"
+
+typedef StrictArray Stack;
+
+/**
+ * @fn Result new_Stack_with_allocator(size_t cap, size_t type_size, const Allocator *allocator)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to an empty stack allocated by \i `allocator`
+ *
+ * @param[in] cap the number of elements the stack can hold
+ * @param[in] type_size size of every elements in the stack
+ * (type_size > 0)
+ * @param[in] allocator the allocator to use, it must outlive the stack
+ * (allocator is not a null pointer)
+ *
+ * @return a \c `Result` type to the successfully allocated stack or a error message
+ */
+C_DSA_API Result new_Stack_with_allocator(size_t cap, size_t type_size, const Allocator *allocator) {
+  return new_StrictArray_with_allocator(NULL, 0, cap, type_size, allocator);
+}
+
+/**
+ * @fn Result new_Stack(size_t cap, size_t type_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `new_Stack_with_allocator` on the heap
+ */
+C_DSA_API Result new_Stack(size_t cap, size_t type_size) {
+  return new_StrictArray_with_allocator(NULL, 0, cap, type_size, &heap_allocator);
+}
+
+/**
+ * @fn void free_Stack(Stack **stack)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief deallocate the stack and set the pointer to NULL
+ */
+C_DSA_API void free_Stack(Stack **stack) {
+  free_StrictArray(stack);
+}
+
+/**
+ * @fn status_t push_Stack(Stack *stack, void *value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert \i `value` on top of the stack
+ *
+ * @param[in] stack a pointer to \c `Stack` type
+ * (if stack is a null pointer then an error of invalid instance is returned)
+ * @param[in] value a pointer to the element to copy
+ *
+ * @return 0 if success, \c `NO_SPACE` if the stack is full
+ */
+C_DSA_API status_t push_Stack(Stack *stack, void *value) {
+  if (!stack || !value) return SEGFAULT;
+  return push_back_StrictArray(stack, value);
+}
+
+/**
+ * @fn status_t push_n_Stack(Stack *stack, void *src, size_t count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert the \i `count` elements of \i `src` on top of the stack, the
+ * last one ends on top
+ *
+ * Either every element is pushed or none.
+ *
+ * @return 0 if success, \c `NO_SPACE` if they do not fit
+ */
+C_DSA_API status_t push_n_Stack(Stack *stack, void *src, size_t count) {
+  return append_range_StrictArray(stack, src, count);
+}
+
+/**
+ * @fn status_t pop_Stack(Stack *stack, void *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove the top element of the stack
+ *
+ * @param[in] stack a pointer to \c `Stack` type
+ * (if stack is a null pointer then an error of invalid instance is returned)
+ * @param[out] out a pointer to room for one element
+ * (if null pointer then the element is dropped)
+ *
+ * @return 0 if success, \c `EMPTY_CONTAINER` if the stack is empty
+ */
+C_DSA_API status_t pop_Stack(Stack *stack, void *out) {
+  if (!stack) return SEGFAULT;
+  if (!stack->size) return EMPTY_CONTAINER;
+  if (out) memcpy(out, stack->data + stack->type_size * (stack->size - 1), stack->type_size);
+  pop_back_StrictArray(stack);
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t pop_n_Stack(Stack *stack, void *dst, size_t count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove the \i `count` top elements of the stack
+ *
+ * The elements are copied in the order they were pushed (the top one last), so
+ * \c `pop_n_Stack` gives back what \c `push_n_Stack` pushed.
+ *
+ * @param[in] stack a pointer to \c `Stack` type
+ * (if stack is a null pointer then an error of invalid instance is returned)
+ * @param[out] dst a pointer to room for \i `count` elements
+ * (if null pointer then the elements are dropped)
+ * @param[in] count the number of elements
+ * (count <= size)
+ *
+ * @return 0 if success, \c `INVALID_SIZE` if the stack holds less than
+ * \i `count` elements, in which case nothing is removed
+ */
+C_DSA_API status_t pop_n_Stack(Stack *stack, void *dst, size_t count) {
+  if (!stack) return SEGFAULT;
+  if (count > stack->size) return INVALID_SIZE;
+  if (dst && count) {
+    memcpy(dst, stack->data + stack->type_size * (stack->size - count), stack->type_size * count);
+  }
+  pop_back_n_StrictArray(stack, count);
+  return NO_ERROR;
+}
+
+/**
+ * @fn void *peek_Stack(Stack *stack)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief get the pointer to the top element, or a null pointer if the stack
+ * is empty
+ */
+C_DSA_API void *peek_Stack(Stack *stack) {
+  if (!stack || !stack->size) return NULL;
+  return stack->data + stack->type_size * (stack->size - 1);
+}
+
+#endif // __C_DSA_GENERIC_STACK_H__
@@ -15,11 +15,27 @@
  * 
  * Array's APIs:
  * @li new_T : dynamically create type T on the heap
+ * @li new_T_with_allocator : dynamically create type T with an \c `Allocator`
+ * @li create_T, create_T_with_allocator : the same as \c `new_T` and
+ * \c `new_T_with_allocator`, returning a status code and the array through an
+ * out-parameter
+ * @li init_T : create type T in a caller-provided buffer
+ * @li T_bytes_required : the size of the buffer \c `init_T` needs
+ * @li new_T_aligned, create_T_aligned : create type T with its elements aligned
+ * @li alignment_T : the alignment of the elements of type T
  * @li from_T : dynamically clone type T on the heap of the same type
+ * @li create_from_T : the same as \c `from_T` through an out-parameter
+ * @li clone_shrink_T : clone type T with a capacity of its size
+ * @li copy_into_T : copy type T into another one, reusing its storage
  * @li free_T : deallocate type T
  * @li push_back_T : insert data to type T on last position
+ * @li append_range_T : insert many data to type T on last positions
  * @li pop_back_T : remove last element in type T
+ * @li pop_back_n_T : remove many last elements in type T
  * @li get_item_T : get the pointer to item on \i `index`
+ * @li at_unchecked_T : get the pointer to item on \i `index` without checks
+ * @li data_ptr_T, begin_T, end_T : get the pointers to the elements' range
+ * @li FOREACH_T : iterate over the elements
  * @li clear_T : reset the data in T
  */
 #ifndef __C_DSA_GENERIC_STRICT_ARRAY_H__
@@ -29,8 +45,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "../utils/config.h"
 #include "../utils/status.h"
 #include "../utils/Result.h"
+#include "../utils/Allocator.h"
+#include "../utils/AlignedAllocator.h"
+#include "../utils/instrument.h"
+#include "../utils/checked.h"
 
 typedef struct StrictArray StrictArray;
 
@@ -45,12 +66,103 @@ typedef struct StrictArray StrictArray;
  * then the array is no longer appendable.
  * To support Generic concept in C, every data structure must be \b `dynamically`
  * allocated, as \c `Result` type only acceps a pointer to data.
+ * The \i `allocator` which allocated the array is kept to deallocate it, it is
+ * a null pointer if the array lives in a caller-provided buffer.
  */
 struct StrictArray {
   size_t size, capacity, type_size;
+  const Allocator *allocator;
   char data[];
 };
 
+/**
+ * @fn status_t create_StrictArray_with_allocator(StrictArray **out, void *data, size_t size, size_t cap, size_t type_size, const Allocator *allocator)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief allocate a \c `StrictArray` through \i `allocator` into \i `*out`
+ * 
+ * The same as \c `new_StrictArray_with_allocator`, but the array is returned
+ * through \i `out` and only a status code is returned, so creating an array
+ * costs no \c `Result` copy nor unpack. \i `*out` is a null pointer on error.
+ * 
+ * @param[out] out where the address of the array is written
+ * (out is not a null pointer)
+ * @param[in] allocator the allocator to use, it must outlive the array
+ * (allocator is not a null pointer)
+ * 
+ * @return \c `NO_ERROR`, \c `SEGFAULT` for a null \i `out` or \i `allocator`,
+ * \c `INVALID_SIZE` for invalid sizes or \c `HEAP_FAILURE`
+ */
+C_DSA_API status_t create_StrictArray_with_allocator(StrictArray **out, void *data, size_t size, size_t cap,
+                                           size_t type_size, const Allocator *allocator) {
+  if (C_DSA_UNLIKELY(!out)) return SEGFAULT;
+  *out = NULL;
+  if (!data) {
+    size = 0;
+  }
+  if (C_DSA_UNLIKELY(!allocator)) return SEGFAULT;
+  if (C_DSA_UNLIKELY(cap < size || type_size <= 0)) return INVALID_SIZE;
+  size_t bytes;
+  if (C_DSA_UNLIKELY(checked_bytes(sizeof(StrictArray), cap, type_size, &bytes))) return INVALID_SIZE;
+
+  StrictArray *result = (StrictArray*)allocator->alloc(allocator->ctx, bytes);
+  if (C_DSA_UNLIKELY(!result)) return HEAP_FAILURE;
+  result->size = size, result->capacity = cap, result->type_size = type_size;
+  result->allocator = allocator;
+  C_DSA_COUNT_ALLOC(C_DSA_STRICT_ARRAY, bytes);
+  if (size) memcpy(result->data, data, size * type_size);
+  *out = result;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t create_StrictArray(StrictArray **out, void *data, size_t size, size_t cap, size_t type_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `create_StrictArray_with_allocator` on the heap
+ */
+C_DSA_API status_t create_StrictArray(StrictArray **out, void *data, size_t size, size_t cap,
+                            size_t type_size) {
+  return create_StrictArray_with_allocator(out, data, size, cap, type_size, &heap_allocator);
+}
+
+/**
+ * @fn Result new_StrictArray_with_allocator(void *data, size_t size, size_t cap, size_t type_size, const Allocator *allocator)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to the allocation made by \i `allocator`
+ * 
+ * The same as \c `new_StrictArray`, but the array is allocated, and later
+ * deallocated by \c `free_StrictArray`, through \i `allocator`.
+ * It wraps \c `create_StrictArray_with_allocator`, which is cheaper when the
+ * error message is not needed.
+ * 
+ * @param[in] allocator the allocator to use, it must outlive the array
+ * (allocator is not a null pointer)
+ * 
+ * @return a \c `Result` type to the successfully allocated data or a error message
+ */
+C_DSA_API Result new_StrictArray_with_allocator(void *data, size_t size, size_t cap, size_t type_size,
+                                      const Allocator *allocator) {
+  StrictArray *result;
+  status_t status = create_StrictArray_with_allocator(&result, data, size, cap, type_size, allocator);
+  if (C_DSA_LIKELY(status == NO_ERROR)) {
+    return (Result) {
+      .ok = NO_ERROR,
+      .data = result
+    };
+  }
+  const char *error_msg = status == SEGFAULT ? "ValueError: cannot access a null pointer\n"
+                        : status == HEAP_FAILURE ? "AllocationError: Not enough memory in the heap"
+                        : data && cap < size ? "SizeError: Size is negative or capacity is less than size\n"
+                        : type_size <= 0 ? "SizeError: Type cannot have less than 1 byte\n"
+                        : "SizeError: Capacity is too big\n";
+  return (Result) {
+    .ok = status,
+    .error_msg = error_msg
+  };
+}
+
 /**
  * @fn Result new_StrictArray(int *data, size_t type_size, size_t size, size_t cap)
  * @author andarling
@@ -72,38 +184,146 @@ struct StrictArray {
  * 
  * @return a \c `Result` type to the successfully allocated data or a error message
  */
-Result new_StrictArray(void *data, size_t size, size_t cap, size_t type_size) {
-  if (!data) {
-    size = 0;
+C_DSA_API Result new_StrictArray(void *data, size_t size, size_t cap, size_t type_size) {
+  return new_StrictArray_with_allocator(data, size, cap, type_size, &heap_allocator);
+}
+
+DEFINE_ALIGNED_ALLOCATORS(StrictArray, sizeof(StrictArray))
+
+/**
+ * @fn status_t create_StrictArray_aligned(StrictArray **out, void *data, size_t size, size_t cap, size_t type_size, size_t alignment)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `create_StrictArray`, with the elements aligned to \i `alignment`
+ * 
+ * The array is allocated through \c `StrictArray_aligned_allocator(alignment)`, which
+ * pads the heap block so that \i `data` starts on an \i `alignment` boundary
+ * and the array can be read with aligned vector loads. Clones made through
+ * \c `from_StrictArray` are aligned the same way.
+ * 
+ * @param[in] alignment the alignment of the elements in bytes
+ * (a power of two in [\c `C_DSA_MIN_ALIGNMENT`, \c `C_DSA_MAX_ALIGNMENT`])
+ * 
+ * @return 0 if success, \c `INVALID_SIZE` for an invalid \i `alignment` and
+ * non-zero if another error occurs
+ */
+C_DSA_API status_t create_StrictArray_aligned(StrictArray **out, void *data, size_t size, size_t cap,
+                                   size_t type_size, size_t alignment) {
+  const Allocator *allocator = StrictArray_aligned_allocator(alignment);
+  if (C_DSA_UNLIKELY(!allocator)) {
+    if (out) *out = NULL;
+    return out ? INVALID_SIZE : SEGFAULT;
   }
-  if (size < 0 || cap < size) {
+  return create_StrictArray_with_allocator(out, data, size, cap, type_size, allocator);
+}
+
+/**
+ * @fn Result new_StrictArray_aligned(void *data, size_t size, size_t cap, size_t type_size, size_t alignment)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `create_StrictArray_aligned`, returning a \c `Result`
+ */
+C_DSA_API Result new_StrictArray_aligned(void *data, size_t size, size_t cap, size_t type_size,
+                                size_t alignment) {
+  const Allocator *allocator = StrictArray_aligned_allocator(alignment);
+  if (!allocator) {
     return (Result) {
       .ok = INVALID_SIZE,
-      .error_msg = "SizeError: Size is negative or capacity is less than size\n"
+      .error_msg = "SizeError: Alignment is not a power of two in the supported range\n"
     };
   }
-  if (type_size <= 0) {
+  return new_StrictArray_with_allocator(data, size, cap, type_size, allocator);
+}
+
+/**
+ * @fn size_t alignment_StrictArray(const StrictArray *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the alignment of the elements of \i `arr`: the greatest power of two,
+ * up to \c `C_DSA_MAX_ALIGNMENT`, dividing the address of \i `data`
+ * 
+ * It holds for any array, not only the ones made by \c `new_StrictArray_aligned`.
+ * 
+ * @param[in] arr the array
+ * (arr is not a null pointer)
+ */
+C_DSA_API size_t alignment_StrictArray(const StrictArray *arr) {
+  return alignment_of(arr->data);
+}
+
+/**
+ * @fn size_t StrictArray_bytes_required(size_t cap, size_t type_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the size in bytes of a \c `StrictArray` of \i `cap` elements
+ * 
+ * @param[in] cap the desired capacity
+ * @param[in] type_size size of every elements in the array
+ * 
+ * @return the number of bytes a buffer given to \c `init_StrictArray` needs, or
+ * 0 if it does not fit in a \c `size_t`
+ */
+C_DSA_API size_t StrictArray_bytes_required(size_t cap, size_t type_size) {
+  size_t bytes;
+  return checked_bytes(sizeof(StrictArray), cap, type_size, &bytes) == NO_ERROR ? bytes : 0;
+}
+
+/**
+ * @fn Result init_StrictArray(void *buffer, size_t buffer_bytes, size_t type_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief lay out an empty \c `StrictArray` in a caller-provided buffer
+ * 
+ * No allocation is made, the buffer can live on the stack, in static or in
+ * shared memory and must outlive the array. The capacity is the number of
+ * elements fitting in the buffer after the header.
+ * \c `free_StrictArray` does not deallocate such an array and \c `from_StrictArray`
+ * clones it on the heap.
+ * 
+ * @param[in] buffer the storage of the array
+ * (aligned to \c `_Alignof(StrictArray)`)
+ * @param[in] buffer_bytes the size of \i `buffer`
+ * (buffer_bytes >= \c `StrictArray_bytes_required(0, type_size)`)
+ * @param[in] type_size size of every elements in the array
+ * (type_size > 0)
+ * 
+ * @return a \c `Result` type to the array (at the address of \i `buffer`) or a
+ * error message
+ */
+C_DSA_API Result init_StrictArray(void *buffer, size_t buffer_bytes, size_t type_size) {
+  if (!buffer) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  if ((size_t)buffer % _Alignof(StrictArray)) {
     return (Result) {
       .ok = INVALID_SIZE,
-      .error_msg = "SizeError: Type cannot have less than 1 byte\n"
+      .error_msg = "SizeError: Buffer is not aligned for the array header\n"
     };
   }
-
-  StrictArray *result = (StrictArray*)malloc(sizeof(StrictArray) + type_size * cap);
-  if (!result) {
+  if (type_size <= 0) {
     return (Result) {
-      .ok = HEAP_FAILURE,
-      .error_msg = "AllocationError: Not enough memory in the heap"
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Type cannot have less than 1 byte\n"
     };
   }
-  else {
-    result->size = size, result->capacity = cap, result->type_size = type_size;
-    memcpy(result->data, data, size * type_size);
+  if (buffer_bytes < sizeof(StrictArray)) {
     return (Result) {
-      .ok = NO_ERROR,
-      .data = result
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Buffer is smaller than the array header\n"
     };
   }
+
+  StrictArray *result = (StrictArray*)buffer;
+  result->size = 0, result->capacity = (buffer_bytes - sizeof(StrictArray)) / type_size;
+  result->type_size = type_size;
+  result->allocator = NULL;
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
 }
 
 /**
@@ -112,12 +332,15 @@ Result new_StrictArray(void *data, size_t size, size_t cap, size_t type_size) {
  * @date 19/09/2025
  * @brief creates a copy of an existed \c `StrictArray`
  * 
+ * The copy is allocated with the same allocator as \i `from`, or on the heap
+ * if \i `from` lives in a caller-provided buffer.
+ * 
  * @param[in] from an existed \c `StrictArray` instance
  * (from is not a null pointer)
  * 
  * @return the \c `Result` type of the successfully allocated data or an error message
  */
-Result from_StrictArray(StrictArray *from) {
+C_DSA_API Result from_StrictArray(StrictArray *from) {
   if (!from) {
     return (Result) {
       .ok = SEGFAULT,
@@ -125,7 +348,37 @@ Result from_StrictArray(StrictArray *from) {
     };
   }
 
-  return new_StrictArray(from->data, from->size, from->capacity, from->type_size);
+  Result result = new_StrictArray_with_allocator(from->data, from->size, from->capacity, from->type_size,
+                                                 from->allocator ? from->allocator : &heap_allocator);
+  if (result.ok == NO_ERROR) C_DSA_COUNT_CLONE(C_DSA_STRICT_ARRAY, from->type_size * from->size);
+  return result;
+}
+
+/**
+ * @fn status_t create_from_StrictArray(StrictArray **out, const StrictArray *from)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `from_StrictArray`, returning the copy through \i `out`
+ * 
+ * @param[out] out where the address of the copy is written, a null pointer on error
+ * (out is not a null pointer)
+ * @param[in] from an existed \c `StrictArray` instance
+ * (from is not a null pointer)
+ * 
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t create_from_StrictArray(StrictArray **out, const StrictArray *from) {
+  if (C_DSA_UNLIKELY(!out)) return SEGFAULT;
+  if (C_DSA_UNLIKELY(!from)) {
+    *out = NULL;
+    return SEGFAULT;
+  }
+
+  status_t status = create_StrictArray_with_allocator(out, (void*)from->data, from->size, from->capacity,
+                                                      from->type_size,
+                                                      from->allocator ? from->allocator : &heap_allocator);
+  if (status == NO_ERROR) C_DSA_COUNT_CLONE(C_DSA_STRICT_ARRAY, from->type_size * from->size);
+  return status;
 }
 
 /**
@@ -134,18 +387,97 @@ Result from_StrictArray(StrictArray *from) {
  * @date 19/09/2025
  * @brief deallocate the data and set the pointer to NULL
  * 
+ * An array created by \c `init_StrictArray` is not deallocated.
+ * 
  * @param[in] arr a pointer to the address of the data
  * (if arr is a null pointer then exits the function)
  * 
  * @return void
  */
-void free_StrictArray(StrictArray **arr) {
+C_DSA_API void free_StrictArray(StrictArray **arr) {
   if (!arr || !*arr) return;
-  free(*arr);
+  const Allocator *allocator = (*arr)->allocator;
+  if (allocator) {
+    size_t bytes = sizeof(StrictArray) + (*arr)->type_size * (*arr)->capacity;
+    C_DSA_COUNT_FREE(C_DSA_STRICT_ARRAY, bytes);
+    allocator->free(allocator->ctx, *arr, bytes);
+  }
   *arr = NULL;
 }
 
 
+/**
+ * @fn Result clone_shrink_StrictArray(const StrictArray *from)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief creates a copy of an existed \c `StrictArray` with a capacity of its size
+ * 
+ * The same as \c `from_StrictArray`, but only the [0, \i `size` - 1] elements
+ * are allocated, so the copy is full.
+ * 
+ * @param[in] from an existed \c `StrictArray` instance
+ * (from is not a null pointer)
+ * 
+ * @return the \c `Result` type of the successfully allocated data or an error message
+ */
+C_DSA_API Result clone_shrink_StrictArray(const StrictArray *from) {
+  if (!from) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+
+  Result result = new_StrictArray_with_allocator((void*)from->data, from->size, from->size, from->type_size,
+                                                 from->allocator ? from->allocator : &heap_allocator);
+  if (result.ok == NO_ERROR) C_DSA_COUNT_CLONE(C_DSA_STRICT_ARRAY, from->type_size * from->size);
+  return result;
+}
+
+/**
+ * @fn status_t copy_into_StrictArray(StrictArray **dst, const StrictArray *src)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief make \i `*dst` a copy of the elements of \i `src`, reusing its storage
+ * 
+ * If \i `*dst` has the same \i `type_size` and a capacity of at least the size
+ * of \i `src`, the elements are copied in place and nothing is allocated.
+ * Otherwise a full copy of \i `src` is allocated with the allocator of \i `*dst`
+ * (or of \i `src` if \i `*dst` is a null pointer) and replaces \i `*dst`, which
+ * is then deallocated. An array living in a caller-provided buffer is never
+ * replaced, \c `NO_SPACE` is returned if it is too small.
+ * On error \i `*dst` is left untouched.
+ * 
+ * @param[in,out] dst a pointer to the destination array, which can be a null pointer
+ * (dst is not a null pointer)
+ * @param[in] src the array to copy
+ * (src is not a null pointer)
+ * 
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t copy_into_StrictArray(StrictArray **dst, const StrictArray *src) {
+  if (!dst || !src) return SEGFAULT;
+  StrictArray *to = *dst;
+  if (to == src) return NO_ERROR;
+  if (to && to->type_size == src->type_size && to->capacity >= src->size) {
+    memcpy(to->data, src->data, src->type_size * src->size);
+    to->size = src->size;
+    C_DSA_COUNT_CLONE(C_DSA_STRICT_ARRAY, src->type_size * src->size);
+    return NO_ERROR;
+  }
+  if (to && !to->allocator) return NO_SPACE;
+
+  const Allocator *allocator = to ? to->allocator : src->allocator ? src->allocator : &heap_allocator;
+  StrictArray *copy;
+  status_t status = create_StrictArray_with_allocator(&copy, (void*)src->data, src->size, src->size,
+                                                      src->type_size, allocator);
+  if (status != NO_ERROR) return status;
+  C_DSA_COUNT_CLONE(C_DSA_STRICT_ARRAY, src->type_size * src->size);
+  free_StrictArray(dst);
+  *dst = copy;
+  return NO_ERROR;
+}
+
 /**
  * @fn push_back_StrictArray(StrictArray *arr, int value)
  * @author andarling
@@ -158,14 +490,16 @@ void free_StrictArray(StrictArray **arr) {
  * 
  * @return 0 if success and non-zero if an error occurs
  */
-status_t push_back_StrictArray(StrictArray *arr, void *value) {
-  size_t size = arr->size, type_size = arr->type_size;
+C_DSA_API status_t push_back_StrictArray(StrictArray *arr, void *value) {
   if (!arr) return SEGFAULT;
+  size_t size = arr->size, type_size = arr->type_size;
   if (size == arr->capacity) {
+    C_DSA_COUNT_FAILED_PUSH(C_DSA_STRICT_ARRAY);
     return NO_SPACE;
   }
   memcpy(arr->data + type_size * size, value, type_size);
   arr->size++;
+  C_DSA_COUNT_PUSH(C_DSA_STRICT_ARRAY, 1);
   return NO_ERROR;
 }
 
@@ -181,9 +515,63 @@ status_t push_back_StrictArray(StrictArray *arr, void *value) {
  * 
  * @return void
  */
-void pop_back_StrictArray(StrictArray *arr) {
+C_DSA_API void pop_back_StrictArray(StrictArray *arr) {
   if (!arr) return;
-  if (arr->size) arr->size--;
+  if (arr->size) {
+    arr->size--;
+    C_DSA_COUNT_POP(C_DSA_STRICT_ARRAY, 1);
+  }
+}
+
+/**
+ * @fn status_t append_range_StrictArray(StrictArray *arr, void *src, size_t count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert \i `count` elements from \i `src` to the end of the array
+ * 
+ * The capacity is checked once and all elements are copied with a single
+ * \c `memcpy`, if there is not enough space nothing is inserted.
+ * 
+ * @param[in] arr a pointer to \c `StrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] src a pointer to the elements to insert
+ * (if src is a null pointer then an error of invalid instance is returned)
+ * @param[in] count the number of elements in \i `src`
+ * 
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t append_range_StrictArray(StrictArray *arr, void *src, size_t count) {
+  if (!arr || (!src && count)) return SEGFAULT;
+  size_t size = arr->size, type_size = arr->type_size;
+  if (count > arr->capacity - size) {
+    C_DSA_COUNT_FAILED_PUSH(C_DSA_STRICT_ARRAY);
+    return NO_SPACE;
+  }
+  memcpy(arr->data + type_size * size, src, type_size * count);
+  arr->size = size + count;
+  C_DSA_COUNT_PUSH(C_DSA_STRICT_ARRAY, count);
+  return NO_ERROR;
+}
+
+/**
+ * @fn void pop_back_n_StrictArray(StrictArray *arr, size_t count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief remove the last \i `count` elements in \c `StrictArray`
+ * 
+ * If \i `count` is greater than \i `size`, all elements are removed.
+ * 
+ * @param[in] arr a pointer to \c `StrictArray` type
+ * (if arr is a null pointer then exits the function)
+ * @param[in] count the number of elements to remove
+ * 
+ * @return void
+ */
+C_DSA_API void pop_back_n_StrictArray(StrictArray *arr, size_t count) {
+  if (!arr) return;
+  size_t size = count < arr->size ? arr->size - count : 0;
+  C_DSA_COUNT_POP(C_DSA_STRICT_ARRAY, arr->size - size);
+  arr->size = size;
 }
 
 /**
@@ -199,7 +587,7 @@ void pop_back_StrictArray(StrictArray *arr) {
  * 
  * @return void
  */
-void clear_StrictArray(StrictArray *arr) {
+C_DSA_API void clear_StrictArray(StrictArray *arr) {
   if (!arr) return;
   arr->size = 0;
 }
@@ -211,13 +599,71 @@ void clear_StrictArray(StrictArray *arr) {
  * @brief return a pointer to the desired elements
  * 
  * This function returns a pointer to the desired elements, if it is out-of-bound
- * (outside of [0, \c `size` - 1]), the output is a null pointer
+ * (outside of [0, \c `size` - 1]) or \i `arr` is a null pointer, the output is a
+ * null pointer
  */
-void *get_item(StrictArray *arr, size_t index) {
-  if (index < 0 && index >= arr->size) {
+C_DSA_API void *get_item(StrictArray *arr, size_t index) {
+  if (!arr || index >= arr->size) {
     return NULL;
   }
   return arr->data + arr->type_size * index;
 }
 
+/**
+ * @fn static inline void *at_unchecked_StrictArray(StrictArray *arr, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the \i `index`-th element without any check
+ * 
+ * The fast path of \c `get_item` for tight loops, \i `arr` must not be
+ * a null pointer and \i `index` must be in [0, \i `size` - 1].
+ */
+static inline void *at_unchecked_StrictArray(StrictArray *arr, size_t index) {
+  return arr->data + arr->type_size * index;
+}
+
+/**
+ * @fn static inline void *data_ptr_StrictArray(StrictArray *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the first element, \i `arr` must not be a null pointer
+ */
+static inline void *data_ptr_StrictArray(StrictArray *arr) {
+  return arr->data;
+}
+
+/**
+ * @fn static inline void *begin_StrictArray(StrictArray *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the first element, \i `arr` must not be a null pointer
+ */
+static inline void *begin_StrictArray(StrictArray *arr) {
+  return arr->data;
+}
+
+/**
+ * @fn static inline void *end_StrictArray(StrictArray *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer past the last element, \i `arr` must not be a null pointer
+ */
+static inline void *end_StrictArray(StrictArray *arr) {
+  return arr->data + arr->type_size * arr->size;
+}
+
+/**
+ * @def FOREACH_StrictArray(arr, T, it)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief iterate \i `it` (a \i `T` pointer) over the elements of \i `arr`
+ * 
+ * The base pointer and the end are computed once, so every step is a pointer
+ * increment. \i `T` must be the element type (\c `sizeof(T)` == \i `type_size`),
+ * with the type specialised arrays it can be used as is, e.g.
+ * \c `FOREACH_StrictArray(arr_int, int, it) { *it = 0; }`.
+ */
+#define FOREACH_StrictArray(arr, T, it) \
+  for (T *it = (T*)(arr)->data, *it##_end = it + (arr)->size; it != it##_end; ++it)
+
 #endif // __C_DSA_GENERIC_STRICT_ARRAY_H__
\ No newline at end of file
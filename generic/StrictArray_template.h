@@ -0,0 +1,331 @@
+/**
+ * @file StrictArray_template.h
+ * @brief a generator for type specialised strict arrays
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details \c `DEFINE_STRICT_ARRAY(T, suffix)` emits a structure
+ * \c `StrictArray_suffix` holding elements of type \i `T` and the same APIs as
+ * the generic \c `StrictArray`, but as \c `sizeof(T)` is known at compile time,
+ * elements are copied with plain stores instead of a runtime-sized \c `memcpy`.
+ * \i `T` must be copyable by assignment (arithmetic types, pointers or structs).
+ *
+ * Generated APIs (T* stands for the element pointer, S for \c `StrictArray_suffix`):
+ * @li Result new_S(T *data, size_t size, size_t cap) : create S on the heap
+ * @li Result new_S_with_allocator(T *data, size_t size, size_t cap,
+ * const Allocator *allocator) : create S through \i `allocator`
+ * @li status_t create_S(S **out, T *data, size_t size, size_t cap),
+ * status_t create_S_with_allocator(S **out, T *data, size_t size, size_t cap,
+ * const Allocator *allocator) : the same as \i `new_S` and \i `new_S_with_allocator`,
+ * returning a status code and S through \i `out`
+ * @li Result new_S_aligned(T *data, size_t size, size_t cap, size_t alignment),
+ * status_t create_S_aligned(S **out, T *data, size_t size, size_t cap,
+ * size_t alignment) : create S with \i `data` aligned to \i `alignment` (a power
+ * of two in [\c `C_DSA_MIN_ALIGNMENT`, \c `C_DSA_MAX_ALIGNMENT`]), its clones are
+ * aligned the same way
+ * @li size_t alignment_S(const S *arr) : the alignment of \i `data`, at most
+ * \c `C_DSA_MAX_ALIGNMENT`
+ * @li size_t S_bytes_required(size_t cap) : the size of a buffer holding S with
+ * \i `cap` elements
+ * @li Result init_S(void *buffer, size_t buffer_bytes) : lay out an empty S in a
+ * caller-provided buffer, without allocation
+ * @li Result from_S(S *from) : clone S with the allocator of \i `from` (or on the
+ * heap if \i `from` lives in a caller-provided buffer)
+ * @li status_t create_from_S(S **out, const S *from) : the same as \i `from_S`
+ * through \i `out`
+ * @li Result clone_shrink_S(const S *from) : clone S with a capacity of its size
+ * @li status_t copy_into_S(S **dst, const S *src) : copy the elements of \i `src`
+ * into \i `*dst`, reallocating \i `*dst` only if it is too small
+ * @li void free_S(S **arr) : deallocate S (unless it was created by \i `init_S`)
+ * and set the pointer to NULL
+ * @li status_t push_back_S(S *arr, T value) : insert \i `value` on last position
+ * @li status_t append_range_S(S *arr, T *src, size_t count) : insert \i `count`
+ * values on last positions with one capacity check
+ * @li void pop_back_S(S *arr) : remove last element
+ * @li void pop_back_n_S(S *arr, size_t count) : remove the last \i `count` elements
+ * @li void clear_S(S *arr) : remove all elements
+ * @li T *get_item_S(S *arr, size_t index) : pointer to the \i `index`-th element,
+ * or a null pointer if out of [0, \i `size` - 1]
+ * @li T *at_unchecked_S(S *arr, size_t index) : \c `static inline` pointer to the
+ * \i `index`-th element without any check (index in [0, \i `size` - 1])
+ * @li T *data_ptr_S(S *arr), T *begin_S(S *arr), T *end_S(S *arr) :
+ * \c `static inline` pointers to the first and past the last elements
+ *
+ * The \c `FOREACH_StrictArray` macro of the generic header also iterates S.
+ *
+ * Errors and edge cases behave exactly as in generic/StrictArray.h.
+ */
+#ifndef __C_DSA_GENERIC_STRICT_ARRAY_TEMPLATE_H__
+#define __C_DSA_GENERIC_STRICT_ARRAY_TEMPLATE_H__
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+#include "../utils/AlignedAllocator.h"
+#include "../utils/instrument.h"
+#include "../utils/checked.h"
+
+#define DEFINE_STRICT_ARRAY(T, suffix)                                         \
+  typedef struct StrictArray_##suffix StrictArray_##suffix;                    \
+                                                                               \
+  struct StrictArray_##suffix {                                                \
+    size_t size, capacity;                                                     \
+    const Allocator *allocator;                                                \
+    T data[];                                                                  \
+  };                                                                           \
+                                                                               \
+  C_DSA_API status_t create_StrictArray_##suffix##_with_allocator(StrictArray_##suffix **out, T *data, size_t size, \
+                                                     size_t cap, const Allocator *allocator) { \
+    if (C_DSA_UNLIKELY(!out)) return SEGFAULT;                                 \
+    *out = NULL;                                                               \
+    if (!data) {                                                               \
+      size = 0;                                                                \
+    }                                                                          \
+    if (C_DSA_UNLIKELY(!allocator)) return SEGFAULT;                           \
+    if (C_DSA_UNLIKELY(cap < size)) return INVALID_SIZE;                       \
+    size_t bytes;                                                              \
+    if (C_DSA_UNLIKELY(checked_bytes(sizeof(StrictArray_##suffix), cap, sizeof(T), &bytes))) return INVALID_SIZE; \
+    StrictArray_##suffix *result = (StrictArray_##suffix*)allocator->alloc(allocator->ctx, bytes); \
+    if (C_DSA_UNLIKELY(!result)) return HEAP_FAILURE;                          \
+    result->size = size, result->capacity = cap;                               \
+    result->allocator = allocator;                                             \
+    if (size) memcpy(result->data, data, size * sizeof(T));                    \
+    C_DSA_COUNT_ALLOC(C_DSA_STRICT_ARRAY, bytes);                              \
+    *out = result;                                                             \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t create_StrictArray_##suffix(StrictArray_##suffix **out, T *data, size_t size, size_t cap) { \
+    return create_StrictArray_##suffix##_with_allocator(out, data, size, cap, &heap_allocator); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result new_StrictArray_##suffix##_with_allocator(T *data, size_t size, size_t cap, \
+                                                  const Allocator *allocator) { \
+    StrictArray_##suffix *result;                                              \
+    status_t status = create_StrictArray_##suffix##_with_allocator(&result, data, size, cap, allocator); \
+    if (C_DSA_LIKELY(status == NO_ERROR)) {                                    \
+      return (Result) {                                                        \
+        .ok = NO_ERROR,                                                        \
+        .data = result                                                         \
+      };                                                                       \
+    }                                                                          \
+    return (Result) {                                                          \
+      .ok = status,                                                            \
+      .error_msg = status == SEGFAULT ? "ValueError: cannot access a null pointer\n" \
+                 : status == HEAP_FAILURE ? "AllocationError: Not enough memory in the heap" \
+                 : data && cap < size ? "SizeError: size is negative or capacity is less than size\n" \
+                 : "SizeError: Capacity is too big\n"                          \
+    };                                                                         \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result new_StrictArray_##suffix(T *data, size_t size, size_t cap) { \
+    return new_StrictArray_##suffix##_with_allocator(data, size, cap, &heap_allocator); \
+  }                                                                            \
+                                                                               \
+  DEFINE_ALIGNED_ALLOCATORS(StrictArray_##suffix, sizeof(StrictArray_##suffix)) \
+                                                                               \
+  C_DSA_API status_t create_StrictArray_##suffix##_aligned(StrictArray_##suffix **out, T *data, size_t size, size_t cap, \
+                                            size_t alignment) {                \
+    const Allocator *allocator = StrictArray_##suffix##_aligned_allocator(alignment); \
+    if (C_DSA_UNLIKELY(!allocator)) {                                          \
+      if (out) *out = NULL;                                                    \
+      return out ? INVALID_SIZE : SEGFAULT;                                    \
+    }                                                                          \
+    return create_StrictArray_##suffix##_with_allocator(out, data, size, cap, allocator); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result new_StrictArray_##suffix##_aligned(T *data, size_t size, size_t cap, size_t alignment) { \
+    const Allocator *allocator = StrictArray_##suffix##_aligned_allocator(alignment); \
+    if (!allocator) {                                                          \
+      return (Result) {                                                        \
+        .ok = INVALID_SIZE,                                                    \
+        .error_msg = "SizeError: Alignment is not a power of two in the supported range\n" \
+      };                                                                       \
+    }                                                                          \
+    return new_StrictArray_##suffix##_with_allocator(data, size, cap, allocator); \
+  }                                                                            \
+                                                                               \
+  C_DSA_API size_t alignment_StrictArray_##suffix(const StrictArray_##suffix *arr) { \
+    return alignment_of(arr->data);                                            \
+  }                                                                            \
+                                                                               \
+  C_DSA_API size_t StrictArray_##suffix##_bytes_required(size_t cap) {         \
+    size_t bytes;                                                              \
+    return checked_bytes(sizeof(StrictArray_##suffix), cap, sizeof(T), &bytes) == NO_ERROR ? bytes : 0; \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result init_StrictArray_##suffix(void *buffer, size_t buffer_bytes) { \
+    if (!buffer) {                                                             \
+      return (Result) {                                                        \
+        .ok = SEGFAULT,                                                        \
+        .error_msg = "ValueError: cannot access a null pointer\n"              \
+      };                                                                       \
+    }                                                                          \
+    if ((size_t)buffer % _Alignof(StrictArray_##suffix)) {                     \
+      return (Result) {                                                        \
+        .ok = INVALID_SIZE,                                                    \
+        .error_msg = "SizeError: Buffer is not aligned for the array header\n" \
+      };                                                                       \
+    }                                                                          \
+    if (buffer_bytes < sizeof(StrictArray_##suffix)) {                         \
+      return (Result) {                                                        \
+        .ok = INVALID_SIZE,                                                    \
+        .error_msg = "SizeError: Buffer is smaller than the array header\n"    \
+      };                                                                       \
+    }                                                                          \
+    StrictArray_##suffix *result = (StrictArray_##suffix*)buffer;              \
+    result->size = 0;                                                          \
+    result->capacity = (buffer_bytes - sizeof(StrictArray_##suffix)) / sizeof(T); \
+    result->allocator = NULL;                                                  \
+    return (Result) {                                                          \
+      .ok = NO_ERROR,                                                          \
+      .data = result                                                           \
+    };                                                                         \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result from_StrictArray_##suffix(StrictArray_##suffix *from) {     \
+    if (!from) {                                                               \
+      return (Result) {                                                        \
+        .ok = SEGFAULT,                                                        \
+        .error_msg = "ValueError: cannot access a null pointer\n"              \
+      };                                                                       \
+    }                                                                          \
+    Result result = new_StrictArray_##suffix##_with_allocator(from->data, from->size, \
+                                                              from->capacity,  \
+                                                              from->allocator ? from->allocator : &heap_allocator); \
+    if (result.ok == NO_ERROR) C_DSA_COUNT_CLONE(C_DSA_STRICT_ARRAY, sizeof(T) * from->size); \
+    return result;                                                             \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t create_from_StrictArray_##suffix(StrictArray_##suffix **out, const StrictArray_##suffix *from) { \
+    if (C_DSA_UNLIKELY(!out)) return SEGFAULT;                                 \
+    if (C_DSA_UNLIKELY(!from)) {                                               \
+      *out = NULL;                                                             \
+      return SEGFAULT;                                                         \
+    }                                                                          \
+    status_t status = create_StrictArray_##suffix##_with_allocator(out, (T*)from->data, from->size, from->capacity, \
+                                                                  from->allocator ? from->allocator : &heap_allocator); \
+    if (status == NO_ERROR) C_DSA_COUNT_CLONE(C_DSA_STRICT_ARRAY, sizeof(T) * from->size); \
+    return status;                                                             \
+  }                                                                            \
+                                                                               \
+  C_DSA_API void free_StrictArray_##suffix(StrictArray_##suffix **arr) {       \
+    if (!arr || !*arr) return;                                                 \
+    const Allocator *allocator = (*arr)->allocator;                            \
+    if (allocator) {                                                           \
+      size_t bytes = sizeof(StrictArray_##suffix) + sizeof(T) * (*arr)->capacity; \
+      C_DSA_COUNT_FREE(C_DSA_STRICT_ARRAY, bytes);                             \
+      allocator->free(allocator->ctx, *arr, bytes);                            \
+    }                                                                          \
+    *arr = NULL;                                                               \
+  }                                                                            \
+                                                                               \
+  C_DSA_API Result clone_shrink_StrictArray_##suffix(const StrictArray_##suffix *from) { \
+    if (!from) {                                                               \
+      return (Result) {                                                        \
+        .ok = SEGFAULT,                                                        \
+        .error_msg = "ValueError: cannot access a null pointer\n"              \
+      };                                                                       \
+    }                                                                          \
+    Result result = new_StrictArray_##suffix##_with_allocator((T*)from->data, from->size, from->size, \
+                                                              from->allocator ? from->allocator : &heap_allocator); \
+    if (result.ok == NO_ERROR) C_DSA_COUNT_CLONE(C_DSA_STRICT_ARRAY, sizeof(T) * from->size); \
+    return result;                                                             \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t copy_into_StrictArray_##suffix(StrictArray_##suffix **dst, \
+                                                     const StrictArray_##suffix *src) { \
+    if (!dst || !src) return SEGFAULT;                                         \
+    StrictArray_##suffix *to = *dst;                                           \
+    if (to == src) return NO_ERROR;                                            \
+    if (to && to->capacity >= src->size) {                                     \
+      memcpy(to->data, src->data, sizeof(T) * src->size);                      \
+      to->size = src->size;                                                    \
+      C_DSA_COUNT_CLONE(C_DSA_STRICT_ARRAY, sizeof(T) * src->size);            \
+      return NO_ERROR;                                                         \
+    }                                                                          \
+    if (to && !to->allocator) return NO_SPACE;                                 \
+    const Allocator *allocator = to ? to->allocator : src->allocator ? src->allocator : &heap_allocator; \
+    StrictArray_##suffix *copy;                                                \
+    status_t status = create_StrictArray_##suffix##_with_allocator(&copy, (T*)src->data, src->size, \
+                                                                   src->size, allocator); \
+    if (status != NO_ERROR) return status;                                     \
+    C_DSA_COUNT_CLONE(C_DSA_STRICT_ARRAY, sizeof(T) * src->size);              \
+    free_StrictArray_##suffix(dst);                                            \
+    *dst = copy;                                                               \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t push_back_StrictArray_##suffix(StrictArray_##suffix *arr, T value) { \
+    if (!arr) return SEGFAULT;                                                 \
+    size_t size = arr->size;                                                   \
+    if (size == arr->capacity) {                                               \
+      C_DSA_COUNT_FAILED_PUSH(C_DSA_STRICT_ARRAY);                             \
+      return NO_SPACE;                                                         \
+    }                                                                          \
+    arr->data[size] = value;                                                   \
+    arr->size = size + 1;                                                      \
+    C_DSA_COUNT_PUSH(C_DSA_STRICT_ARRAY, 1);                                   \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API status_t append_range_StrictArray_##suffix(StrictArray_##suffix *arr, \
+                                             T *src, size_t count) {           \
+    if (!arr || (!src && count)) return SEGFAULT;                              \
+    size_t size = arr->size;                                                   \
+    if (count > arr->capacity - size) {                                        \
+      C_DSA_COUNT_FAILED_PUSH(C_DSA_STRICT_ARRAY);                             \
+      return NO_SPACE;                                                         \
+    }                                                                          \
+    memcpy(arr->data + size, src, sizeof(T) * count);                          \
+    arr->size = size + count;                                                  \
+    C_DSA_COUNT_PUSH(C_DSA_STRICT_ARRAY, count);                               \
+    return NO_ERROR;                                                           \
+  }                                                                            \
+                                                                               \
+  C_DSA_API void pop_back_StrictArray_##suffix(StrictArray_##suffix *arr) {    \
+    if (!arr) return;                                                          \
+    if (arr->size) {                                                           \
+      arr->size--;                                                             \
+      C_DSA_COUNT_POP(C_DSA_STRICT_ARRAY, 1);                                  \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  C_DSA_API void pop_back_n_StrictArray_##suffix(StrictArray_##suffix *arr, size_t count) { \
+    if (!arr) return;                                                          \
+    size_t size = count < arr->size ? arr->size - count : 0;                   \
+    C_DSA_COUNT_POP(C_DSA_STRICT_ARRAY, arr->size - size);                     \
+    arr->size = size;                                                          \
+  }                                                                            \
+                                                                               \
+  C_DSA_API void clear_StrictArray_##suffix(StrictArray_##suffix *arr) {       \
+    if (!arr) return;                                                          \
+    arr->size = 0;                                                             \
+  }                                                                            \
+                                                                               \
+  C_DSA_API T *get_item_StrictArray_##suffix(StrictArray_##suffix *arr, size_t index) { \
+    if (!arr || index >= arr->size) return NULL;                               \
+    return arr->data + index;                                                  \
+  }                                                                            \
+                                                                               \
+  static inline T *at_unchecked_StrictArray_##suffix(StrictArray_##suffix *arr, size_t index) { \
+    return arr->data + index;                                                  \
+  }                                                                            \
+                                                                               \
+  static inline T *data_ptr_StrictArray_##suffix(StrictArray_##suffix *arr) {  \
+    return arr->data;                                                          \
+  }                                                                            \
+                                                                               \
+  static inline T *begin_StrictArray_##suffix(StrictArray_##suffix *arr) {     \
+    return arr->data;                                                          \
+  }                                                                            \
+                                                                               \
+  static inline T *end_StrictArray_##suffix(StrictArray_##suffix *arr) {       \
+    return arr->data + arr->size;                                              \
+  }
+
+#endif // __C_DSA_GENERIC_STRICT_ARRAY_TEMPLATE_H__
@@ -0,0 +1,636 @@
+/**
+ * @file generic/algorithms.h
+ * @brief sort, transform and reduce algorithms for the generic arrays
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details The algorithms work in place on the elements of an \c `ArrayView`
+ * (see generic/ArrayView.h), or on the [0, \i `size` - 1] elements of a
+ * \c `StrictArray`, and know the elements only through \i `type_size` and the
+ * given callbacks. Comparators have the signature of \c `qsort`'s.
+ * The elements of a strided view are sorted in a contiguous temporary buffer,
+ * the other algorithms follow the stride.
+ * Every algorithm has a \c `parallel_` version taking a \c `ThreadPool` (see
+ * utils/ThreadPool.h): the elements are split in chunks processed by the
+ * threads of the pool, a null pool (or a small array) runs sequentially.
+ * The sorts sort every chunk, then merge the sorted chunks pairwise, every
+ * merge of a round being a task of its own.
+ *
+ * Algorithms' APIs:
+ * @li sort_T : sort the elements of T (not stable)
+ * @li stable_sort_T : sort the elements of T keeping the order of equal elements
+ * @li transform_T : call a function on every element of T
+ * @li reduce_T : fold the elements of T into an accumulator
+ * @li parallel_sort_T, parallel_stable_sort_T, parallel_transform_T,
+ * parallel_reduce_T : the same algorithms run by a \c `ThreadPool`
+ */
+#ifndef __C_DSA_GENERIC_ALGORITHMS_H__
+#define __C_DSA_GENERIC_ALGORITHMS_H__
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/ThreadPool.h"
+#include "StrictArray.h"
+#include "ArrayView.h"
+
+/**
+ * @brief the length of the runs sorted by insertion before merging
+ */
+#define C_DSA_SORT_RUN 32
+
+typedef int (*Comparator)(const void *a, const void *b);
+
+/**
+ * @brief sort \i `n` elements by insertion, \i `scratch` holds one element
+ */
+C_DSA_API void insertion_sort_bytes(char *data, size_t n, size_t type_size, Comparator cmp, char *scratch) {
+  for (size_t i = 1; i < n; i++) {
+    char *item = data + type_size * i;
+    if (cmp(item - type_size, item) <= 0) continue;
+    memcpy(scratch, item, type_size);
+    size_t j = i;
+    while (j > 0 && cmp(data + type_size * (j - 1), scratch) > 0) j--;
+    memmove(data + type_size * (j + 1), data + type_size * j, type_size * (i - j));
+    memcpy(data + type_size * j, scratch, type_size);
+  }
+}
+
+/**
+ * @brief stable merge of the sorted \i `a` and \i `b` into \i `out`
+ */
+C_DSA_API void merge_bytes(const char *a, size_t na, const char *b, size_t nb, char *out,
+                           size_t type_size, Comparator cmp) {
+  const char *a_end = a + type_size * na, *b_end = b + type_size * nb;
+  while (a != a_end && b != b_end) {
+    // equal elements are taken from a first
+    if (cmp(b, a) < 0) {
+      memcpy(out, b, type_size);
+      b += type_size;
+    }
+    else {
+      memcpy(out, a, type_size);
+      a += type_size;
+    }
+    out += type_size;
+  }
+  memcpy(out, a, (size_t)(a_end - a));
+  memcpy(out + (a_end - a), b, (size_t)(b_end - b));
+}
+
+/**
+ * @brief stable bottom-up merge sort of \i `n` elements, \i `tmp` holds \i `n`
+ * elements, the result is in \i `data`
+ */
+C_DSA_API void stable_sort_bytes(char *data, char *tmp, size_t n, size_t type_size, Comparator cmp) {
+  for (size_t start = 0; start < n; start += C_DSA_SORT_RUN) {
+    size_t len = n - start < C_DSA_SORT_RUN ? n - start : C_DSA_SORT_RUN;
+    insertion_sort_bytes(data + type_size * start, len, type_size, cmp, tmp);
+  }
+
+  char *src = data, *dst = tmp;
+  for (size_t width = C_DSA_SORT_RUN; width < n; width *= 2) {
+    for (size_t start = 0; start < n; start += 2 * width) {
+      size_t mid = n - start < width ? n : start + width;
+      size_t end = n - mid < width ? n : mid + width;
+      merge_bytes(src + type_size * start, mid - start, src + type_size * mid, end - mid,
+                  dst + type_size * start, type_size, cmp);
+    }
+    char *swap = src;
+    src = dst, dst = swap;
+  }
+  if (src != data) memcpy(data, src, type_size * n);
+}
+
+
+typedef struct {
+  char *data, *tmp;
+  size_t n, type_size, chunks;
+  size_t *bounds;
+  Comparator cmp;
+  int stable;
+  // the merge rounds read src and write dst
+  char *src, *dst;
+  size_t runs;
+} SortJob;
+
+C_DSA_API void sort_chunk_task(void *ctx, size_t index) {
+  SortJob *job = (SortJob*)ctx;
+  size_t begin = job->bounds[index], len = job->bounds[index + 1] - begin;
+  char *data = job->data + job->type_size * begin;
+  if (job->stable) stable_sort_bytes(data, job->tmp + job->type_size * begin, len, job->type_size, job->cmp);
+  else qsort(data, len, job->type_size, job->cmp);
+}
+
+C_DSA_API void merge_runs_task(void *ctx, size_t index) {
+  SortJob *job = (SortJob*)ctx;
+  size_t begin = job->bounds[2 * index], mid = job->bounds[2 * index + 1];
+  size_t end = 2 * index + 2 <= job->runs ? job->bounds[2 * index + 2] : mid;
+  size_t type_size = job->type_size;
+  merge_bytes(job->src + type_size * begin, mid - begin, job->src + type_size * mid, end - mid,
+              job->dst + type_size * begin, type_size, job->cmp);
+}
+
+/**
+ * @brief sort \i `n` elements with the threads of \i `pool`
+ */
+C_DSA_API status_t parallel_sort_bytes(ThreadPool *pool, char *data, size_t n, size_t type_size,
+                                       Comparator cmp, int stable) {
+  size_t chunks = chunk_count_ThreadPool(pool, n, 1);
+  if (chunks == 1 && !stable) {
+    qsort(data, n, type_size, cmp);
+    return NO_ERROR;
+  }
+
+  char *tmp = (char*)malloc(type_size * n);
+  size_t *bounds = (size_t*)malloc(sizeof(size_t) * (chunks + 1));
+  if (!tmp || !bounds) {
+    free(tmp);
+    free(bounds);
+    return HEAP_FAILURE;
+  }
+  for (size_t i = 0; i <= chunks; i++) {
+    bounds[i] = chunk_begin_ThreadPool(n, chunks, i);
+  }
+
+  SortJob job = {
+    .data = data, .tmp = tmp, .n = n, .type_size = type_size, .chunks = chunks,
+    .bounds = bounds, .cmp = cmp, .stable = stable, .src = data, .dst = tmp, .runs = chunks
+  };
+  run_ThreadPool(pool, chunks, sort_chunk_task, &job);
+
+  while (job.runs > 1) {
+    size_t merges = (job.runs + 1) / 2;
+    run_ThreadPool(pool, merges, merge_runs_task, &job);
+    // the merged runs start at the even bounds
+    for (size_t i = 1; i < merges; i++) {
+      bounds[i] = bounds[2 * i];
+    }
+    bounds[merges] = n;
+    job.runs = merges;
+    char *swap = job.src;
+    job.src = job.dst, job.dst = swap;
+  }
+  if (job.src != data) memcpy(data, job.src, type_size * n);
+
+  free(tmp);
+  free(bounds);
+  return NO_ERROR;
+}
+
+/**
+ * @brief sort the elements of \i `view`, a strided view is gathered in a
+ * contiguous buffer, sorted, then scattered back
+ */
+C_DSA_API status_t sort_view_bytes(ThreadPool *pool, const ArrayView *view, Comparator cmp, int stable) {
+  size_t n = view->size, type_size = view->type_size;
+  if (n < 2) return NO_ERROR;
+  if (view->stride == 1) return parallel_sort_bytes(pool, view->data, n, type_size, cmp, stable);
+
+  size_t step = type_size * view->stride;
+  char *buffer = (char*)malloc(type_size * n);
+  if (!buffer) return HEAP_FAILURE;
+  for (size_t i = 0; i < n; i++) {
+    memcpy(buffer + type_size * i, view->data + step * i, type_size);
+  }
+  status_t status = parallel_sort_bytes(pool, buffer, n, type_size, cmp, stable);
+  if (status == NO_ERROR) {
+    for (size_t i = 0; i < n; i++) {
+      memcpy(view->data + step * i, buffer + type_size * i, type_size);
+    }
+  }
+  free(buffer);
+  return status;
+}
+
+typedef struct {
+  char *data;
+  // the distance in bytes between two elements
+  size_t n, step, chunks;
+  void (*transform)(void *item, void *ctx);
+  void (*reduce)(void *acc, const void *item, void *ctx);
+  void *ctx;
+  char *partials;
+  size_t acc_size;
+} ChunkJob;
+
+C_DSA_API void transform_chunk_task(void *ctx, size_t index) {
+  ChunkJob *job = (ChunkJob*)ctx;
+  size_t end = chunk_begin_ThreadPool(job->n, job->chunks, index + 1);
+  for (size_t i = chunk_begin_ThreadPool(job->n, job->chunks, index); i < end; i++) {
+    job->transform(job->data + job->step * i, job->ctx);
+  }
+}
+
+C_DSA_API void reduce_chunk_task(void *ctx, size_t index) {
+  ChunkJob *job = (ChunkJob*)ctx;
+  char *acc = job->partials + job->acc_size * index;
+  size_t end = chunk_begin_ThreadPool(job->n, job->chunks, index + 1);
+  for (size_t i = chunk_begin_ThreadPool(job->n, job->chunks, index); i < end; i++) {
+    job->reduce(acc, job->data + job->step * i, job->ctx);
+  }
+}
+
+/**
+ * @fn status_t sort_ArrayView(const ArrayView *view, Comparator cmp)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief sort the elements of the view in ascending order of \i `cmp`
+ *
+ * The sort is not stable, it does not allocate on a contiguous view and uses
+ * a temporary buffer of \i `size` elements on a strided one.
+ *
+ * @param[in] view a pointer to \c `ArrayView` type
+ * (if view is a null pointer then an error of invalid instance is returned)
+ * @param[in] cmp a comparator returning a negative, zero or positive value
+ * (cmp is not a null pointer)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t sort_ArrayView(const ArrayView *view, Comparator cmp) {
+  if (!view || !cmp) return SEGFAULT;
+  return sort_view_bytes(NULL, view, cmp, 0);
+}
+
+/**
+ * @fn status_t sort_StrictArray(StrictArray *arr, Comparator cmp)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief sort the elements of the array in ascending order of \i `cmp`
+ *
+ * The sort is not stable and does not allocate.
+ *
+ * @param[in] arr a pointer to \c `StrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] cmp a comparator returning a negative, zero or positive value
+ * (cmp is not a null pointer)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t sort_StrictArray(StrictArray *arr, Comparator cmp) {
+  ArrayView view;
+  status_t status = view_StrictArray(arr, &view);
+  if (status != NO_ERROR) return status;
+  return sort_ArrayView(&view, cmp);
+}
+
+/**
+ * @fn status_t stable_sort_ArrayView(const ArrayView *view, Comparator cmp)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief sort the elements of the view keeping the order of equal elements
+ *
+ * A merge sort using a temporary buffer of \i `size` elements from the heap
+ * (two on a strided view).
+ *
+ * @param[in] view a pointer to \c `ArrayView` type
+ * (if view is a null pointer then an error of invalid instance is returned)
+ * @param[in] cmp a comparator returning a negative, zero or positive value
+ * (cmp is not a null pointer)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t stable_sort_ArrayView(const ArrayView *view, Comparator cmp) {
+  if (!view || !cmp) return SEGFAULT;
+  return sort_view_bytes(NULL, view, cmp, 1);
+}
+
+/**
+ * @fn status_t stable_sort_StrictArray(StrictArray *arr, Comparator cmp)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief sort the elements of the array keeping the order of equal elements
+ *
+ * A merge sort using a temporary buffer of \i `size` elements from the heap.
+ *
+ * @param[in] arr a pointer to \c `StrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] cmp a comparator returning a negative, zero or positive value
+ * (cmp is not a null pointer)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t stable_sort_StrictArray(StrictArray *arr, Comparator cmp) {
+  ArrayView view;
+  status_t status = view_StrictArray(arr, &view);
+  if (status != NO_ERROR) return status;
+  return stable_sort_ArrayView(&view, cmp);
+}
+
+/**
+ * @fn status_t transform_ArrayView(const ArrayView *view, void (*fn)(void *item, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief call \i `fn` on every element of the view, in order
+ *
+ * @param[in] view a pointer to \c `ArrayView` type
+ * (if view is a null pointer then an error of invalid instance is returned)
+ * @param[in] fn the function modifying an element in place
+ * (fn is not a null pointer)
+ * @param[in] ctx the context given to every call
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t transform_ArrayView(const ArrayView *view, void (*fn)(void *item, void *ctx), void *ctx) {
+  if (!view || !fn) return SEGFAULT;
+  size_t step = view->type_size * view->stride;
+  for (size_t i = 0; i < view->size; i++) {
+    fn(view->data + step * i, ctx);
+  }
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t transform_StrictArray(StrictArray *arr, void (*fn)(void *item, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief call \i `fn` on every element of the array, in order
+ *
+ * @param[in] arr a pointer to \c `StrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] fn the function modifying an element in place
+ * (fn is not a null pointer)
+ * @param[in] ctx the context given to every call
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t transform_StrictArray(StrictArray *arr, void (*fn)(void *item, void *ctx), void *ctx) {
+  ArrayView view;
+  status_t status = view_StrictArray(arr, &view);
+  if (status != NO_ERROR) return status;
+  return transform_ArrayView(&view, fn, ctx);
+}
+
+/**
+ * @fn status_t reduce_ArrayView(const ArrayView *view, void *acc, void (*fn)(void *acc, const void *item, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief fold every element of the view, in order, into \i `acc`
+ *
+ * @param[in] view a pointer to \c `ArrayView` type
+ * (if view is a null pointer then an error of invalid instance is returned)
+ * @param[in,out] acc the accumulator, holding the initial value
+ * @param[in] fn the function folding an element into the accumulator
+ * (fn is not a null pointer)
+ * @param[in] ctx the context given to every call
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t reduce_ArrayView(const ArrayView *view, void *acc,
+                                    void (*fn)(void *acc, const void *item, void *ctx), void *ctx) {
+  if (!view || !acc || !fn) return SEGFAULT;
+  size_t step = view->type_size * view->stride;
+  for (size_t i = 0; i < view->size; i++) {
+    fn(acc, view->data + step * i, ctx);
+  }
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t reduce_StrictArray(StrictArray *arr, void *acc, void (*fn)(void *acc, const void *item, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief fold every element of the array, in order, into \i `acc`
+ *
+ * @param[in] arr a pointer to \c `StrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in,out] acc the accumulator, holding the initial value
+ * @param[in] fn the function folding an element into the accumulator
+ * (fn is not a null pointer)
+ * @param[in] ctx the context given to every call
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t reduce_StrictArray(StrictArray *arr, void *acc,
+                                      void (*fn)(void *acc, const void *item, void *ctx), void *ctx) {
+  ArrayView view;
+  status_t status = view_StrictArray(arr, &view);
+  if (status != NO_ERROR) return status;
+  return reduce_ArrayView(&view, acc, fn, ctx);
+}
+
+/**
+ * @fn status_t parallel_sort_ArrayView(ThreadPool *pool, const ArrayView *view, Comparator cmp)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief sort the elements of the view with the threads of \i `pool`
+ *
+ * Every chunk is sorted by \c `qsort`, then the chunks are merged, so the sort
+ * is not stable and uses a temporary buffer of \i `size` elements (two on a
+ * strided view).
+ *
+ * @param[in] pool the pool running the tasks
+ * (if pool is a null pointer then the sort is sequential)
+ * @param[in] view a pointer to \c `ArrayView` type
+ * (if view is a null pointer then an error of invalid instance is returned)
+ * @param[in] cmp a comparator returning a negative, zero or positive value
+ * (cmp is not a null pointer)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t parallel_sort_ArrayView(ThreadPool *pool, const ArrayView *view, Comparator cmp) {
+  if (!view || !cmp) return SEGFAULT;
+  return sort_view_bytes(pool, view, cmp, 0);
+}
+
+/**
+ * @fn status_t parallel_sort_StrictArray(ThreadPool *pool, StrictArray *arr, Comparator cmp)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief sort the elements of the array with the threads of \i `pool`
+ *
+ * Every chunk is sorted by \c `qsort`, then the chunks are merged, so the sort
+ * is not stable and uses a temporary buffer of \i `size` elements.
+ *
+ * @param[in] pool the pool running the tasks
+ * (if pool is a null pointer then the sort is sequential)
+ * @param[in] arr a pointer to \c `StrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] cmp a comparator returning a negative, zero or positive value
+ * (cmp is not a null pointer)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t parallel_sort_StrictArray(ThreadPool *pool, StrictArray *arr, Comparator cmp) {
+  ArrayView view;
+  status_t status = view_StrictArray(arr, &view);
+  if (status != NO_ERROR) return status;
+  return parallel_sort_ArrayView(pool, &view, cmp);
+}
+
+/**
+ * @fn status_t parallel_stable_sort_ArrayView(ThreadPool *pool, const ArrayView *view, Comparator cmp)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief stable sort of the elements of the view with the threads of \i `pool`
+ *
+ * Every chunk is merge sorted, then the chunks are merged, the temporary buffer
+ * holds \i `size` elements (two on a strided view).
+ *
+ * @param[in] pool the pool running the tasks
+ * (if pool is a null pointer then the sort is sequential)
+ * @param[in] view a pointer to \c `ArrayView` type
+ * (if view is a null pointer then an error of invalid instance is returned)
+ * @param[in] cmp a comparator returning a negative, zero or positive value
+ * (cmp is not a null pointer)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t parallel_stable_sort_ArrayView(ThreadPool *pool, const ArrayView *view, Comparator cmp) {
+  if (!view || !cmp) return SEGFAULT;
+  return sort_view_bytes(pool, view, cmp, 1);
+}
+
+/**
+ * @fn status_t parallel_stable_sort_StrictArray(ThreadPool *pool, StrictArray *arr, Comparator cmp)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief stable sort of the elements of the array with the threads of \i `pool`
+ *
+ * Every chunk is merge sorted, then the chunks are merged, the temporary buffer
+ * holds \i `size` elements.
+ *
+ * @param[in] pool the pool running the tasks
+ * (if pool is a null pointer then the sort is sequential)
+ * @param[in] arr a pointer to \c `StrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] cmp a comparator returning a negative, zero or positive value
+ * (cmp is not a null pointer)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t parallel_stable_sort_StrictArray(ThreadPool *pool, StrictArray *arr, Comparator cmp) {
+  ArrayView view;
+  status_t status = view_StrictArray(arr, &view);
+  if (status != NO_ERROR) return status;
+  return parallel_stable_sort_ArrayView(pool, &view, cmp);
+}
+
+/**
+ * @fn status_t parallel_transform_ArrayView(ThreadPool *pool, const ArrayView *view, void (*fn)(void *item, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief call \i `fn` on every element of the view with the threads of \i `pool`
+ *
+ * The calls happen in any order and at the same time, \i `fn` must only
+ * modify the element it is given.
+ *
+ * @param[in] pool the pool running the tasks
+ * (if pool is a null pointer then the calls are sequential)
+ * @param[in] view a pointer to \c `ArrayView` type
+ * (if view is a null pointer then an error of invalid instance is returned)
+ * @param[in] fn the function modifying an element in place
+ * (fn is not a null pointer)
+ * @param[in] ctx the context given to every call
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t parallel_transform_ArrayView(ThreadPool *pool, const ArrayView *view,
+                                                void (*fn)(void *item, void *ctx), void *ctx) {
+  if (!view || !fn) return SEGFAULT;
+  ChunkJob job = {
+    .data = view->data, .n = view->size, .step = view->type_size * view->stride,
+    .chunks = chunk_count_ThreadPool(pool, view->size, 4), .transform = fn, .ctx = ctx
+  };
+  return run_ThreadPool(pool, job.chunks, transform_chunk_task, &job);
+}
+
+/**
+ * @fn status_t parallel_transform_StrictArray(ThreadPool *pool, StrictArray *arr, void (*fn)(void *item, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief call \i `fn` on every element of the array with the threads of \i `pool`
+ *
+ * The calls happen in any order and at the same time, \i `fn` must only
+ * modify the element it is given.
+ *
+ * @param[in] pool the pool running the tasks
+ * (if pool is a null pointer then the calls are sequential)
+ * @param[in] arr a pointer to \c `StrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] fn the function modifying an element in place
+ * (fn is not a null pointer)
+ * @param[in] ctx the context given to every call
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t parallel_transform_StrictArray(ThreadPool *pool, StrictArray *arr,
+                                                  void (*fn)(void *item, void *ctx), void *ctx) {
+  ArrayView view;
+  status_t status = view_StrictArray(arr, &view);
+  if (status != NO_ERROR) return status;
+  return parallel_transform_ArrayView(pool, &view, fn, ctx);
+}
+
+/**
+ * @fn status_t parallel_reduce_ArrayView(ThreadPool *pool, const ArrayView *view, void *acc, size_t acc_size, void (*fn)(void *acc, const void *item, void *ctx), void (*combine)(void *acc, const void *other, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief fold every element of the view into \i `acc` with the threads of \i `pool`
+ *
+ * Every chunk is folded by \i `fn` into its own partial accumulator, starting
+ * as a copy of \i `acc`, then the partials are folded in order into \i `acc`
+ * by \i `combine`. So the initial value of \i `acc` must be an identity (e.g. 0
+ * for a sum) and \i `combine` associative, but it does not need to commute.
+ *
+ * @param[in] pool the pool running the tasks
+ * (if pool is a null pointer then the reduction is sequential)
+ * @param[in] view a pointer to \c `ArrayView` type
+ * (if view is a null pointer then an error of invalid instance is returned)
+ * @param[in,out] acc the accumulator, holding the identity
+ * @param[in] acc_size the size in bytes of the accumulator
+ * @param[in] fn the function folding an element into an accumulator
+ * (fn is not a null pointer)
+ * @param[in] combine the function folding an accumulator into another one
+ * (combine is not a null pointer)
+ * @param[in] ctx the context given to every call
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t parallel_reduce_ArrayView(ThreadPool *pool, const ArrayView *view, void *acc, size_t acc_size,
+                                             void (*fn)(void *acc, const void *item, void *ctx),
+                                             void (*combine)(void *acc, const void *other, void *ctx),
+                                             void *ctx) {
+  if (!view || !acc || !fn || !combine) return SEGFAULT;
+  size_t chunks = chunk_count_ThreadPool(pool, view->size, 4);
+  if (chunks == 1) return reduce_ArrayView(view, acc, fn, ctx);
+
+  char *partials = (char*)malloc(acc_size * chunks);
+  if (!partials) return HEAP_FAILURE;
+  for (size_t i = 0; i < chunks; i++) {
+    memcpy(partials + acc_size * i, acc, acc_size);
+  }
+  ChunkJob job = {
+    .data = view->data, .n = view->size, .step = view->type_size * view->stride, .chunks = chunks,
+    .reduce = fn, .ctx = ctx, .partials = partials, .acc_size = acc_size
+  };
+  run_ThreadPool(pool, chunks, reduce_chunk_task, &job);
+  for (size_t i = 0; i < chunks; i++) {
+    combine(acc, partials + acc_size * i, ctx);
+  }
+  free(partials);
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t parallel_reduce_StrictArray(ThreadPool *pool, StrictArray *arr, void *acc, size_t acc_size, void (*fn)(void *acc, const void *item, void *ctx), void (*combine)(void *acc, const void *other, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief fold every element of the array into \i `acc` with the threads of \i `pool`
+ *
+ * The same as \c `parallel_reduce_ArrayView` over the [0, \i `size` - 1]
+ * elements of the array.
+ */
+C_DSA_API status_t parallel_reduce_StrictArray(ThreadPool *pool, StrictArray *arr, void *acc, size_t acc_size,
+                                               void (*fn)(void *acc, const void *item, void *ctx),
+                                               void (*combine)(void *acc, const void *other, void *ctx),
+                                               void *ctx) {
+  ArrayView view;
+  status_t status = view_StrictArray(arr, &view);
+  if (status != NO_ERROR) return status;
+  return parallel_reduce_ArrayView(pool, &view, acc, acc_size, fn, combine, ctx);
+}
+
+#endif // __C_DSA_GENERIC_ALGORITHMS_H__
@@ -0,0 +1,428 @@
+/**
+ * @file generic/serialization.h
+ * @brief a binary format for the generic arrays and zero-copy views of it
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details A serialized array is a \c `WireHeader` followed by the elements
+ * (the [0, \i `size` - 1] elements of a \c `StrictArray`, every element of an
+ * \c `Array`). The header holds a magic, a version, the kind of array, the
+ * byte order and word size of the writer, \i `type_size`, \i `size`,
+ * \i `capacity` and a checksum of the elements and of these fields.
+ * The header ends with \c `C_DSA_WIRE_RESERVED` zero bytes: once a received
+ * buffer is validated, \c `view_from_buffer_T` lays the array's header out
+ * there, right before the elements, and returns the array in place, without
+ * allocation or copy. Such a view must only be read, its capacity is its size
+ * and \c `free_T` does not deallocate it (the \i `allocator` is a null pointer).
+ * Writing to a file descriptor sends the header and the elements with a
+ * single \c `writev`, so the elements are not copied to a staging buffer.
+ * The functions writing to a file descriptor need POSIX, e.g.
+ * \c `_POSIX_C_SOURCE` 200809L defined before including any header.
+ *
+ * Serialization's APIs:
+ * @li serialized_bytes_T : the size of the serialized type T
+ * @li serialize_T : write type T to a file descriptor
+ * @li serialize_to_buffer_T : write type T to a buffer
+ * @li deserialize_T : validate a buffer and copy it into a new type T
+ * @li view_from_buffer_T : validate a buffer and use it as a read-only type T
+ */
+#ifndef __C_DSA_GENERIC_SERIALIZATION_H__
+#define __C_DSA_GENERIC_SERIALIZATION_H__
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "StrictArray.h"
+#include "Array.h"
+
+#define C_DSA_WIRE_MAGIC "CDSA"
+#define C_DSA_WIRE_VERSION 2u
+#define C_DSA_WIRE_BYTE_ORDER 0x01020304u
+#define C_DSA_WIRE_STRICT_ARRAY 1u
+#define C_DSA_WIRE_ARRAY 2u
+
+/**
+ * @brief the size of the room left at the end of the header for the header
+ * of a view
+ */
+#define C_DSA_WIRE_RESERVED 32
+
+typedef struct WireHeader WireHeader;
+
+/**
+ * @struct WireHeader
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the header of a serialized array
+ *
+ * \i `byte_order` is \c `C_DSA_WIRE_BYTE_ORDER` written in the byte order of
+ * the writer and \i `word_size` is its \c `sizeof(size_t)`, so a buffer from a
+ * different machine is rejected instead of misread.
+ */
+struct WireHeader {
+  char magic[4];
+  uint16_t version, kind;
+  uint32_t byte_order, word_size;
+  uint64_t type_size, size, capacity, checksum;
+  _Alignas(8) char reserved[C_DSA_WIRE_RESERVED];
+};
+
+_Static_assert(sizeof(StrictArray) <= C_DSA_WIRE_RESERVED, "a StrictArray header must fit in the reserved bytes");
+_Static_assert(sizeof(Array) <= C_DSA_WIRE_RESERVED, "an Array header must fit in the reserved bytes");
+
+/**
+ * @brief a 64 bits checksum of \i `bytes` bytes, reading 8 bytes at a time
+ */
+C_DSA_API uint64_t checksum_bytes_WireHeader(const void *data, size_t bytes, uint64_t seed) {
+  const unsigned char *p = (const unsigned char*)data;
+  uint64_t hash = seed ^ 0x9e3779b97f4a7c15ull;
+  size_t i = 0;
+  for (; i + 8 <= bytes; i += 8) {
+    uint64_t word;
+    memcpy(&word, p + i, 8);
+    hash = (hash ^ word) * 0x100000001b3ull;
+    hash ^= hash >> 29;
+  }
+  for (; i < bytes; i++) {
+    hash = (hash ^ p[i]) * 0x100000001b3ull;
+  }
+  return hash ^ (hash >> 32);
+}
+
+/**
+ * @brief the checksum of the elements, seeded by every byte of the header
+ * before \i `checksum`
+ */
+C_DSA_API uint64_t checksum_WireHeader(const WireHeader *header, const void *data) {
+  uint64_t seed = checksum_bytes_WireHeader(header, offsetof(WireHeader, checksum), 0);
+  return checksum_bytes_WireHeader(data, (size_t)(header->type_size * header->size), seed);
+}
+
+C_DSA_API WireHeader fill_WireHeader(uint16_t kind, size_t type_size, size_t size, size_t capacity,
+                                     const void *data) {
+  WireHeader header;
+  memset(&header, 0, sizeof(WireHeader));
+  memcpy(header.magic, C_DSA_WIRE_MAGIC, sizeof(header.magic));
+  header.version = C_DSA_WIRE_VERSION, header.kind = kind;
+  header.byte_order = C_DSA_WIRE_BYTE_ORDER, header.word_size = (uint32_t)sizeof(size_t);
+  header.type_size = type_size, header.size = size, header.capacity = capacity;
+  header.checksum = checksum_WireHeader(&header, data);
+  return header;
+}
+
+/**
+ * @brief check a buffer holding a serialized array of kind \i `kind`
+ *
+ * @return a error message or a null pointer if the buffer is valid
+ */
+C_DSA_API const char *validate_WireHeader(const void *buffer, size_t bytes, uint16_t kind) {
+  if (bytes < sizeof(WireHeader)) return "FormatError: the buffer is smaller than the header\n";
+  WireHeader header;
+  memcpy(&header, buffer, sizeof(WireHeader));
+  if (memcmp(header.magic, C_DSA_WIRE_MAGIC, sizeof(header.magic))) {
+    return "FormatError: the buffer does not hold an array\n";
+  }
+  if (header.version != C_DSA_WIRE_VERSION) return "FormatError: unsupported version\n";
+  if (header.kind != kind) return "FormatError: the buffer holds another kind of array\n";
+  if (header.byte_order != C_DSA_WIRE_BYTE_ORDER || header.word_size != sizeof(size_t)) {
+    return "FormatError: the buffer was written by a machine of another byte order or word size\n";
+  }
+  if (header.type_size <= 0 || header.size > header.capacity ||
+      (kind == C_DSA_WIRE_ARRAY && header.size != header.capacity) ||
+      header.size > (bytes - sizeof(WireHeader)) / header.type_size ||
+      header.capacity > SIZE_MAX / header.type_size) {
+    return "FormatError: the elements do not fit in the buffer\n";
+  }
+  if (checksum_WireHeader(&header, (const char*)buffer + sizeof(WireHeader)) != header.checksum) {
+    return "FormatError: checksum mismatch\n";
+  }
+  return NULL;
+}
+
+/**
+ * @brief write the \i `count` buffers with \c `writev`, until everything is written
+ */
+C_DSA_API status_t write_all_WireHeader(int fd, struct iovec *iov, int count) {
+  while (count > 0) {
+    ssize_t written = writev(fd, iov, count);
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      return IO_FAILURE;
+    }
+    // skips the buffers written completely, then the written part of the next one
+    while (count > 0 && (size_t)written >= iov->iov_len) {
+      written -= (ssize_t)iov->iov_len;
+      iov++, count--;
+    }
+    if (count > 0) {
+      iov->iov_base = (char*)iov->iov_base + written;
+      iov->iov_len -= (size_t)written;
+    }
+  }
+  return NO_ERROR;
+}
+
+C_DSA_API status_t serialize_bytes_WireHeader(int fd, const WireHeader *header, const void *data, size_t bytes) {
+  struct iovec iov[2] = {
+    { .iov_base = (void*)header, .iov_len = sizeof(WireHeader) },
+    { .iov_base = (void*)data, .iov_len = bytes }
+  };
+  return write_all_WireHeader(fd, iov, bytes ? 2 : 1);
+}
+
+/**
+ * @fn size_t serialized_bytes_StrictArray(StrictArray *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the size in bytes of the serialized array, 0 if arr is a null pointer
+ */
+C_DSA_API size_t serialized_bytes_StrictArray(StrictArray *arr) {
+  if (!arr) return 0;
+  return sizeof(WireHeader) + arr->type_size * arr->size;
+}
+
+/**
+ * @fn status_t serialize_StrictArray(StrictArray *arr, int fd)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write the serialized array to the file descriptor \i `fd`
+ *
+ * The header and the elements are written by one \c `writev` call (more only if
+ * the descriptor accepts a part of them).
+ *
+ * @param[in] arr a pointer to \c `StrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] fd a file descriptor open for writing (a file, a pipe or a socket)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t serialize_StrictArray(StrictArray *arr, int fd) {
+  if (!arr) return SEGFAULT;
+  WireHeader header = fill_WireHeader(C_DSA_WIRE_STRICT_ARRAY, arr->type_size, arr->size, arr->capacity, arr->data);
+  return serialize_bytes_WireHeader(fd, &header, arr->data, arr->type_size * arr->size);
+}
+
+/**
+ * @fn status_t serialize_to_buffer_StrictArray(StrictArray *arr, void *buffer, size_t bytes)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write the serialized array to \i `buffer`
+ *
+ * @param[in] arr a pointer to \c `StrictArray` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[out] buffer the destination
+ * (if buffer is a null pointer then an error of invalid instance is returned)
+ * @param[in] bytes the size of \i `buffer`
+ * (bytes >= \c `serialized_bytes_StrictArray(arr)`)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t serialize_to_buffer_StrictArray(StrictArray *arr, void *buffer, size_t bytes) {
+  if (!arr || !buffer) return SEGFAULT;
+  if (bytes < serialized_bytes_StrictArray(arr)) return NO_SPACE;
+  WireHeader header = fill_WireHeader(C_DSA_WIRE_STRICT_ARRAY, arr->type_size, arr->size, arr->capacity, arr->data);
+  memcpy(buffer, &header, sizeof(WireHeader));
+  memcpy((char*)buffer + sizeof(WireHeader), arr->data, arr->type_size * arr->size);
+  return NO_ERROR;
+}
+
+/**
+ * @fn Result deserialize_StrictArray(const void *buffer, size_t bytes)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief validate a serialized array and copy it into a new \c `StrictArray`
+ *
+ * The new array gets a capacity of its size: the serialized capacity is not
+ * trusted to size an allocation, as a small buffer could ask for any capacity.
+ *
+ * @param[in] buffer the serialized array
+ * (buffer is not a null pointer)
+ * @param[in] bytes the size of \i `buffer`
+ *
+ * @return a \c `Result` type to the new array or a error message
+ */
+C_DSA_API Result deserialize_StrictArray(const void *buffer, size_t bytes) {
+  if (!buffer) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  const char *error = validate_WireHeader(buffer, bytes, C_DSA_WIRE_STRICT_ARRAY);
+  if (error) {
+    return (Result) {
+      .ok = IO_FAILURE,
+      .error_msg = error
+    };
+  }
+  WireHeader header;
+  memcpy(&header, buffer, sizeof(WireHeader));
+  return new_StrictArray((char*)buffer + sizeof(WireHeader), (size_t)header.size,
+                         (size_t)header.size, (size_t)header.type_size);
+}
+
+/**
+ * @fn Result view_from_buffer_StrictArray(void *buffer, size_t bytes)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief validate a serialized array and use it in place as a \c `StrictArray`
+ *
+ * The array's header is written over the reserved bytes at the end of the
+ * serialized header (so the buffer cannot be validated again), the elements
+ * are neither moved nor copied. The array lives in \i `buffer`, it must only
+ * be read and its capacity is its size.
+ *
+ * @param[in] buffer the serialized array
+ * (aligned to \c `_Alignof(WireHeader)`)
+ * @param[in] bytes the size of \i `buffer`
+ *
+ * @return a \c `Result` type to the array (inside \i `buffer`) or a error message
+ */
+C_DSA_API Result view_from_buffer_StrictArray(void *buffer, size_t bytes) {
+  if (!buffer) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  if ((size_t)buffer % _Alignof(WireHeader)) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Buffer is not aligned for the header\n"
+    };
+  }
+  const char *error = validate_WireHeader(buffer, bytes, C_DSA_WIRE_STRICT_ARRAY);
+  if (error) {
+    return (Result) {
+      .ok = IO_FAILURE,
+      .error_msg = error
+    };
+  }
+  WireHeader *header = (WireHeader*)buffer;
+  StrictArray *result = (StrictArray*)((char*)buffer + sizeof(WireHeader) - sizeof(StrictArray));
+  size_t size = (size_t)header->size, type_size = (size_t)header->type_size;
+  result->size = size, result->capacity = size, result->type_size = type_size;
+  result->allocator = NULL;
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn size_t serialized_bytes_Array(Array *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the size in bytes of the serialized array, 0 if arr is a null pointer
+ */
+C_DSA_API size_t serialized_bytes_Array(Array *arr) {
+  if (!arr) return 0;
+  return sizeof(WireHeader) + arr->type_size * arr->capacity;
+}
+
+/**
+ * @fn status_t serialize_Array(Array *arr, int fd)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write the serialized array to the file descriptor \i `fd`
+ *
+ * The same as \c `serialize_StrictArray`, every element of the array is written.
+ */
+C_DSA_API status_t serialize_Array(Array *arr, int fd) {
+  if (!arr) return SEGFAULT;
+  WireHeader header = fill_WireHeader(C_DSA_WIRE_ARRAY, arr->type_size, arr->capacity, arr->capacity, arr->data);
+  return serialize_bytes_WireHeader(fd, &header, arr->data, arr->type_size * arr->capacity);
+}
+
+/**
+ * @fn status_t serialize_to_buffer_Array(Array *arr, void *buffer, size_t bytes)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write the serialized array to \i `buffer`
+ *
+ * The same as \c `serialize_to_buffer_StrictArray`, every element of the array
+ * is written.
+ */
+C_DSA_API status_t serialize_to_buffer_Array(Array *arr, void *buffer, size_t bytes) {
+  if (!arr || !buffer) return SEGFAULT;
+  if (bytes < serialized_bytes_Array(arr)) return NO_SPACE;
+  WireHeader header = fill_WireHeader(C_DSA_WIRE_ARRAY, arr->type_size, arr->capacity, arr->capacity, arr->data);
+  memcpy(buffer, &header, sizeof(WireHeader));
+  memcpy((char*)buffer + sizeof(WireHeader), arr->data, arr->type_size * arr->capacity);
+  return NO_ERROR;
+}
+
+/**
+ * @fn Result deserialize_Array(const void *buffer, size_t bytes)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief validate a serialized array and copy it into a new \c `Array`
+ */
+C_DSA_API Result deserialize_Array(const void *buffer, size_t bytes) {
+  if (!buffer) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  const char *error = validate_WireHeader(buffer, bytes, C_DSA_WIRE_ARRAY);
+  if (error) {
+    return (Result) {
+      .ok = IO_FAILURE,
+      .error_msg = error
+    };
+  }
+  WireHeader header;
+  memcpy(&header, buffer, sizeof(WireHeader));
+  return new_Array((char*)buffer + sizeof(WireHeader), (size_t)header.size,
+                   (size_t)header.capacity, (size_t)header.type_size);
+}
+
+/**
+ * @fn Result view_from_buffer_Array(void *buffer, size_t bytes)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief validate a serialized array and use it in place as an \c `Array`
+ *
+ * The same as \c `view_from_buffer_StrictArray`.
+ */
+C_DSA_API Result view_from_buffer_Array(void *buffer, size_t bytes) {
+  if (!buffer) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  if ((size_t)buffer % _Alignof(WireHeader)) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Buffer is not aligned for the header\n"
+    };
+  }
+  const char *error = validate_WireHeader(buffer, bytes, C_DSA_WIRE_ARRAY);
+  if (error) {
+    return (Result) {
+      .ok = IO_FAILURE,
+      .error_msg = error
+    };
+  }
+  WireHeader *header = (WireHeader*)buffer;
+  Array *result = (Array*)((char*)buffer + sizeof(WireHeader) - sizeof(Array));
+  size_t capacity = (size_t)header->capacity, type_size = (size_t)header->type_size;
+  result->capacity = capacity, result->type_size = type_size;
+  result->allocator = NULL;
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+#endif // __C_DSA_GENERIC_SERIALIZATION_H__
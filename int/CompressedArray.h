@@ -0,0 +1,518 @@
+/**
+ * @file int/CompressedArray.h
+ * @brief a read-only compressed array of integers
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details This library introduces a structure \c `CompressedArray_int`, an
+ * immutable copy of integers encoded in blocks of \c `C_DSA_COMPRESSED_BLOCK`
+ * integers, each block with one of two codecs:
+ * @li \c `C_DSA_CODEC_FOR` (frame of reference): the block stores its smallest
+ * integer and every integer minus it on the fewest bits holding the greatest
+ * difference, so small values or values in a narrow range take a few bits.
+ * The bits are packed in 4 interleaved lanes (integer \i `i` is in lane
+ * \i `i % 4`), so a SSE2 decoder unpacks 4 integers per instruction, and so the
+ * integer \i `i` is read directly.
+ * @li \c `C_DSA_CODEC_DELTA_VARINT` : the block stores its first integer and the
+ * differences between consecutive integers, zigzag encoded (small negative
+ * differences become small numbers) as variable length bytes of 7 bits, so
+ * monotone identifiers take about a byte. Decoding is sequential.
+ *
+ * With \c `C_DSA_CODEC_AUTO` every block gets the smaller of the two encodings
+ * (the frame of reference on a tie, it decodes faster).
+ * An integer is read by decoding at most its block, every block is decoded
+ * into a buffer of \c `C_DSA_COMPRESSED_BLOCK` integers or into a
+ * \c `StrictArray_int` directly, and \c `stream_CompressedArray_int` hands each
+ * decoded block to a callback, so an array is scanned with one block in cache.
+ * The block index and the encoded bytes follow the header in a single
+ * allocation, addressed by offsets.
+ *
+ * CompressedArray_int's APIs:
+ * @li new_T : compress integers into type T on the heap
+ * @li new_T_with_allocator : compress integers into type T with an \c `Allocator`
+ * @li compress_StrictArray_int : compress the elements of a \c `StrictArray_int`
+ * @li free_T : deallocate type T
+ * @li bytes_T : the memory taken by type T
+ * @li get_item_T : read one integer of T
+ * @li decode_block_T : decode a block of T
+ * @li decode_T : decode T into a \c `StrictArray_int`
+ * @li decompress_T : decode T into a new \c `StrictArray_int`
+ * @li stream_T : decode T a block at a time through a callback
+ */
+#ifndef __C_DSA_INT_COMPRESSED_ARRAY_H__
+#define __C_DSA_INT_COMPRESSED_ARRAY_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+#include "../utils/checked.h"
+#include "StrictArray.h"
+#include "kernels.h"
+
+#define C_DSA_COMPRESSED_BLOCK 128
+#define C_DSA_COMPRESSED_LANES 4
+
+typedef enum {
+  C_DSA_CODEC_AUTO,
+  C_DSA_CODEC_FOR,
+  C_DSA_CODEC_DELTA_VARINT
+} codec_t;
+
+typedef struct CompressedBlock_int CompressedBlock_int;
+typedef struct CompressedArray_int CompressedArray_int;
+
+/**
+ * @struct CompressedBlock_int
+ * @author andarling
+ * @date 14/10/2026
+ * @brief where a block is and how to decode it
+ *
+ * \i `base` is the smallest integer of a frame of reference block and the
+ * first integer of a delta block, \i `bits` the width of the packed integers
+ * of a frame of reference block.
+ */
+struct CompressedBlock_int {
+  size_t offset;
+  int base;
+  unsigned char codec, bits;
+};
+
+/**
+ * @struct CompressedArray_int
+ * @author andarling
+ * @date 14/10/2026
+ * @brief \i `size` integers in \i `block_count` blocks
+ *
+ * \i `data` holds the \i `block_count` blocks, then from \i `payload` the
+ * encoded bytes, the frame of reference blocks being aligned on 16 bytes.
+ */
+struct CompressedArray_int {
+  size_t size, block_count, payload, bytes;
+  const Allocator *allocator;
+  _Alignas(16) unsigned char data[];
+};
+
+C_DSA_API const CompressedBlock_int *blocks_CompressedArray_int(const CompressedArray_int *arr) {
+  return (const CompressedBlock_int*)arr->data;
+}
+
+C_DSA_API const unsigned char *payload_CompressedArray_int(const CompressedArray_int *arr,
+                                                           const CompressedBlock_int *block) {
+  return arr->data + arr->payload + block->offset;
+}
+
+C_DSA_API size_t block_size_CompressedArray_int(const CompressedArray_int *arr, size_t block) {
+  return block + 1 < arr->block_count ? C_DSA_COMPRESSED_BLOCK
+       : arr->size - block * C_DSA_COMPRESSED_BLOCK;
+}
+
+C_DSA_API uint32_t zigzag_encode(uint32_t delta) {
+  return (delta << 1) ^ (0u - (delta >> 31));
+}
+
+C_DSA_API uint32_t zigzag_decode(uint32_t value) {
+  return (value >> 1) ^ (0u - (value & 1));
+}
+
+C_DSA_API size_t varint_bytes(uint32_t value) {
+  size_t bytes = 1;
+  while (value >= 0x80) {
+    value >>= 7;
+    bytes++;
+  }
+  return bytes;
+}
+
+C_DSA_API unsigned bit_width(uint32_t value) {
+  unsigned bits = 0;
+  while (bits < 32 && (value >> bits)) bits++;
+  return bits;
+}
+
+// the bytes of a frame of reference block, 32 integers per lane
+C_DSA_API size_t for_bytes(unsigned bits) {
+  return (size_t)bits * (C_DSA_COMPRESSED_BLOCK / 32) * sizeof(uint32_t);
+}
+
+C_DSA_API size_t delta_bytes(const int *data, size_t n) {
+  size_t bytes = 0;
+  for (size_t i = 1; i < n; i++) {
+    bytes += varint_bytes(zigzag_encode((uint32_t)data[i] - (uint32_t)data[i - 1]));
+  }
+  return bytes;
+}
+
+/**
+ * @brief choose the codec of the \i `n` integers of a block and fill in its
+ * \i `base` and \i `bits`, returning its encoded bytes
+ */
+C_DSA_API size_t plan_block_CompressedArray_int(const int *data, size_t n, codec_t codec,
+                                                CompressedBlock_int *block) {
+  int min = data[0];
+  for (size_t i = 1; i < n; i++) min = data[i] < min ? data[i] : min;
+  uint32_t range = 0;
+  for (size_t i = 0; i < n; i++) {
+    uint32_t value = (uint32_t)data[i] - (uint32_t)min;
+    range = value > range ? value : range;
+  }
+  unsigned bits = bit_width(range);
+  size_t packed = for_bytes(bits);
+  size_t delta = codec == C_DSA_CODEC_FOR ? 0 : delta_bytes(data, n);
+  if (codec == C_DSA_CODEC_DELTA_VARINT || (codec == C_DSA_CODEC_AUTO && delta < packed)) {
+    *block = (CompressedBlock_int) { .base = data[0], .codec = C_DSA_CODEC_DELTA_VARINT };
+    return delta;
+  }
+  *block = (CompressedBlock_int) { .base = min, .codec = C_DSA_CODEC_FOR, .bits = (unsigned char)bits };
+  return packed;
+}
+
+C_DSA_API void pack_block_CompressedArray_int(const int *data, size_t n, const CompressedBlock_int *block,
+                                              unsigned char *out) {
+  if (block->codec == C_DSA_CODEC_DELTA_VARINT) {
+    for (size_t i = 1; i < n; i++) {
+      uint32_t value = zigzag_encode((uint32_t)data[i] - (uint32_t)data[i - 1]);
+      for (; value >= 0x80; value >>= 7) *out++ = (unsigned char)(value | 0x80);
+      *out++ = (unsigned char)value;
+    }
+    return;
+  }
+  unsigned bits = block->bits;
+  uint32_t *words = (uint32_t*)out;
+  memset(words, 0, for_bytes(bits));
+  if (!bits) return;
+  // the missing integers of the last block are packed as zeros
+  for (size_t i = 0; i < n; i++) {
+    uint32_t value = (uint32_t)data[i] - (uint32_t)block->base;
+    size_t lane = i % C_DSA_COMPRESSED_LANES, position = (i / C_DSA_COMPRESSED_LANES) * bits;
+    size_t word = position / 32;
+    unsigned shift = position % 32;
+    words[C_DSA_COMPRESSED_LANES * word + lane] |= value << shift;
+    if (shift + bits > 32) words[C_DSA_COMPRESSED_LANES * (word + 1) + lane] |= value >> (32 - shift);
+  }
+}
+
+C_DSA_API int unpack_one_CompressedArray_int(const unsigned char *payload, const CompressedBlock_int *block,
+                                             size_t i) {
+  unsigned bits = block->bits;
+  if (!bits) return block->base;
+  const uint32_t *words = (const uint32_t*)payload;
+  size_t lane = i % C_DSA_COMPRESSED_LANES, position = (i / C_DSA_COMPRESSED_LANES) * bits;
+  size_t word = position / 32;
+  unsigned shift = position % 32;
+  uint32_t value = words[C_DSA_COMPRESSED_LANES * word + lane] >> shift;
+  if (shift + bits > 32) value |= words[C_DSA_COMPRESSED_LANES * (word + 1) + lane] << (32 - shift);
+  if (bits < 32) value &= ((uint32_t)1 << bits) - 1;
+  return (int)(value + (uint32_t)block->base);
+}
+
+// decode a full frame of reference block, out has room for C_DSA_COMPRESSED_BLOCK integers
+C_DSA_API void unpack_block_CompressedArray_int(const unsigned char *payload, const CompressedBlock_int *block,
+                                                int *out) {
+  unsigned bits = block->bits;
+  if (!bits) {
+    for (size_t i = 0; i < C_DSA_COMPRESSED_BLOCK; i++) out[i] = block->base;
+    return;
+  }
+#if defined(C_DSA_SIMD_AVX2) || defined(C_DSA_SIMD_SSE2)
+  const __m128i *words = (const __m128i*)payload;
+  __m128i base = _mm_set1_epi32(block->base);
+  __m128i mask = _mm_set1_epi32(bits < 32 ? (int)(((uint32_t)1 << bits) - 1) : -1);
+  for (size_t k = 0; k < C_DSA_COMPRESSED_BLOCK / C_DSA_COMPRESSED_LANES; k++) {
+    size_t position = k * bits, word = position / 32;
+    unsigned shift = position % 32;
+    __m128i value = _mm_srl_epi32(_mm_loadu_si128(words + word), _mm_cvtsi32_si128((int)shift));
+    if (shift + bits > 32) {
+      __m128i high = _mm_loadu_si128(words + word + 1);
+      value = _mm_or_si128(value, _mm_sll_epi32(high, _mm_cvtsi32_si128((int)(32 - shift))));
+    }
+    value = _mm_add_epi32(_mm_and_si128(value, mask), base);
+    _mm_storeu_si128((__m128i*)(out + C_DSA_COMPRESSED_LANES * k), value);
+  }
+#else
+  for (size_t i = 0; i < C_DSA_COMPRESSED_BLOCK; i++) {
+    out[i] = unpack_one_CompressedArray_int(payload, block, i);
+  }
+#endif
+}
+
+// decode the n integers of a delta block, stopping after the first count ones
+C_DSA_API void unpack_delta_CompressedArray_int(const unsigned char *payload, const CompressedBlock_int *block,
+                                                size_t count, int *out) {
+  uint32_t value = (uint32_t)block->base;
+  out[0] = block->base;
+  for (size_t i = 1; i < count; i++) {
+    uint32_t delta = 0;
+    unsigned shift = 0;
+    unsigned char byte;
+    do {
+      byte = *payload++;
+      delta |= (uint32_t)(byte & 0x7f) << shift;
+      shift += 7;
+    } while (byte & 0x80);
+    value += zigzag_decode(delta);
+    out[i] = (int)value;
+  }
+}
+
+/**
+ * @fn Result new_CompressedArray_int_with_allocator(const int *data, size_t size, codec_t codec, const Allocator *allocator)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to the compressed copy of the \i `size`
+ * integers of \i `data`, allocated by \i `allocator`
+ *
+ * @param[in] data a pointer to the integers
+ * (if data is a null pointer then size is 0)
+ * @param[in] size the number of integers
+ * @param[in] codec the codec of every block, or \c `C_DSA_CODEC_AUTO` to choose
+ * it per block
+ * @param[in] allocator the allocator to use, it must outlive the array
+ * (allocator is not a null pointer)
+ *
+ * @return a \c `Result` type to the successfully allocated array or a error message
+ */
+C_DSA_API Result new_CompressedArray_int_with_allocator(const int *data, size_t size, codec_t codec,
+                                                        const Allocator *allocator) {
+  if (!allocator) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  if (!data) size = 0;
+  size_t block_count = size / C_DSA_COMPRESSED_BLOCK + (size % C_DSA_COMPRESSED_BLOCK != 0);
+  size_t index_bytes = 0, bytes;
+  int too_big = checked_bytes(15, block_count, sizeof(CompressedBlock_int), &index_bytes) != NO_ERROR;
+  index_bytes &= ~(size_t)15;
+
+  // the first pass sizes the blocks, the second one encodes them in place
+  size_t payload_bytes = 0;
+  for (size_t b = 0; b < block_count; b++) {
+    size_t first = b * C_DSA_COMPRESSED_BLOCK;
+    size_t n = size - first < C_DSA_COMPRESSED_BLOCK ? size - first : C_DSA_COMPRESSED_BLOCK;
+    CompressedBlock_int block;
+    size_t block_bytes = plan_block_CompressedArray_int(data + first, n, codec, &block);
+    if (block.codec == C_DSA_CODEC_FOR) {
+      too_big |= checked_add(payload_bytes, 15, &payload_bytes) != NO_ERROR;
+      payload_bytes &= ~(size_t)15;
+    }
+    too_big |= checked_add(payload_bytes, block_bytes, &payload_bytes) != NO_ERROR;
+  }
+  if (too_big || checked_add(sizeof(CompressedArray_int), index_bytes, &bytes)
+      || checked_add(bytes, payload_bytes, &bytes)) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Capacity is too big\n"
+    };
+  }
+  CompressedArray_int *result = (CompressedArray_int*)allocator->alloc(allocator->ctx, bytes);
+  if (!result) {
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+  result->size = size;
+  result->block_count = block_count;
+  result->payload = index_bytes;
+  result->bytes = bytes;
+  result->allocator = allocator;
+
+  CompressedBlock_int *blocks = (CompressedBlock_int*)result->data;
+  size_t offset = 0;
+  for (size_t b = 0; b < block_count; b++) {
+    size_t first = b * C_DSA_COMPRESSED_BLOCK;
+    size_t n = size - first < C_DSA_COMPRESSED_BLOCK ? size - first : C_DSA_COMPRESSED_BLOCK;
+    size_t block_bytes = plan_block_CompressedArray_int(data + first, n, codec, &blocks[b]);
+    if (blocks[b].codec == C_DSA_CODEC_FOR) offset = (offset + 15) & ~(size_t)15;
+    blocks[b].offset = offset;
+    pack_block_CompressedArray_int(data + first, n, &blocks[b], result->data + index_bytes + offset);
+    offset += block_bytes;
+  }
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn Result new_CompressedArray_int(const int *data, size_t size, codec_t codec)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `new_CompressedArray_int_with_allocator` on the heap
+ */
+C_DSA_API Result new_CompressedArray_int(const int *data, size_t size, codec_t codec) {
+  return new_CompressedArray_int_with_allocator(data, size, codec, &heap_allocator);
+}
+
+/**
+ * @fn Result compress_StrictArray_int(StrictArray_int *arr, codec_t codec)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief compress the elements in [0, \i `size` - 1] of \i `arr` on the heap
+ */
+C_DSA_API Result compress_StrictArray_int(StrictArray_int *arr, codec_t codec) {
+  if (!arr) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  return new_CompressedArray_int_with_allocator(arr->data, arr->size, codec, &heap_allocator);
+}
+
+/**
+ * @fn void free_CompressedArray_int(CompressedArray_int **arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief deallocate the array and set the pointer to NULL
+ */
+C_DSA_API void free_CompressedArray_int(CompressedArray_int **arr) {
+  if (!arr || !(*arr)) return;
+  const Allocator *allocator = (*arr)->allocator;
+  allocator->free(allocator->ctx, *arr, (*arr)->bytes);
+  *arr = NULL;
+}
+
+/**
+ * @fn size_t bytes_CompressedArray_int(const CompressedArray_int *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the bytes of the allocation holding the array, the header included
+ */
+C_DSA_API size_t bytes_CompressedArray_int(const CompressedArray_int *arr) {
+  return arr ? arr->bytes : 0;
+}
+
+/**
+ * @fn status_t get_item_CompressedArray_int(const CompressedArray_int *arr, size_t index, int *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief read the \i `index`-th integer
+ *
+ * A frame of reference block reads the integer directly, a delta block
+ * decodes its integers up to it.
+ *
+ * @return 0 if success, \c `INVALID_INDEX` if index is out of [0, \c `size` - 1]
+ */
+C_DSA_API status_t get_item_CompressedArray_int(const CompressedArray_int *arr, size_t index, int *out) {
+  if (!arr || !out) return SEGFAULT;
+  if (index >= arr->size) return INVALID_INDEX;
+  const CompressedBlock_int *block = blocks_CompressedArray_int(arr) + index / C_DSA_COMPRESSED_BLOCK;
+  size_t i = index % C_DSA_COMPRESSED_BLOCK;
+  if (block->codec == C_DSA_CODEC_FOR) {
+    *out = unpack_one_CompressedArray_int(payload_CompressedArray_int(arr, block), block, i);
+    return NO_ERROR;
+  }
+  int values[C_DSA_COMPRESSED_BLOCK];
+  unpack_delta_CompressedArray_int(payload_CompressedArray_int(arr, block), block, i + 1, values);
+  *out = values[i];
+  return NO_ERROR;
+}
+
+/**
+ * @fn size_t decode_block_CompressedArray_int(const CompressedArray_int *arr, size_t block, int *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief decode the integers of the \i `block`-th block, the integers from
+ * \i `block * C_DSA_COMPRESSED_BLOCK` on
+ *
+ * @param[out] out room for \c `C_DSA_COMPRESSED_BLOCK` integers
+ *
+ * @return the number of integers decoded, 0 if block is out of
+ * [0, \c `block_count` - 1]
+ */
+C_DSA_API size_t decode_block_CompressedArray_int(const CompressedArray_int *arr, size_t block, int *out) {
+  if (!arr || !out || block >= arr->block_count) return 0;
+  const CompressedBlock_int *header = blocks_CompressedArray_int(arr) + block;
+  size_t count = block_size_CompressedArray_int(arr, block);
+  if (header->codec == C_DSA_CODEC_FOR) {
+    unpack_block_CompressedArray_int(payload_CompressedArray_int(arr, header), header, out);
+  }
+  else {
+    unpack_delta_CompressedArray_int(payload_CompressedArray_int(arr, header), header, count, out);
+  }
+  return count;
+}
+
+/**
+ * @fn status_t decode_CompressedArray_int(const CompressedArray_int *arr, StrictArray_int *dst)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief replace the elements of \i `dst` by the decoded integers
+ *
+ * The full blocks are decoded in place, the last one through a buffer.
+ *
+ * @return 0 if success, \c `NO_SPACE` if the capacity of \i `dst` is less than
+ * \i `size`, in which case \i `dst` is unchanged
+ */
+C_DSA_API status_t decode_CompressedArray_int(const CompressedArray_int *arr, StrictArray_int *dst) {
+  if (!arr || !dst) return SEGFAULT;
+  if (dst->capacity < arr->size) return NO_SPACE;
+  size_t block = 0;
+  for (; (block + 1) * C_DSA_COMPRESSED_BLOCK <= arr->size; block++) {
+    decode_block_CompressedArray_int(arr, block, dst->data + block * C_DSA_COMPRESSED_BLOCK);
+  }
+  if (block < arr->block_count) {
+    int values[C_DSA_COMPRESSED_BLOCK];
+    size_t count = decode_block_CompressedArray_int(arr, block, values);
+    memcpy(dst->data + block * C_DSA_COMPRESSED_BLOCK, values, sizeof(int) * count);
+  }
+  dst->size = arr->size;
+  return NO_ERROR;
+}
+
+/**
+ * @fn Result decompress_CompressedArray_int(const CompressedArray_int *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to a new \c `StrictArray_int` on the heap
+ * holding the decoded integers, its capacity is \i `size`
+ */
+C_DSA_API Result decompress_CompressedArray_int(const CompressedArray_int *arr) {
+  if (!arr) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  Result result = new_StrictArray_int(NULL, 0, arr->size);
+  if (result.ok != NO_ERROR) return result;
+  decode_CompressedArray_int(arr, (StrictArray_int*)result.data);
+  return result;
+}
+
+/**
+ * @fn status_t stream_CompressedArray_int(const CompressedArray_int *arr, void (*callback)(void *ctx, const int *values, size_t count), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief call \i `callback` with every block in order, decoded in a buffer of
+ * \c `C_DSA_COMPRESSED_BLOCK` integers reused from one block to the next
+ *
+ * @param[in] arr a pointer to \c `CompressedArray_int` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] callback the function receiving \i `ctx` and the \i `count`
+ * integers of a block
+ * (callback is not a null pointer)
+ * @param[in] ctx the context given to \i `callback`
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t stream_CompressedArray_int(const CompressedArray_int *arr,
+                                              void (*callback)(void *ctx, const int *values, size_t count),
+                                              void *ctx) {
+  if (!arr || !callback) return SEGFAULT;
+  int values[C_DSA_COMPRESSED_BLOCK];
+  for (size_t block = 0; block < arr->block_count; block++) {
+    size_t count = decode_block_CompressedArray_int(arr, block, values);
+    callback(ctx, values, count);
+  }
+  return NO_ERROR;
+}
+
+#endif // __C_DSA_INT_COMPRESSED_ARRAY_H__
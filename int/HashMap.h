@@ -0,0 +1,45 @@
+/**
+ * @file int/HashMap.h
+ * @brief a hash map from integers to integers
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details This library introduces a structure \c `HashMap_int` mapping \c `int`
+ * keys to \c `int` values, with the control-byte table of generic/HashMap.h.
+ * The keys are hashed inline by \c `hash_int` (a multiply and a shift) and
+ * compared with \c `==`, so a lookup costs no indirect call.
+ *
+ * The structure and APIs are generated by \c `DEFINE_HASH_MAP`, see
+ * generic/HashMap_template.h for the details of every function.
+ *
+ * HashMap_int's APIs:
+ * @li new_T : dynamically create type T on the heap
+ * @li new_T_with_allocator : dynamically create type T with an \c `Allocator`
+ * @li free_T : deallocate type T
+ * @li reserve_T : make sure T can hold \i `count` keys without growing
+ * @li insert_T : insert or replace the value of a key in T
+ * @li insert_many_T : insert many keys in T with one growth
+ * @li find_T : get the pointer to the value of a key
+ * @li contains_T : whether a key is in T
+ * @li erase_T : remove a key from T
+ * @li clear_T : remove all keys from T
+ * @li next_T : iterate over the keys and values of T
+ */
+#ifndef __C_DSA_INT_HASH_MAP_H__
+#define __C_DSA_INT_HASH_MAP_H__
+
+#include <stdint.h>
+
+#include "../generic/HashMap_template.h"
+
+// the high half of the product mixes every bit of the key into the low bits
+static inline size_t hash_int(int key) {
+  uint64_t product = (uint64_t)(uint32_t)key * 0x9e3779b97f4a7c15u;
+  return (size_t)(product ^ (product >> 32));
+}
+
+#define equal_int(a, b) ((a) == (b))
+
+DEFINE_HASH_MAP(int, int, int, hash_int, equal_int)
+
+#endif // __C_DSA_INT_HASH_MAP_H__
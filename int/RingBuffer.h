@@ -0,0 +1,32 @@
+/**
+ * @file int/RingBuffer.h
+ * @brief a lock-free single-producer/single-consumer ring buffer of integers
+ * @author andarling
+ * @date 14/10/2026
+ * 
+ * @details This library introduces a structure \c `RingBuffer_int`, a fixed
+ * capacity FIFO queue of integers handing values from one producer thread to
+ * one consumer thread without a lock.
+ * 
+ * The structure and APIs are generated by \c `DEFINE_RING_BUFFER`, see
+ * generic/RingBuffer_template.h for the details of every function.
+ * 
+ * RingBuffer_int's APIs:
+ * @li new_T : dynamically create type T on the heap
+ * @li init_T : create type T in a caller-provided buffer
+ * @li T_bytes_required : the size of the buffer \c `init_T` needs
+ * @li free_T : deallocate type T
+ * @li try_push_T : insert an element at the back of T if it is not full
+ * @li try_push_n_T : insert as many elements as possible at the back of T
+ * @li try_pop_T : remove the element at the front of T if it is not empty
+ * @li try_pop_n_T : remove as many elements as possible from the front of T
+ * @li size_T : the number of elements in T
+ */
+#ifndef __C_DSA_INT_RING_BUFFER_H__
+#define __C_DSA_INT_RING_BUFFER_H__
+
+#include "../generic/RingBuffer_template.h"
+
+DEFINE_RING_BUFFER(int, int)
+
+#endif // __C_DSA_INT_RING_BUFFER_H__
@@ -0,0 +1,37 @@
+/**
+ * @file int/SmallArray.h
+ * @brief an array of integers with an inline buffer header
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details This library introduces a structure \c `SmallArray_int` that stores
+ * up to \c `C_DSA_SMALL_ARRAY_CAPACITY` (16 by default) integers inside the
+ * structure itself and spills them to the heap, or to an \c `Allocator`, when
+ * it grows beyond. The structure is declared by the caller, so a small array
+ * costs no allocation until it spills.
+ *
+ * The structure and APIs are generated by \c `DEFINE_SMALL_ARRAY`, see
+ * generic/SmallArray_template.h for the details of every function.
+ *
+ * SmallArray_int's APIs:
+ * @li init_T : initialise an empty T spilling to the heap
+ * @li init_T_with_allocator : initialise an empty T spilling through an \c `Allocator`
+ * @li destroy_T : release the spilled elements of T
+ * @li is_inline_T : whether the elements of T are stored inline
+ * @li push_back_T : insert data to type T on last position, growing if needed
+ * @li append_range_T : insert \i `count` integers on last positions
+ * @li pop_back_T : remove last element in type T
+ * @li pop_back_n_T : remove the last \i `count` elements in type T
+ * @li get_item_T : get the pointer to item on \i `index`
+ * @li clear_T : reset the data in T
+ * @li reserve_T : make sure T can hold at least \i `cap` elements
+ * @li shrink_to_fit_T : release the unused capacity of T
+ */
+#ifndef __C_DSA_INT_SMALL_ARRAY_H__
+#define __C_DSA_INT_SMALL_ARRAY_H__
+
+#include "../generic/SmallArray_template.h"
+
+DEFINE_SMALL_ARRAY(int, C_DSA_SMALL_ARRAY_CAPACITY, int)
+
+#endif // __C_DSA_INT_SMALL_ARRAY_H__
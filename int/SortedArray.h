@@ -0,0 +1,427 @@
+/**
+ * @file int/SortedArray.h
+ * @brief binary search, sorted insertion and batched lookups for integers
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details The functions keep a \c `StrictArray_int` sorted in ascending order
+ * (e.g. after \c `sort_StrictArray_int` of int/algorithms.h) and look keys up in
+ * [0, \i `size` - 1] in O(log n) instead of scanning it. The order is not
+ * checked: on an unsorted array the results are unspecified.
+ * The binary search is branchless: the range is halved a fixed number of
+ * times for a given size, each step is a conditional move, so the searches
+ * never mispredict and searches of the same array run in lockstep.
+ * \c `lookup_many` relies on it to run \c `C_DSA_LOOKUP_BATCH` searches at once,
+ * prefetching both candidates of the next step of every search, so the cache
+ * misses of a batch overlap instead of being paid one after the other.
+ *
+ * For read-heavy tables, \c `Eytzinger_int` stores a copy of the sorted array
+ * in breadth-first (Eytzinger) order: the children of the element \i `k` are
+ * \i `2k` and \i `2k + 1`, so the 16 descendants four levels below an element
+ * share one cache line and are prefetched while the four levels are walked.
+ * The keys start on a cache line, and each key keeps its index in the sorted
+ * array, so both layouts return the same indices.
+ *
+ * SortedArray's APIs:
+ * @li lower_bound_T : the index of the first element not less than a key
+ * @li upper_bound_T : the index of the first element greater than a key
+ * @li find_sorted_T, find_Eytzinger_int : the index of an element equal to a key
+ * @li insert_sorted_T : insert an element at its place in T
+ * @li lookup_many_T : the indices of the elements equal to many keys
+ * @li new_Eytzinger_int, new_Eytzinger_int_with_allocator : build the
+ * Eytzinger layout of a sorted \c `StrictArray_int`
+ * @li free_Eytzinger_int : deallocate an Eytzinger layout
+ */
+#ifndef __C_DSA_INT_SORTED_ARRAY_H__
+#define __C_DSA_INT_SORTED_ARRAY_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/Result.h"
+#include "../utils/Allocator.h"
+#include "../utils/AlignedAllocator.h"
+#include "../utils/checked.h"
+#include "../utils/instrument.h"
+#include "StrictArray.h"
+
+/**
+ * @brief the number of searches \c `lookup_many` runs at once
+ */
+#ifndef C_DSA_LOOKUP_BATCH
+#define C_DSA_LOOKUP_BATCH 16
+#endif
+
+// the number of keys in a cache line, the Eytzinger search prefetches 4 levels ahead
+#define C_DSA_EYTZINGER_BLOCK (C_DSA_CACHE_LINE_SIZE / sizeof(int))
+
+/**
+ * @fn size_t lower_bound_ints(const int *data, size_t n, int key)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the index of the first of the \i `n` sorted integers not less than
+ * \i `key`, or \i `n` if there is none
+ */
+C_DSA_API size_t lower_bound_ints(const int *data, size_t n, int key) {
+  if (!n) return 0;
+  size_t low = 0;
+  while (n > 1) {
+    size_t half = n / 2;
+    low = data[low + half - 1] < key ? low + half : low;
+    n -= half;
+  }
+  return low + (data[low] < key);
+}
+
+/**
+ * @fn size_t upper_bound_ints(const int *data, size_t n, int key)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the index of the first of the \i `n` sorted integers greater than
+ * \i `key`, or \i `n` if there is none
+ */
+C_DSA_API size_t upper_bound_ints(const int *data, size_t n, int key) {
+  if (!n) return 0;
+  size_t low = 0;
+  while (n > 1) {
+    size_t half = n / 2;
+    low = data[low + half - 1] <= key ? low + half : low;
+    n -= half;
+  }
+  return low + (data[low] <= key);
+}
+
+/**
+ * @fn void lookup_many_ints(const int *data, size_t n, const int *keys, size_t count, size_t *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write to \i `out[i]` the index of an integer equal to \i `keys[i]` in
+ * the \i `n` sorted integers, or \i `n` if there is none
+ *
+ * The index is the one \c `lower_bound_ints` returns, the first match.
+ */
+C_DSA_API void lookup_many_ints(const int *data, size_t n, const int *keys, size_t count, size_t *out) {
+  for (size_t i = 0; i < count; i += C_DSA_LOOKUP_BATCH) {
+    size_t batch = count - i < C_DSA_LOOKUP_BATCH ? count - i : C_DSA_LOOKUP_BATCH;
+    const int *key = keys + i;
+    size_t low[C_DSA_LOOKUP_BATCH] = {0}, length = n;
+    while (length > 1) {
+      size_t half = length / 2, next = (length - half) / 2;
+      for (size_t j = 0; j < batch; j++) {
+        if (next) {
+          C_DSA_PREFETCH(data + low[j] + next - 1);
+          C_DSA_PREFETCH(data + low[j] + half + next - 1);
+        }
+        low[j] = data[low[j] + half - 1] < key[j] ? low[j] + half : low[j];
+      }
+      length -= half;
+    }
+    for (size_t j = 0; j < batch; j++) {
+      size_t index = n ? low[j] + (data[low[j]] < key[j]) : 0;
+      out[i + j] = index < n && data[index] == key[j] ? index : n;
+    }
+  }
+}
+
+/**
+ * @fn size_t lower_bound_StrictArray_int(StrictArray_int *arr, int key)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the index of the first element not less than \i `key`
+ *
+ * @return the index in [0, \i `size`], \i `size` if every element is less than
+ * \i `key` (0 if arr is a null pointer)
+ */
+C_DSA_API size_t lower_bound_StrictArray_int(StrictArray_int *arr, int key) {
+  if (!arr) return 0;
+  return lower_bound_ints(arr->data, arr->size, key);
+}
+
+/**
+ * @fn size_t upper_bound_StrictArray_int(StrictArray_int *arr, int key)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the index of the first element greater than \i `key`
+ *
+ * @return the index in [0, \i `size`], \i `size` if no element is greater than
+ * \i `key` (0 if arr is a null pointer)
+ */
+C_DSA_API size_t upper_bound_StrictArray_int(StrictArray_int *arr, int key) {
+  if (!arr) return 0;
+  return upper_bound_ints(arr->data, arr->size, key);
+}
+
+/**
+ * @fn size_t find_sorted_StrictArray_int(StrictArray_int *arr, int key)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the index of the first element equal to \i `key`
+ *
+ * @return the index of the match, \i `size` if there is none (0 if arr is a
+ * null pointer)
+ */
+C_DSA_API size_t find_sorted_StrictArray_int(StrictArray_int *arr, int key) {
+  if (!arr) return 0;
+  size_t index = lower_bound_ints(arr->data, arr->size, key);
+  return index < arr->size && arr->data[index] == key ? index : arr->size;
+}
+
+/**
+ * @fn status_t insert_sorted_StrictArray_int(StrictArray_int *arr, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief insert \i `value` after the elements less than or equal to it, so the
+ * array stays sorted
+ *
+ * @param[in] arr a pointer to a sorted \c `StrictArray_int` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] value the value to insert
+ *
+ * @return 0 if success, \c `NO_SPACE` if the array is full
+ */
+C_DSA_API status_t insert_sorted_StrictArray_int(StrictArray_int *arr, int value) {
+  if (!arr) return SEGFAULT;
+  size_t size = arr->size;
+  if (size == arr->capacity) {
+    C_DSA_COUNT_FAILED_PUSH(C_DSA_STRICT_ARRAY);
+    return NO_SPACE;
+  }
+  size_t index = upper_bound_ints(arr->data, size, value);
+  memmove(arr->data + index + 1, arr->data + index, sizeof(int) * (size - index));
+  arr->data[index] = value;
+  arr->size = size + 1;
+  C_DSA_COUNT_PUSH(C_DSA_STRICT_ARRAY, 1);
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t lookup_many_StrictArray_int(StrictArray_int *arr, const int *keys, size_t count, size_t *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write to \i `out[i]` the index of the first element equal to
+ * \i `keys[i]`, or \i `size` if there is none
+ *
+ * @param[in] arr a pointer to a sorted \c `StrictArray_int` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] keys the \i `count` keys to look up
+ * @param[out] out room for \i `count` indices
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t lookup_many_StrictArray_int(StrictArray_int *arr, const int *keys, size_t count, size_t *out) {
+  if (!arr || (count && (!keys || !out))) return SEGFAULT;
+  lookup_many_ints(arr->data, arr->size, keys, count, out);
+  return NO_ERROR;
+}
+
+typedef struct Eytzinger_int Eytzinger_int;
+
+/**
+ * @struct Eytzinger_int
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the \i `size` elements of a sorted array in breadth-first order
+ *
+ * \i `keys[k]` for k in [1, \i `size`] are the elements, \i `keys[0]` is unused.
+ * \i `rank[k]` is the index of \i `keys[k]` in the sorted array and
+ * \i `rank[0]` is \i `size`, the index returned when there is no match.
+ */
+struct Eytzinger_int {
+  size_t size;
+  const Allocator *allocator;
+  size_t *rank;
+  int keys[];
+};
+
+DEFINE_ALIGNED_ALLOCATORS(Eytzinger_int, sizeof(Eytzinger_int))
+
+// the bytes of the keys, rounded to align the ranks after them, or 0 if they
+// do not fit in a size_t
+C_DSA_API size_t keys_bytes_Eytzinger_int(size_t size) {
+  size_t bytes;
+  if (checked_bytes(sizeof(int) + sizeof(size_t) - 1, size, sizeof(int), &bytes)) return 0;
+  return bytes / sizeof(size_t) * sizeof(size_t);
+}
+
+// the bytes of the layout, or 0 if they do not fit in a size_t
+C_DSA_API size_t bytes_Eytzinger_int(size_t size) {
+  size_t keys = keys_bytes_Eytzinger_int(size), bytes;
+  if (!keys || checked_bytes(sizeof(Eytzinger_int) + sizeof(size_t), size, sizeof(size_t), &bytes)
+      || checked_add(bytes, keys, &bytes)) {
+    return 0;
+  }
+  return bytes;
+}
+
+// fill the subtree of k with the sorted elements from index, in order
+C_DSA_API size_t fill_Eytzinger_int(Eytzinger_int *tree, const int *sorted, size_t index, size_t k) {
+  if (k > tree->size) return index;
+  index = fill_Eytzinger_int(tree, sorted, index, 2 * k);
+  tree->keys[k] = sorted[index];
+  tree->rank[k] = index;
+  return fill_Eytzinger_int(tree, sorted, index + 1, 2 * k + 1);
+}
+
+/**
+ * @brief the last node from which the search went left, where it found the
+ * lower bound: the search path is \i `k` in binary, so the trailing ones (the
+ * right turns after it) and the last zero are dropped
+ */
+C_DSA_API size_t climb_Eytzinger_int(size_t k) {
+#if defined(__GNUC__) || defined(__clang__)
+  return k >> (__builtin_ctzll(~(unsigned long long)k) + 1);
+#else
+  while (k & 1) k >>= 1;
+  return k >> 1;
+#endif
+}
+
+/**
+ * @fn Result new_Eytzinger_int_with_allocator(StrictArray_int *sorted, const Allocator *allocator)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to the Eytzinger layout of \i `sorted`,
+ * allocated by \i `allocator`
+ *
+ * The layout is a copy, later changes to \i `sorted` are not seen.
+ *
+ * @param[in] sorted a pointer to a sorted \c `StrictArray_int` type
+ * (sorted is not a null pointer)
+ * @param[in] allocator the allocator to use, it must outlive the layout
+ * (allocator is not a null pointer)
+ *
+ * @return a \c `Result` type to the successfully allocated layout or a error message
+ */
+C_DSA_API Result new_Eytzinger_int_with_allocator(StrictArray_int *sorted, const Allocator *allocator) {
+  if (!sorted || !allocator) {
+    return (Result) {
+      .ok = SEGFAULT,
+      .error_msg = "ValueError: cannot access a null pointer\n"
+    };
+  }
+  size_t size = sorted->size, bytes = bytes_Eytzinger_int(size);
+  if (!bytes) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Capacity is too big\n"
+    };
+  }
+  Eytzinger_int *result = (Eytzinger_int*)allocator->alloc(allocator->ctx, bytes);
+  if (!result) {
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+  result->size = size;
+  result->allocator = allocator;
+  result->rank = (size_t*)((char*)result->keys + keys_bytes_Eytzinger_int(size));
+  result->keys[0] = 0;
+  result->rank[0] = size;
+  fill_Eytzinger_int(result, sorted->data, 0, 1);
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn Result new_Eytzinger_int(StrictArray_int *sorted)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `new_Eytzinger_int_with_allocator` on the heap, with
+ * the keys aligned to \c `C_DSA_CACHE_LINE_SIZE`
+ */
+C_DSA_API Result new_Eytzinger_int(StrictArray_int *sorted) {
+  const Allocator *allocator = Eytzinger_int_aligned_allocator(C_DSA_CACHE_LINE_SIZE);
+  return new_Eytzinger_int_with_allocator(sorted, allocator ? allocator : &heap_allocator);
+}
+
+/**
+ * @fn void free_Eytzinger_int(Eytzinger_int **tree)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief deallocate the layout and set the pointer to NULL
+ */
+C_DSA_API void free_Eytzinger_int(Eytzinger_int **tree) {
+  if (!tree || !(*tree)) return;
+  const Allocator *allocator = (*tree)->allocator;
+  allocator->free(allocator->ctx, *tree, bytes_Eytzinger_int((*tree)->size));
+  *tree = NULL;
+}
+
+/**
+ * @fn size_t lower_bound_Eytzinger_int(Eytzinger_int *tree, int key)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `lower_bound_StrictArray_int` on the sorted array
+ * \i `tree` was built from
+ */
+C_DSA_API size_t lower_bound_Eytzinger_int(Eytzinger_int *tree, int key) {
+  if (!tree) return 0;
+  size_t k = 1, size = tree->size;
+  while (k <= size) {
+    C_DSA_PREFETCH(tree->keys + C_DSA_EYTZINGER_BLOCK * k);
+    k = 2 * k + (tree->keys[k] < key);
+  }
+  return tree->rank[climb_Eytzinger_int(k)];
+}
+
+/**
+ * @fn size_t find_Eytzinger_int(Eytzinger_int *tree, int key)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `find_sorted_StrictArray_int` on the sorted array
+ * \i `tree` was built from
+ */
+C_DSA_API size_t find_Eytzinger_int(Eytzinger_int *tree, int key) {
+  if (!tree) return 0;
+  size_t k = 1, size = tree->size;
+  while (k <= size) {
+    C_DSA_PREFETCH(tree->keys + C_DSA_EYTZINGER_BLOCK * k);
+    k = 2 * k + (tree->keys[k] < key);
+  }
+  k = climb_Eytzinger_int(k);
+  return k && tree->keys[k] == key ? tree->rank[k] : size;
+}
+
+/**
+ * @fn status_t lookup_many_Eytzinger_int(Eytzinger_int *tree, const int *keys, size_t count, size_t *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `lookup_many_StrictArray_int` on the sorted array
+ * \i `tree` was built from
+ *
+ * The searches of a batch walk the levels together, each one prefetching its
+ * descendants four levels below.
+ */
+C_DSA_API status_t lookup_many_Eytzinger_int(Eytzinger_int *tree, const int *keys, size_t count, size_t *out) {
+  if (!tree || (count && (!keys || !out))) return SEGFAULT;
+  size_t size = tree->size;
+  for (size_t i = 0; i < count; i += C_DSA_LOOKUP_BATCH) {
+    size_t batch = count - i < C_DSA_LOOKUP_BATCH ? count - i : C_DSA_LOOKUP_BATCH;
+    const int *key = keys + i;
+    size_t k[C_DSA_LOOKUP_BATCH];
+    for (size_t j = 0; j < batch; j++) k[j] = 1;
+    // the leaves are on the last two levels, so the walks end one step apart at most
+    for (int walking = size > 0; walking;) {
+      walking = 0;
+      for (size_t j = 0; j < batch; j++) {
+        if (k[j] > size) continue;
+        C_DSA_PREFETCH(tree->keys + C_DSA_EYTZINGER_BLOCK * k[j]);
+        k[j] = 2 * k[j] + (tree->keys[k[j]] < key[j]);
+        walking = 1;
+      }
+    }
+    for (size_t j = 0; j < batch; j++) {
+      size_t node = climb_Eytzinger_int(k[j]);
+      out[i + j] = node && tree->keys[node] == key[j] ? tree->rank[node] : size;
+    }
+  }
+  return NO_ERROR;
+}
+
+#endif // __C_DSA_INT_SORTED_ARRAY_H__
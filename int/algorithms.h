@@ -0,0 +1,569 @@
+/**
+ * @file int/algorithms.h
+ * @brief sort, transform and reduce algorithms for integers
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details The algorithms work in place on a contiguous run of integers, the
+ * \c `_StrictArray_int` functions on [0, \i `size` - 1] and the
+ * \c `_ArrayView_int` functions on the elements of a view (see int/ArrayView.h),
+ * a strided view is sorted in a contiguous temporary buffer.
+ * Integers are sorted by a least significant digit radix sort, one pass per
+ * byte (a pass is skipped when every integer has the same byte), which is
+ * stable and linear but needs a temporary buffer of \i `n` integers, short
+ * runs are sorted by insertion instead.
+ * Every algorithm has a \c `parallel_` version taking a \c `ThreadPool` (see
+ * utils/ThreadPool.h), a null pool (or a small array) runs sequentially. The
+ * parallel radix sort splits the integers in one chunk per thread: every
+ * thread counts the bytes of its chunk, then scatters its chunk to the offsets
+ * given by the counts of all chunks.
+ *
+ * Algorithms' APIs:
+ * @li sort_T : sort the elements of T in ascending order
+ * @li stable_sort_T : the same as sort_T, the radix sort is stable
+ * @li transform_T : replace every element of T by the result of a function
+ * @li reduce_T : fold the elements of T into an accumulator
+ * @li parallel_sort_T, parallel_stable_sort_T, parallel_transform_T,
+ * parallel_reduce_T : the same algorithms run by a \c `ThreadPool`
+ */
+#ifndef __C_DSA_INT_ALGORITHMS_H__
+#define __C_DSA_INT_ALGORITHMS_H__
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "../utils/ThreadPool.h"
+#include "StrictArray.h"
+#include "ArrayView.h"
+
+#define C_DSA_RADIX_BITS 8
+#define C_DSA_RADIX_BUCKETS (1 << C_DSA_RADIX_BITS)
+#define C_DSA_RADIX_PASSES (sizeof(int) * CHAR_BIT / C_DSA_RADIX_BITS)
+
+/**
+ * @brief the runs shorter than this are sorted by insertion
+ */
+#define C_DSA_INSERTION_THRESHOLD 64
+
+C_DSA_API unsigned radix_digit(int value, size_t pass) {
+  // flipping the sign bit orders negative integers before positive ones
+  unsigned key = (unsigned)value ^ (1u << (sizeof(int) * CHAR_BIT - 1));
+  return (key >> (pass * C_DSA_RADIX_BITS)) & (C_DSA_RADIX_BUCKETS - 1);
+}
+
+C_DSA_API void insertion_sort_ints(int *data, size_t n) {
+  for (size_t i = 1; i < n; i++) {
+    int value = data[i];
+    size_t j = i;
+    for (; j > 0 && data[j - 1] > value; j--) data[j] = data[j - 1];
+    data[j] = value;
+  }
+}
+
+/**
+ * @fn status_t sort_ints(int *data, size_t n)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief sort \i `n` integers in ascending order
+ *
+ * @return 0 if success and non-zero if the temporary buffer cannot be allocated
+ */
+C_DSA_API status_t sort_ints(int *data, size_t n) {
+  if (n <= C_DSA_INSERTION_THRESHOLD) {
+    insertion_sort_ints(data, n);
+    return NO_ERROR;
+  }
+  int *tmp = (int*)malloc(sizeof(int) * n);
+  if (!tmp) return HEAP_FAILURE;
+
+  // the counts of every pass are taken in a single read
+  size_t counts[C_DSA_RADIX_PASSES][C_DSA_RADIX_BUCKETS] = {{0}};
+  for (size_t i = 0; i < n; i++) {
+    for (size_t pass = 0; pass < C_DSA_RADIX_PASSES; pass++) {
+      counts[pass][radix_digit(data[i], pass)]++;
+    }
+  }
+
+  int *src = data, *dst = tmp;
+  for (size_t pass = 0; pass < C_DSA_RADIX_PASSES; pass++) {
+    size_t *count = counts[pass];
+    if (count[radix_digit(src[0], pass)] == n) continue;
+    size_t offset = 0;
+    for (size_t d = 0; d < C_DSA_RADIX_BUCKETS; d++) {
+      size_t c = count[d];
+      count[d] = offset;
+      offset += c;
+    }
+    for (size_t i = 0; i < n; i++) {
+      dst[count[radix_digit(src[i], pass)]++] = src[i];
+    }
+    int *swap = src;
+    src = dst, dst = swap;
+  }
+  if (src != data) memcpy(data, src, sizeof(int) * n);
+  free(tmp);
+  return NO_ERROR;
+}
+
+typedef struct {
+  int *src, *dst;
+  size_t n, chunks, pass;
+  // the distance between two elements for transform and reduce
+  size_t stride;
+  size_t (*counts)[C_DSA_RADIX_BUCKETS];
+  int (*transform)(int value, void *ctx);
+  int (*reduce)(int acc, int value, void *ctx);
+  void *ctx;
+  int *partials;
+} IntJob;
+
+C_DSA_API void radix_count_task(void *ctx, size_t index) {
+  IntJob *job = (IntJob*)ctx;
+  size_t *count = job->counts[index];
+  memset(count, 0, sizeof(size_t) * C_DSA_RADIX_BUCKETS);
+  size_t end = chunk_begin_ThreadPool(job->n, job->chunks, index + 1);
+  for (size_t i = chunk_begin_ThreadPool(job->n, job->chunks, index); i < end; i++) {
+    count[radix_digit(job->src[i], job->pass)]++;
+  }
+}
+
+C_DSA_API void radix_scatter_task(void *ctx, size_t index) {
+  IntJob *job = (IntJob*)ctx;
+  size_t *offset = job->counts[index];
+  size_t end = chunk_begin_ThreadPool(job->n, job->chunks, index + 1);
+  for (size_t i = chunk_begin_ThreadPool(job->n, job->chunks, index); i < end; i++) {
+    int value = job->src[i];
+    job->dst[offset[radix_digit(value, job->pass)]++] = value;
+  }
+}
+
+/**
+ * @fn status_t parallel_sort_ints(ThreadPool *pool, int *data, size_t n)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief sort \i `n` integers in ascending order with the threads of \i `pool`
+ *
+ * @return 0 if success and non-zero if the temporary buffers cannot be allocated
+ */
+C_DSA_API status_t parallel_sort_ints(ThreadPool *pool, int *data, size_t n) {
+  size_t chunks = chunk_count_ThreadPool(pool, n, 1);
+  if (chunks == 1) return sort_ints(data, n);
+
+  int *tmp = (int*)malloc(sizeof(int) * n);
+  size_t (*counts)[C_DSA_RADIX_BUCKETS] = malloc(sizeof(*counts) * chunks);
+  if (!tmp || !counts) {
+    free(tmp);
+    free(counts);
+    return HEAP_FAILURE;
+  }
+
+  IntJob job = { .src = data, .dst = tmp, .n = n, .chunks = chunks, .counts = counts };
+  for (job.pass = 0; job.pass < C_DSA_RADIX_PASSES; job.pass++) {
+    run_ThreadPool(pool, chunks, radix_count_task, &job);
+
+    // the integers with digit d of chunk j go after the smaller digits of
+    // every chunk and the digit d of the chunks before j
+    size_t offset = 0, skip = 0;
+    for (size_t d = 0; d < C_DSA_RADIX_BUCKETS; d++) {
+      size_t total = 0;
+      for (size_t j = 0; j < chunks; j++) {
+        size_t c = counts[j][d];
+        counts[j][d] = offset + total;
+        total += c;
+      }
+      if (total == n) skip = 1;
+      offset += total;
+    }
+    if (skip) continue;
+
+    run_ThreadPool(pool, chunks, radix_scatter_task, &job);
+    int *swap = job.src;
+    job.src = job.dst, job.dst = swap;
+  }
+  if (job.src != data) memcpy(data, job.src, sizeof(int) * n);
+  free(tmp);
+  free(counts);
+  return NO_ERROR;
+}
+
+/**
+ * @brief sort the elements of \i `view`, a strided view is gathered in a
+ * contiguous buffer, sorted, then scattered back
+ */
+C_DSA_API status_t sort_view_ints(ThreadPool *pool, const ArrayView_int *view) {
+  size_t n = view->size, stride = view->stride;
+  if (n < 2) return NO_ERROR;
+  if (stride == 1) return parallel_sort_ints(pool, view->data, n);
+
+  int *buffer = (int*)malloc(sizeof(int) * n);
+  if (!buffer) return HEAP_FAILURE;
+  for (size_t i = 0; i < n; i++) {
+    buffer[i] = view->data[stride * i];
+  }
+  status_t status = parallel_sort_ints(pool, buffer, n);
+  if (status == NO_ERROR) {
+    for (size_t i = 0; i < n; i++) {
+      view->data[stride * i] = buffer[i];
+    }
+  }
+  free(buffer);
+  return status;
+}
+
+/**
+ * @fn status_t sort_ArrayView_int(const ArrayView_int *view)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief sort the elements of the view in ascending order
+ *
+ * @param[in] view a pointer to \c `ArrayView_int` type
+ * (if view is a null pointer then an error of invalid instance is returned)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t sort_ArrayView_int(const ArrayView_int *view) {
+  if (!view) return SEGFAULT;
+  return sort_view_ints(NULL, view);
+}
+
+/**
+ * @fn status_t sort_StrictArray_int(StrictArray_int *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief sort the elements of the array in ascending order
+ *
+ * @param[in] arr a pointer to \c `StrictArray_int` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t sort_StrictArray_int(StrictArray_int *arr) {
+  ArrayView_int view;
+  status_t status = view_StrictArray_int(arr, &view);
+  if (status != NO_ERROR) return status;
+  return sort_ArrayView_int(&view);
+}
+
+/**
+ * @fn status_t stable_sort_ArrayView_int(const ArrayView_int *view)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `sort_ArrayView_int`, which is stable
+ */
+C_DSA_API status_t stable_sort_ArrayView_int(const ArrayView_int *view) {
+  return sort_ArrayView_int(view);
+}
+
+/**
+ * @fn status_t stable_sort_StrictArray_int(StrictArray_int *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `sort_StrictArray_int`, which is stable
+ */
+C_DSA_API status_t stable_sort_StrictArray_int(StrictArray_int *arr) {
+  return sort_StrictArray_int(arr);
+}
+
+/**
+ * @fn status_t transform_ArrayView_int(const ArrayView_int *view, int (*fn)(int value, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief replace every element of the view by \i `fn`(element, \i `ctx`), in order
+ *
+ * @param[in] view a pointer to \c `ArrayView_int` type
+ * (if view is a null pointer then an error of invalid instance is returned)
+ * @param[in] fn the function computing the new value
+ * (fn is not a null pointer)
+ * @param[in] ctx the context given to every call
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t transform_ArrayView_int(const ArrayView_int *view, int (*fn)(int value, void *ctx), void *ctx) {
+  if (!view || !fn) return SEGFAULT;
+  int *data = view->data;
+  size_t stride = view->stride;
+  for (size_t i = 0; i < view->size; i++) {
+    data[stride * i] = fn(data[stride * i], ctx);
+  }
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t transform_StrictArray_int(StrictArray_int *arr, int (*fn)(int value, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief replace every element of the array by \i `fn`(element, \i `ctx`), in order
+ *
+ * @param[in] arr a pointer to \c `StrictArray_int` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] fn the function computing the new value
+ * (fn is not a null pointer)
+ * @param[in] ctx the context given to every call
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t transform_StrictArray_int(StrictArray_int *arr, int (*fn)(int value, void *ctx), void *ctx) {
+  ArrayView_int view;
+  status_t status = view_StrictArray_int(arr, &view);
+  if (status != NO_ERROR) return status;
+  return transform_ArrayView_int(&view, fn, ctx);
+}
+
+/**
+ * @fn status_t reduce_ArrayView_int(const ArrayView_int *view, int *acc, int (*fn)(int acc, int value, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief fold every element of the view, in order, into \i `acc`
+ *
+ * @param[in] view a pointer to \c `ArrayView_int` type
+ * (if view is a null pointer then an error of invalid instance is returned)
+ * @param[in,out] acc the accumulator, holding the initial value
+ * @param[in] fn the function returning the accumulator with an element folded in
+ * (fn is not a null pointer)
+ * @param[in] ctx the context given to every call
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t reduce_ArrayView_int(const ArrayView_int *view, int *acc,
+                                        int (*fn)(int acc, int value, void *ctx), void *ctx) {
+  if (!view || !acc || !fn) return SEGFAULT;
+  int result = *acc;
+  for (size_t i = 0; i < view->size; i++) {
+    result = fn(result, view->data[view->stride * i], ctx);
+  }
+  *acc = result;
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t reduce_StrictArray_int(StrictArray_int *arr, int *acc, int (*fn)(int acc, int value, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief fold every element of the array, in order, into \i `acc`
+ *
+ * @param[in] arr a pointer to \c `StrictArray_int` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in,out] acc the accumulator, holding the initial value
+ * @param[in] fn the function returning the accumulator with an element folded in
+ * (fn is not a null pointer)
+ * @param[in] ctx the context given to every call
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t reduce_StrictArray_int(StrictArray_int *arr, int *acc,
+                                          int (*fn)(int acc, int value, void *ctx), void *ctx) {
+  ArrayView_int view;
+  status_t status = view_StrictArray_int(arr, &view);
+  if (status != NO_ERROR) return status;
+  return reduce_ArrayView_int(&view, acc, fn, ctx);
+}
+
+/**
+ * @fn status_t parallel_sort_ArrayView_int(ThreadPool *pool, const ArrayView_int *view)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief sort the elements of the view with the threads of \i `pool`
+ *
+ * @param[in] pool the pool running the tasks
+ * (if pool is a null pointer then the sort is sequential)
+ * @param[in] view a pointer to \c `ArrayView_int` type
+ * (if view is a null pointer then an error of invalid instance is returned)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t parallel_sort_ArrayView_int(ThreadPool *pool, const ArrayView_int *view) {
+  if (!view) return SEGFAULT;
+  return sort_view_ints(pool, view);
+}
+
+/**
+ * @fn status_t parallel_sort_StrictArray_int(ThreadPool *pool, StrictArray_int *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief sort the elements of the array with the threads of \i `pool`
+ *
+ * @param[in] pool the pool running the tasks
+ * (if pool is a null pointer then the sort is sequential)
+ * @param[in] arr a pointer to \c `StrictArray_int` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t parallel_sort_StrictArray_int(ThreadPool *pool, StrictArray_int *arr) {
+  ArrayView_int view;
+  status_t status = view_StrictArray_int(arr, &view);
+  if (status != NO_ERROR) return status;
+  return parallel_sort_ArrayView_int(pool, &view);
+}
+
+/**
+ * @fn status_t parallel_stable_sort_ArrayView_int(ThreadPool *pool, const ArrayView_int *view)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `parallel_sort_ArrayView_int`, which is stable
+ */
+C_DSA_API status_t parallel_stable_sort_ArrayView_int(ThreadPool *pool, const ArrayView_int *view) {
+  return parallel_sort_ArrayView_int(pool, view);
+}
+
+/**
+ * @fn status_t parallel_stable_sort_StrictArray_int(ThreadPool *pool, StrictArray_int *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the same as \c `parallel_sort_StrictArray_int`, which is stable
+ */
+C_DSA_API status_t parallel_stable_sort_StrictArray_int(ThreadPool *pool, StrictArray_int *arr) {
+  return parallel_sort_StrictArray_int(pool, arr);
+}
+
+C_DSA_API void transform_ints_task(void *ctx, size_t index) {
+  IntJob *job = (IntJob*)ctx;
+  int *data = job->src;
+  size_t stride = job->stride;
+  size_t end = chunk_begin_ThreadPool(job->n, job->chunks, index + 1);
+  for (size_t i = chunk_begin_ThreadPool(job->n, job->chunks, index); i < end; i++) {
+    data[stride * i] = job->transform(data[stride * i], job->ctx);
+  }
+}
+
+C_DSA_API void reduce_ints_task(void *ctx, size_t index) {
+  IntJob *job = (IntJob*)ctx;
+  int result = job->partials[index];
+  size_t end = chunk_begin_ThreadPool(job->n, job->chunks, index + 1);
+  for (size_t i = chunk_begin_ThreadPool(job->n, job->chunks, index); i < end; i++) {
+    result = job->reduce(result, job->src[job->stride * i], job->ctx);
+  }
+  job->partials[index] = result;
+}
+
+/**
+ * @fn status_t parallel_transform_ArrayView_int(ThreadPool *pool, const ArrayView_int *view, int (*fn)(int value, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief replace every element of the view by \i `fn`(element, \i `ctx`) with
+ * the threads of \i `pool`
+ *
+ * The calls happen in any order and at the same time.
+ *
+ * @param[in] pool the pool running the tasks
+ * (if pool is a null pointer then the calls are sequential)
+ * @param[in] view a pointer to \c `ArrayView_int` type
+ * (if view is a null pointer then an error of invalid instance is returned)
+ * @param[in] fn the function computing the new value
+ * (fn is not a null pointer)
+ * @param[in] ctx the context given to every call
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t parallel_transform_ArrayView_int(ThreadPool *pool, const ArrayView_int *view,
+                                                    int (*fn)(int value, void *ctx), void *ctx) {
+  if (!view || !fn) return SEGFAULT;
+  IntJob job = {
+    .src = view->data, .n = view->size, .chunks = chunk_count_ThreadPool(pool, view->size, 4),
+    .stride = view->stride, .transform = fn, .ctx = ctx
+  };
+  return run_ThreadPool(pool, job.chunks, transform_ints_task, &job);
+}
+
+/**
+ * @fn status_t parallel_transform_StrictArray_int(ThreadPool *pool, StrictArray_int *arr, int (*fn)(int value, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief replace every element of the array by \i `fn`(element, \i `ctx`) with
+ * the threads of \i `pool`
+ *
+ * The calls happen in any order and at the same time.
+ *
+ * @param[in] pool the pool running the tasks
+ * (if pool is a null pointer then the calls are sequential)
+ * @param[in] arr a pointer to \c `StrictArray_int` type
+ * (if arr is a null pointer then an error of invalid instance is returned)
+ * @param[in] fn the function computing the new value
+ * (fn is not a null pointer)
+ * @param[in] ctx the context given to every call
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t parallel_transform_StrictArray_int(ThreadPool *pool, StrictArray_int *arr,
+                                                      int (*fn)(int value, void *ctx), void *ctx) {
+  ArrayView_int view;
+  status_t status = view_StrictArray_int(arr, &view);
+  if (status != NO_ERROR) return status;
+  return parallel_transform_ArrayView_int(pool, &view, fn, ctx);
+}
+
+/**
+ * @fn status_t parallel_reduce_ArrayView_int(ThreadPool *pool, const ArrayView_int *view, int *acc, int (*fn)(int acc, int value, void *ctx), int (*combine)(int acc, int other, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief fold every element of the view into \i `acc` with the threads of \i `pool`
+ *
+ * Every chunk is folded by \i `fn` into its own partial accumulator, starting
+ * at \i `acc`, then the partials are folded in order into \i `acc` by
+ * \i `combine`. So the initial value of \i `acc` must be an identity (e.g. 0
+ * for a sum) and \i `combine` associative, but it does not need to commute.
+ *
+ * @param[in] pool the pool running the tasks
+ * (if pool is a null pointer then the reduction is sequential)
+ * @param[in] view a pointer to \c `ArrayView_int` type
+ * (if view is a null pointer then an error of invalid instance is returned)
+ * @param[in,out] acc the accumulator, holding the identity
+ * @param[in] fn the function returning the accumulator with an element folded in
+ * (fn is not a null pointer)
+ * @param[in] combine the function returning an accumulator with another one folded in
+ * (combine is not a null pointer)
+ * @param[in] ctx the context given to every call
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t parallel_reduce_ArrayView_int(ThreadPool *pool, const ArrayView_int *view, int *acc,
+                                                 int (*fn)(int acc, int value, void *ctx),
+                                                 int (*combine)(int acc, int other, void *ctx),
+                                                 void *ctx) {
+  if (!view || !acc || !fn || !combine) return SEGFAULT;
+  size_t chunks = chunk_count_ThreadPool(pool, view->size, 4);
+  if (chunks == 1) return reduce_ArrayView_int(view, acc, fn, ctx);
+
+  int *partials = (int*)malloc(sizeof(int) * chunks);
+  if (!partials) return HEAP_FAILURE;
+  for (size_t i = 0; i < chunks; i++) {
+    partials[i] = *acc;
+  }
+  IntJob job = {
+    .src = view->data, .n = view->size, .chunks = chunks, .stride = view->stride,
+    .reduce = fn, .ctx = ctx, .partials = partials
+  };
+  run_ThreadPool(pool, chunks, reduce_ints_task, &job);
+  int result = *acc;
+  for (size_t i = 0; i < chunks; i++) {
+    result = combine(result, partials[i], ctx);
+  }
+  *acc = result;
+  free(partials);
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t parallel_reduce_StrictArray_int(ThreadPool *pool, StrictArray_int *arr, int *acc, int (*fn)(int acc, int value, void *ctx), int (*combine)(int acc, int other, void *ctx), void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief fold every element of the array into \i `acc` with the threads of \i `pool`
+ *
+ * The same as \c `parallel_reduce_ArrayView_int` over the [0, \i `size` - 1]
+ * elements of the array.
+ */
+C_DSA_API status_t parallel_reduce_StrictArray_int(ThreadPool *pool, StrictArray_int *arr, int *acc,
+                                                   int (*fn)(int acc, int value, void *ctx),
+                                                   int (*combine)(int acc, int other, void *ctx),
+                                                   void *ctx) {
+  ArrayView_int view;
+  status_t status = view_StrictArray_int(arr, &view);
+  if (status != NO_ERROR) return status;
+  return parallel_reduce_ArrayView_int(pool, &view, acc, fn, combine, ctx);
+}
+
+#endif // __C_DSA_INT_ALGORITHMS_H__
@@ -0,0 +1,504 @@
+/**
+ * @file int/kernels.h
+ * @brief vectorized search, fill and reduction kernels for integers
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details The kernels work on a contiguous run of integers and are compiled
+ * for the widest instruction set enabled for the translation unit (AVX2, SSE2 or
+ * NEON, e.g. with \c `-mavx2` or \c `-march=native`), with a scalar fallback.
+ * Defining \c `C_DSA_NO_SIMD` before including this header forces the scalar
+ * path. \c `C_DSA_SIMD` names the selected path.
+ * The \c `_StrictArray_int` functions scan [0, \i `size` - 1], the
+ * \c `_Array_int` functions scan [0, \i `capacity` - 1] and the
+ * \c `_ArrayView_int` functions the elements of a view (see int/ArrayView.h),
+ * contiguous views use the vectorized kernels and strided views a scalar loop.
+ *
+ * Kernels' APIs:
+ * @li find_T : pointer to the first element equal to a value
+ * @li count_T : number of elements equal to a value
+ * @li sum_T : sum of the elements, without overflow
+ * @li min_max_T : smallest and greatest elements
+ * @li fill_T : set every elements to a value
+ */
+#ifndef __C_DSA_INT_KERNELS_H__
+#define __C_DSA_INT_KERNELS_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../utils/config.h"
+#include "../utils/status.h"
+#include "StrictArray.h"
+#include "Array.h"
+#include "ArrayView.h"
+
+#if !defined(C_DSA_NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#define C_DSA_SIMD_AVX2
+#define C_DSA_SIMD "avx2"
+#elif !defined(C_DSA_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#include <emmintrin.h>
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+#define C_DSA_SIMD_SSE2
+#define C_DSA_SIMD "sse2"
+#elif !defined(C_DSA_NO_SIMD) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define C_DSA_SIMD_NEON
+#define C_DSA_SIMD "neon"
+#else
+#define C_DSA_SIMD "scalar"
+#endif
+
+#if defined(C_DSA_SIMD_SSE2) && !defined(__SSE4_1__)
+// SSE2 has no 32-bit min/max, they are emulated with a compare and a blend
+static inline __m128i c_dsa_min_epi32(__m128i a, __m128i b) {
+  __m128i greater = _mm_cmpgt_epi32(a, b);
+  return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+}
+static inline __m128i c_dsa_max_epi32(__m128i a, __m128i b) {
+  __m128i greater = _mm_cmpgt_epi32(a, b);
+  return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+}
+#elif defined(C_DSA_SIMD_SSE2)
+#define c_dsa_min_epi32 _mm_min_epi32
+#define c_dsa_max_epi32 _mm_max_epi32
+#endif
+
+/**
+ * @fn size_t find_ints(const int *data, size_t n, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the index of the first of the \i `n` integers equal to \i `value`
+ *
+ * @return the index of the match, \i `n` if there is none
+ */
+C_DSA_API size_t find_ints(const int *data, size_t n, int value) {
+  size_t i = 0;
+#if defined(C_DSA_SIMD_AVX2)
+  __m256i needle = _mm256_set1_epi32(value);
+  for (; i + 8 <= n; i += 8) {
+    __m256i block = _mm256_loadu_si256((const __m256i*)(data + i));
+    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle)));
+    if (mask) return i + (size_t)__builtin_ctz((unsigned)mask);
+  }
+#elif defined(C_DSA_SIMD_SSE2)
+  __m128i needle = _mm_set1_epi32(value);
+  for (; i + 4 <= n; i += 4) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(data + i));
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+    if (mask) return i + (size_t)__builtin_ctz((unsigned)mask);
+  }
+#elif defined(C_DSA_SIMD_NEON)
+  int32x4_t needle = vdupq_n_s32(value);
+  for (; i + 4 <= n; i += 4) {
+    uint32x4_t equal = vceqq_s32(vld1q_s32(data + i), needle);
+    uint32x2_t folded = vorr_u32(vget_low_u32(equal), vget_high_u32(equal));
+    if (vget_lane_u32(vpmax_u32(folded, folded), 0)) break;
+  }
+#endif
+  for (; i < n; i++) {
+    if (data[i] == value) return i;
+  }
+  return n;
+}
+
+/**
+ * @fn size_t count_ints(const int *data, size_t n, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the number of the \i `n` integers equal to \i `value`
+ */
+C_DSA_API size_t count_ints(const int *data, size_t n, int value) {
+  size_t i = 0, count = 0;
+#if defined(C_DSA_SIMD_AVX2)
+  __m256i needle = _mm256_set1_epi32(value);
+  for (; i + 8 <= n; i += 8) {
+    __m256i block = _mm256_loadu_si256((const __m256i*)(data + i));
+    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle)));
+    count += (size_t)__builtin_popcount((unsigned)mask);
+  }
+#elif defined(C_DSA_SIMD_SSE2)
+  __m128i needle = _mm_set1_epi32(value);
+  for (; i + 4 <= n; i += 4) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(data + i));
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+    count += (size_t)__builtin_popcount((unsigned)mask);
+  }
+#elif defined(C_DSA_SIMD_NEON)
+  int32x4_t needle = vdupq_n_s32(value);
+  uint64x2_t total = vdupq_n_u64(0);
+  for (; i + 4 <= n; i += 4) {
+    // every match is all ones, shifting keeps one bit per lane
+    uint32x4_t equal = vshrq_n_u32(vceqq_s32(vld1q_s32(data + i), needle), 31);
+    total = vpadalq_u32(total, equal);
+  }
+  count = (size_t)(vgetq_lane_u64(total, 0) + vgetq_lane_u64(total, 1));
+#endif
+  for (; i < n; i++) {
+    count += data[i] == value;
+  }
+  return count;
+}
+
+/**
+ * @fn int64_t sum_ints(const int *data, size_t n)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the sum of the \i `n` integers, accumulated on 64 bits
+ */
+C_DSA_API int64_t sum_ints(const int *data, size_t n) {
+  size_t i = 0;
+  int64_t sum = 0;
+#if defined(C_DSA_SIMD_AVX2)
+  __m256i low = _mm256_setzero_si256(), high = _mm256_setzero_si256();
+  for (; i + 8 <= n; i += 8) {
+    __m256i block = _mm256_loadu_si256((const __m256i*)(data + i));
+    low = _mm256_add_epi64(low, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(block)));
+    high = _mm256_add_epi64(high, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(block, 1)));
+  }
+  int64_t lanes[4];
+  _mm256_storeu_si256((__m256i*)lanes, _mm256_add_epi64(low, high));
+  sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(C_DSA_SIMD_SSE2)
+  __m128i total = _mm_setzero_si128();
+  for (; i + 4 <= n; i += 4) {
+    __m128i block = _mm_loadu_si128((const __m128i*)(data + i));
+    __m128i sign = _mm_srai_epi32(block, 31);
+    total = _mm_add_epi64(total, _mm_unpacklo_epi32(block, sign));
+    total = _mm_add_epi64(total, _mm_unpackhi_epi32(block, sign));
+  }
+  int64_t lanes[2];
+  _mm_storeu_si128((__m128i*)lanes, total);
+  sum = lanes[0] + lanes[1];
+#elif defined(C_DSA_SIMD_NEON)
+  int64x2_t total = vdupq_n_s64(0);
+  for (; i + 4 <= n; i += 4) {
+    total = vpadalq_s32(total, vld1q_s32(data + i));
+  }
+  sum = vgetq_lane_s64(total, 0) + vgetq_lane_s64(total, 1);
+#endif
+  for (; i < n; i++) {
+    sum += data[i];
+  }
+  return sum;
+}
+
+/**
+ * @fn status_t min_max_ints(const int *data, size_t n, int *min, int *max)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the smallest and the greatest of the \i `n` integers
+ *
+ * @param[out] min where the smallest integer is written (can be NULL)
+ * @param[out] max where the greatest integer is written (can be NULL)
+ *
+ * @return 0 if success and non-zero if there is no integer
+ */
+C_DSA_API status_t min_max_ints(const int *data, size_t n, int *min, int *max) {
+  if (!n) return INVALID_SIZE;
+  size_t i = 0;
+  int low = data[0], high = data[0];
+#if defined(C_DSA_SIMD_AVX2)
+  if (n >= 8) {
+    __m256i lows = _mm256_loadu_si256((const __m256i*)data), highs = lows;
+    for (i = 8; i + 8 <= n; i += 8) {
+      __m256i block = _mm256_loadu_si256((const __m256i*)(data + i));
+      lows = _mm256_min_epi32(lows, block);
+      highs = _mm256_max_epi32(highs, block);
+    }
+    int lanes_low[8], lanes_high[8];
+    _mm256_storeu_si256((__m256i*)lanes_low, lows);
+    _mm256_storeu_si256((__m256i*)lanes_high, highs);
+    for (int lane = 0; lane < 8; lane++) {
+      if (lanes_low[lane] < low) low = lanes_low[lane];
+      if (lanes_high[lane] > high) high = lanes_high[lane];
+    }
+  }
+#elif defined(C_DSA_SIMD_SSE2)
+  if (n >= 4) {
+    __m128i lows = _mm_loadu_si128((const __m128i*)data), highs = lows;
+    for (i = 4; i + 4 <= n; i += 4) {
+      __m128i block = _mm_loadu_si128((const __m128i*)(data + i));
+      lows = c_dsa_min_epi32(lows, block);
+      highs = c_dsa_max_epi32(highs, block);
+    }
+    int lanes_low[4], lanes_high[4];
+    _mm_storeu_si128((__m128i*)lanes_low, lows);
+    _mm_storeu_si128((__m128i*)lanes_high, highs);
+    for (int lane = 0; lane < 4; lane++) {
+      if (lanes_low[lane] < low) low = lanes_low[lane];
+      if (lanes_high[lane] > high) high = lanes_high[lane];
+    }
+  }
+#elif defined(C_DSA_SIMD_NEON)
+  if (n >= 4) {
+    int32x4_t lows = vld1q_s32(data), highs = lows;
+    for (i = 4; i + 4 <= n; i += 4) {
+      int32x4_t block = vld1q_s32(data + i);
+      lows = vminq_s32(lows, block);
+      highs = vmaxq_s32(highs, block);
+    }
+    int lanes_low[4], lanes_high[4];
+    vst1q_s32(lanes_low, lows);
+    vst1q_s32(lanes_high, highs);
+    for (int lane = 0; lane < 4; lane++) {
+      if (lanes_low[lane] < low) low = lanes_low[lane];
+      if (lanes_high[lane] > high) high = lanes_high[lane];
+    }
+  }
+#endif
+  for (; i < n; i++) {
+    if (data[i] < low) low = data[i];
+    if (data[i] > high) high = data[i];
+  }
+  if (min) *min = low;
+  if (max) *max = high;
+  return NO_ERROR;
+}
+
+/**
+ * @fn void fill_ints(int *data, size_t n, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief set the \i `n` integers to \i `value`
+ */
+C_DSA_API void fill_ints(int *data, size_t n, int value) {
+  size_t i = 0;
+#if defined(C_DSA_SIMD_AVX2)
+  __m256i block = _mm256_set1_epi32(value);
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_si256((__m256i*)(data + i), block);
+  }
+#elif defined(C_DSA_SIMD_SSE2)
+  __m128i block = _mm_set1_epi32(value);
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_si128((__m128i*)(data + i), block);
+  }
+#elif defined(C_DSA_SIMD_NEON)
+  int32x4_t block = vdupq_n_s32(value);
+  for (; i + 4 <= n; i += 4) {
+    vst1q_s32(data + i, block);
+  }
+#endif
+  for (; i < n; i++) {
+    data[i] = value;
+  }
+}
+
+/**
+ * @fn int *find_StrictArray_int(StrictArray_int *arr, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the first element equal to \i `value`
+ *
+ * @return a pointer to the element, a null pointer if there is none
+ */
+C_DSA_API int *find_StrictArray_int(StrictArray_int *arr, int value) {
+  if (!arr) return NULL;
+  size_t index = find_ints(arr->data, arr->size, value);
+  return index == arr->size ? NULL : arr->data + index;
+}
+
+/**
+ * @fn size_t count_StrictArray_int(StrictArray_int *arr, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the number of elements equal to \i `value`
+ */
+C_DSA_API size_t count_StrictArray_int(StrictArray_int *arr, int value) {
+  if (!arr) return 0;
+  return count_ints(arr->data, arr->size, value);
+}
+
+/**
+ * @fn int64_t sum_StrictArray_int(StrictArray_int *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the sum of the elements, accumulated on 64 bits
+ */
+C_DSA_API int64_t sum_StrictArray_int(StrictArray_int *arr) {
+  if (!arr) return 0;
+  return sum_ints(arr->data, arr->size);
+}
+
+/**
+ * @fn status_t min_max_StrictArray_int(StrictArray_int *arr, int *min, int *max)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write the smallest and the greatest elements to \i `min` and \i `max`
+ *
+ * @return 0 if success and non-zero if the array is a null pointer or empty
+ */
+C_DSA_API status_t min_max_StrictArray_int(StrictArray_int *arr, int *min, int *max) {
+  if (!arr) return SEGFAULT;
+  return min_max_ints(arr->data, arr->size, min, max);
+}
+
+/**
+ * @fn void fill_StrictArray_int(StrictArray_int *arr, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief set every elements in [0, \i `size` - 1] to \i `value`
+ */
+C_DSA_API void fill_StrictArray_int(StrictArray_int *arr, int value) {
+  if (!arr) return;
+  fill_ints(arr->data, arr->size, value);
+}
+
+/**
+ * @fn int *find_Array_int(Array_int *arr, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the first element equal to \i `value`
+ *
+ * @return a pointer to the element, a null pointer if there is none
+ */
+C_DSA_API int *find_Array_int(Array_int *arr, int value) {
+  if (!arr) return NULL;
+  size_t index = find_ints(arr->data, arr->capacity, value);
+  return index == arr->capacity ? NULL : arr->data + index;
+}
+
+/**
+ * @fn size_t count_Array_int(Array_int *arr, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the number of elements equal to \i `value`
+ */
+C_DSA_API size_t count_Array_int(Array_int *arr, int value) {
+  if (!arr) return 0;
+  return count_ints(arr->data, arr->capacity, value);
+}
+
+/**
+ * @fn int64_t sum_Array_int(Array_int *arr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the sum of the elements, accumulated on 64 bits
+ */
+C_DSA_API int64_t sum_Array_int(Array_int *arr) {
+  if (!arr) return 0;
+  return sum_ints(arr->data, arr->capacity);
+}
+
+/**
+ * @fn status_t min_max_Array_int(Array_int *arr, int *min, int *max)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write the smallest and the greatest elements to \i `min` and \i `max`
+ *
+ * @return 0 if success and non-zero if the array is a null pointer or empty
+ */
+C_DSA_API status_t min_max_Array_int(Array_int *arr, int *min, int *max) {
+  if (!arr) return SEGFAULT;
+  return min_max_ints(arr->data, arr->capacity, min, max);
+}
+
+/**
+ * @fn void fill_Array_int(Array_int *arr, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief set every elements in [0, \i `capacity` - 1] to \i `value`
+ */
+C_DSA_API void fill_Array_int(Array_int *arr, int value) {
+  if (!arr) return;
+  fill_ints(arr->data, arr->capacity, value);
+}
+
+/**
+ * @fn int *find_ArrayView_int(const ArrayView_int *view, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return a pointer to the first element of the view equal to \i `value`
+ *
+ * @return a pointer to the element, a null pointer if there is none
+ */
+C_DSA_API int *find_ArrayView_int(const ArrayView_int *view, int value) {
+  if (!view) return NULL;
+  if (view->stride == 1) {
+    size_t index = find_ints(view->data, view->size, value);
+    return index == view->size ? NULL : view->data + index;
+  }
+  for (size_t i = 0; i < view->size; i++) {
+    if (view->data[view->stride * i] == value) return view->data + view->stride * i;
+  }
+  return NULL;
+}
+
+/**
+ * @fn size_t count_ArrayView_int(const ArrayView_int *view, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the number of elements of the view equal to \i `value`
+ */
+C_DSA_API size_t count_ArrayView_int(const ArrayView_int *view, int value) {
+  if (!view) return 0;
+  if (view->stride == 1) return count_ints(view->data, view->size, value);
+  size_t count = 0;
+  for (size_t i = 0; i < view->size; i++) {
+    count += view->data[view->stride * i] == value;
+  }
+  return count;
+}
+
+/**
+ * @fn int64_t sum_ArrayView_int(const ArrayView_int *view)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the sum of the elements of the view, accumulated on 64 bits
+ */
+C_DSA_API int64_t sum_ArrayView_int(const ArrayView_int *view) {
+  if (!view) return 0;
+  if (view->stride == 1) return sum_ints(view->data, view->size);
+  int64_t sum = 0;
+  for (size_t i = 0; i < view->size; i++) {
+    sum += view->data[view->stride * i];
+  }
+  return sum;
+}
+
+/**
+ * @fn status_t min_max_ArrayView_int(const ArrayView_int *view, int *min, int *max)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write the smallest and the greatest elements of the view to \i `min`
+ * and \i `max`
+ *
+ * @return 0 if success and non-zero if the view is a null pointer or empty
+ */
+C_DSA_API status_t min_max_ArrayView_int(const ArrayView_int *view, int *min, int *max) {
+  if (!view) return SEGFAULT;
+  if (view->stride == 1) return min_max_ints(view->data, view->size, min, max);
+  if (!view->size) return INVALID_SIZE;
+  int low = view->data[0], high = view->data[0];
+  for (size_t i = 1; i < view->size; i++) {
+    int value = view->data[view->stride * i];
+    low = value < low ? value : low;
+    high = value > high ? value : high;
+  }
+  if (min) *min = low;
+  if (max) *max = high;
+  return NO_ERROR;
+}
+
+/**
+ * @fn void fill_ArrayView_int(const ArrayView_int *view, int value)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief set every elements of the view to \i `value`
+ */
+C_DSA_API void fill_ArrayView_int(const ArrayView_int *view, int value) {
+  if (!view) return;
+  if (view->stride == 1) {
+    fill_ints(view->data, view->size, value);
+    return;
+  }
+  for (size_t i = 0; i < view->size; i++) {
+    view->data[view->stride * i] = value;
+  }
+}
+
+#endif // __C_DSA_INT_KERNELS_H__
@@ -0,0 +1,32 @@
+/**
+ * @file int64/ArrayView.h
+ * @brief a non-owning view over 64-bit signed integers
+ * @author andarling
+ * @date 14/10/2026
+ * 
+ * @details This library introduces a structure \c `ArrayView_int64`, a view over
+ * some elements of a \c `StrictArray_int64`, an \c `Array_int64` or another view,
+ * made without allocation nor copy.
+ * 
+ * The structure and APIs are generated by \c `DEFINE_ARRAY_VIEW`, see
+ * generic/ArrayView_template.h for the details of every function.
+ * 
+ * ArrayView_int64's APIs:
+ * @li view_T : a view over every element of type T
+ * @li slice_T : a view over the elements [begin, end - 1] of type T
+ * @li strided_T : a view over one element every \i `step` in [begin, end - 1] of type T
+ * @li subview_ArrayView_int64 : a view over the elements [begin, end - 1] of a view
+ * @li get_item_ArrayView_int64 : get the pointer to the item on \i `index` of a view
+ */
+#ifndef __C_DSA_INT64_ARRAY_VIEW_H__
+#define __C_DSA_INT64_ARRAY_VIEW_H__
+
+#include <stdint.h>
+
+#include "../generic/ArrayView_template.h"
+#include "StrictArray.h"
+#include "Array.h"
+
+DEFINE_ARRAY_VIEW(int64_t, int64)
+
+#endif // __C_DSA_INT64_ARRAY_VIEW_H__
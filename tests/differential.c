@@ -0,0 +1,549 @@
+/**
+ * @file tests/differential.c
+ * @brief differential tests of the array families against a reference model
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details Random sequences of operations are applied at the same time to a
+ * generic container, to its \c `_int` (or \c `_int64`) specialisation and to a
+ * plain C array, the reference model. After every operation the statuses, the
+ * sizes, the capacities and every element must agree, and reads outside
+ * [0, \i `size` - 1] must return a null pointer.
+ * Covered: StrictArray, Array, DynamicArray, SmallArray, RingBuffer (from one
+ * thread), Stack, Deque, ChunkedArray and HashMap.
+ *
+ * Run from the build directory: ./differential (see tests/test_util.h for
+ * \c `C_DSA_TEST_SEED` and \c `C_DSA_TEST_SCALE`)
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include <string.h>
+
+#include "../generic/StrictArray.h"
+#include "../generic/Array.h"
+#include "../generic/DynamicArray.h"
+#include "../generic/RingBuffer.h"
+#include "../generic/Stack.h"
+#include "../generic/Deque.h"
+#include "../generic/ChunkedArray.h"
+#include "../generic/HashMap.h"
+#include "../int/StrictArray.h"
+#include "../int/Array.h"
+#include "../int/DynamicArray.h"
+#include "../int/SmallArray.h"
+#include "../int/RingBuffer.h"
+#include "../int/HashMap.h"
+#include "../int64/StrictArray.h"
+#include "test_util.h"
+
+#define MODEL_CAPACITY 4096
+#define BATCH 12
+
+/**
+ * @brief the reference model: the first \i `size` values of \i `data`
+ */
+typedef struct Model {
+  size_t size;
+  int data[MODEL_CAPACITY];
+} Model;
+
+static Model model;
+static uint64_t rng;
+
+static int random_value(void) {
+  return (int)(uint32_t)next_random(&rng);
+}
+
+static void check_StrictArrays(StrictArray *g, StrictArray_int *t, size_t cap) {
+  CHECK(g->size == model.size && t->size == model.size);
+  CHECK(g->capacity == cap && t->capacity == cap);
+  for (size_t i = 0; i < model.size; i++) {
+    CHECK(*(int*)get_item(g, i) == model.data[i]);
+    CHECK(*get_item_StrictArray_int(t, i) == model.data[i]);
+  }
+  CHECK(get_item(g, model.size) == NULL && get_item_StrictArray_int(t, model.size) == NULL);
+  CHECK(get_item(g, cap + 1) == NULL && get_item_StrictArray_int(t, (size_t)-1) == NULL);
+}
+
+static void differential_StrictArray(size_t rounds, size_t steps) {
+  for (size_t round = 0; round < rounds; round++) {
+    size_t cap = random_below(&rng, 80), initial = random_below(&rng, cap + 1);
+    for (size_t i = 0; i < initial; i++) model.data[i] = random_value();
+    model.size = initial;
+    StrictArray *g = NULL;
+    StrictArray_int *t = NULL;
+    CHECK(get_data(new_StrictArray(model.data, initial, cap, sizeof(int)), (void**)&g) == NULL);
+    CHECK(get_data(new_StrictArray_int(model.data, initial, cap), (void**)&t) == NULL);
+    if (!g || !t) return;
+
+    for (size_t step = 0; step < steps; step++) {
+      int values[BATCH];
+      size_t count = random_below(&rng, BATCH + 1);
+      for (size_t i = 0; i < count; i++) values[i] = random_value();
+      switch (random_below(&rng, 8)) {
+        case 0: {
+          status_t expected = model.size < cap ? NO_ERROR : NO_SPACE;
+          CHECK(push_back_StrictArray(g, values) == expected);
+          CHECK(push_back_StrictArray_int(t, values[0]) == expected);
+          if (expected == NO_ERROR) model.data[model.size++] = values[0];
+          break;
+        }
+        case 1: {
+          status_t expected = count <= cap - model.size ? NO_ERROR : NO_SPACE;
+          CHECK(append_range_StrictArray(g, values, count) == expected);
+          CHECK(append_range_StrictArray_int(t, values, count) == expected);
+          if (expected == NO_ERROR) {
+            memcpy(model.data + model.size, values, sizeof(int) * count);
+            model.size += count;
+          }
+          break;
+        }
+        case 2:
+          pop_back_StrictArray(g);
+          pop_back_StrictArray_int(t);
+          if (model.size) model.size--;
+          break;
+        case 3:
+          pop_back_n_StrictArray(g, count);
+          pop_back_n_StrictArray_int(t, count);
+          model.size = count < model.size ? model.size - count : 0;
+          break;
+        case 4:
+          if (!random_below(&rng, 8)) {
+            clear_StrictArray(g);
+            clear_StrictArray_int(t);
+            model.size = 0;
+          }
+          break;
+        case 5:
+          if (model.size) {
+            size_t index = random_below(&rng, model.size);
+            *(int*)get_item(g, index) = values[0];
+            *get_item_StrictArray_int(t, index) = values[0];
+            model.data[index] = values[0];
+          }
+          break;
+        case 6: {
+          // every clone must hold the same elements, then the originals go on
+          StrictArray *gc = NULL;
+          StrictArray_int *tc = NULL;
+          CHECK(get_data(from_StrictArray(g), (void**)&gc) == NULL);
+          CHECK(get_data(from_StrictArray_int(t), (void**)&tc) == NULL);
+          if (gc && tc) check_StrictArrays(gc, tc, cap);
+          free_StrictArray(&gc);
+          free_StrictArray_int(&tc);
+          CHECK(get_data(clone_shrink_StrictArray(g), (void**)&gc) == NULL);
+          CHECK(get_data(clone_shrink_StrictArray_int(t), (void**)&tc) == NULL);
+          if (gc && tc) check_StrictArrays(gc, tc, model.size);
+          free_StrictArray(&gc);
+          free_StrictArray_int(&tc);
+          break;
+        }
+        case 7: {
+          StrictArray *gc = NULL;
+          StrictArray_int *tc = NULL;
+          CHECK(copy_into_StrictArray(&gc, g) == NO_ERROR);
+          CHECK(copy_into_StrictArray_int(&tc, t) == NO_ERROR);
+          if (gc && tc) check_StrictArrays(gc, tc, model.size);
+          free_StrictArray(&gc);
+          free_StrictArray_int(&tc);
+          break;
+        }
+      }
+      check_StrictArrays(g, t, cap);
+    }
+    free_StrictArray(&g);
+    free_StrictArray_int(&t);
+    CHECK(g == NULL && t == NULL);
+  }
+}
+
+static void differential_StrictArray_int64(size_t rounds, size_t steps) {
+  int64_t reference[MODEL_CAPACITY];
+  for (size_t round = 0; round < rounds; round++) {
+    size_t cap = random_below(&rng, 80), size = 0;
+    StrictArray_int64 *t = NULL;
+    CHECK(get_data(new_StrictArray_int64(NULL, 0, cap), (void**)&t) == NULL);
+    if (!t) return;
+    for (size_t step = 0; step < steps; step++) {
+      int64_t value = (int64_t)next_random(&rng);
+      if (random_below(&rng, 3)) {
+        CHECK(push_back_StrictArray_int64(t, value) == (size < cap ? NO_ERROR : NO_SPACE));
+        if (size < cap) reference[size++] = value;
+      }
+      else {
+        pop_back_StrictArray_int64(t);
+        if (size) size--;
+      }
+      CHECK(t->size == size);
+      for (size_t i = 0; i < size; i++) CHECK(*get_item_StrictArray_int64(t, i) == reference[i]);
+      CHECK(get_item_StrictArray_int64(t, size) == NULL);
+    }
+    free_StrictArray_int64(&t);
+  }
+}
+
+static void differential_Array(size_t rounds) {
+  for (size_t round = 0; round < rounds; round++) {
+    size_t cap = random_below(&rng, 200), initial = random_below(&rng, cap + 1);
+    for (size_t i = 0; i < cap; i++) model.data[i] = i < initial ? random_value() : 0;
+    Array *g = NULL;
+    Array_int *t = NULL;
+    CHECK(get_data(new_Array(model.data, initial, cap, sizeof(int)), (void**)&g) == NULL);
+    CHECK(get_data(new_Array_int(model.data, initial, cap), (void**)&t) == NULL);
+    if (!g || !t) return;
+    for (size_t i = 0; i < initial; i++) {
+      CHECK(*(int*)get_item_Array(g, i) == model.data[i] && *get_item_Array_int(t, i) == model.data[i]);
+    }
+    for (size_t i = 0; i < cap; i++) {
+      model.data[i] = random_value();
+      *(int*)get_item_Array(g, i) = model.data[i];
+      *get_item_Array_int(t, i) = model.data[i];
+    }
+    Array *gc = NULL;
+    Array_int *tc = NULL;
+    CHECK(get_data(from_Array(g), (void**)&gc) == NULL);
+    CHECK(get_data(from_Array_int(t), (void**)&tc) == NULL);
+    if (gc && tc) {
+      CHECK(gc->capacity == cap && tc->capacity == cap);
+      for (size_t i = 0; i < cap; i++) {
+        CHECK(*(int*)get_item_Array(gc, i) == model.data[i]);
+        CHECK(*get_item_Array_int(tc, i) == model.data[i]);
+      }
+    }
+    CHECK(get_item_Array(g, cap) == NULL && get_item_Array_int(t, cap) == NULL);
+    free_Array(&g), free_Array(&gc);
+    free_Array_int(&t), free_Array_int(&tc);
+  }
+}
+
+static void differential_DynamicArray(size_t rounds, size_t steps) {
+  for (size_t round = 0; round < rounds; round++) {
+    DynamicArray *g = NULL;
+    DynamicArray_int *t = NULL;
+    SmallArray_int s;
+    CHECK(get_data(new_DynamicArray(NULL, 0, random_below(&rng, 4), sizeof(int)), (void**)&g) == NULL);
+    CHECK(get_data(new_DynamicArray_int(NULL, 0, random_below(&rng, 4)), (void**)&t) == NULL);
+    CHECK(init_SmallArray_int(&s) == NO_ERROR);
+    if (!g || !t) return;
+    if (random_below(&rng, 2)) {
+      CHECK(set_growth_factor_DynamicArray(g, 1.1) == NO_ERROR);
+      CHECK(set_growth_factor_DynamicArray_int(t, 3.0) == NO_ERROR);
+    }
+    model.size = 0;
+
+    for (size_t step = 0; step < steps; step++) {
+      int value = random_value();
+      switch (random_below(&rng, 7)) {
+        case 0: case 1: case 2:
+          if (model.size == MODEL_CAPACITY) break;
+          CHECK(push_back_DynamicArray(&g, &value) == NO_ERROR);
+          CHECK(push_back_DynamicArray_int(&t, value) == NO_ERROR);
+          CHECK(push_back_SmallArray_int(&s, value) == NO_ERROR);
+          model.data[model.size++] = value;
+          break;
+        case 3:
+          pop_back_DynamicArray(g);
+          pop_back_DynamicArray_int(t);
+          pop_back_SmallArray_int(&s);
+          if (model.size) model.size--;
+          break;
+        case 4: {
+          size_t cap = random_below(&rng, 2 * model.size + 8);
+          CHECK(reserve_DynamicArray(&g, cap) == NO_ERROR);
+          CHECK(reserve_DynamicArray_int(&t, cap) == NO_ERROR);
+          CHECK(reserve_SmallArray_int(&s, cap) == NO_ERROR);
+          CHECK(g->capacity >= cap && t->capacity >= cap && s.capacity >= cap);
+          break;
+        }
+        case 5:
+          if (random_below(&rng, 4)) {
+            CHECK(shrink_to_fit_DynamicArray(&g) == NO_ERROR);
+            CHECK(shrink_to_fit_DynamicArray_int(&t) == NO_ERROR);
+            CHECK(shrink_to_fit_SmallArray_int(&s) == NO_ERROR);
+          }
+          else {
+            clear_DynamicArray(g);
+            clear_DynamicArray_int(t);
+            clear_SmallArray_int(&s);
+            model.size = 0;
+          }
+          break;
+        case 6: {
+          // SmallArray appends a range of its own elements, spilling or regrowing
+          size_t begin = random_below(&rng, model.size + 1);
+          size_t count = random_below(&rng, model.size - begin + 1);
+          if (model.size + count > MODEL_CAPACITY) break;
+          CHECK(append_range_SmallArray_int(&s, data_ptr_SmallArray_int(&s) + begin, count) == NO_ERROR);
+          for (size_t i = 0; i < count; i++) {
+            int copied = model.data[begin + i];
+            CHECK(push_back_DynamicArray(&g, &copied) == NO_ERROR);
+            CHECK(push_back_DynamicArray_int(&t, copied) == NO_ERROR);
+            model.data[model.size + i] = copied;
+          }
+          model.size += count;
+          break;
+        }
+      }
+      CHECK(g->size == model.size && t->size == model.size && s.size == model.size);
+      CHECK(g->capacity >= g->size && t->capacity >= t->size && s.capacity >= s.size);
+      for (size_t i = 0; i < model.size; i++) {
+        CHECK(*(int*)get_item_DynamicArray(g, i) == model.data[i]);
+        CHECK(*get_item_DynamicArray_int(t, i) == model.data[i]);
+        CHECK(*get_item_SmallArray_int(&s, i) == model.data[i]);
+      }
+      CHECK(get_item_DynamicArray(g, model.size) == NULL);
+      CHECK(get_item_DynamicArray_int(t, model.size) == NULL);
+      CHECK(get_item_SmallArray_int(&s, model.size) == NULL);
+    }
+    free_DynamicArray(&g);
+    free_DynamicArray_int(&t);
+    destroy_SmallArray_int(&s);
+  }
+}
+
+static void differential_RingBuffer(size_t rounds, size_t steps) {
+  for (size_t round = 0; round < rounds; round++) {
+    size_t cap = 1 + random_below(&rng, 64), rounded = RingBuffer_round_capacity(cap);
+    RingBuffer *g = NULL;
+    RingBuffer_int *t = NULL;
+    CHECK(get_data(new_RingBuffer(cap, sizeof(int)), (void**)&g) == NULL);
+    CHECK(get_data(new_RingBuffer_int(cap), (void**)&t) == NULL);
+    if (!g || !t) return;
+    // the model is a queue in model.data[head, head + size - 1] modulo its capacity
+    size_t head = 0;
+    model.size = 0;
+
+    for (size_t step = 0; step < steps; step++) {
+      int values[BATCH], got_g[BATCH], got_t[BATCH];
+      size_t count = random_below(&rng, BATCH + 1);
+      for (size_t i = 0; i < count; i++) values[i] = random_value();
+      switch (random_below(&rng, 4)) {
+        case 0: {
+          status_t expected = model.size < rounded ? NO_ERROR : NO_SPACE;
+          CHECK(try_push_RingBuffer(g, values) == expected);
+          CHECK(try_push_RingBuffer_int(t, values[0]) == expected);
+          if (expected == NO_ERROR) model.data[(head + model.size++) % MODEL_CAPACITY] = values[0];
+          break;
+        }
+        case 1: {
+          size_t expected = count < rounded - model.size ? count : rounded - model.size;
+          CHECK(try_push_n_RingBuffer(g, values, count) == expected);
+          CHECK(try_push_n_RingBuffer_int(t, values, count) == expected);
+          for (size_t i = 0; i < expected; i++) model.data[(head + model.size++) % MODEL_CAPACITY] = values[i];
+          break;
+        }
+        case 2: {
+          status_t expected = model.size ? NO_ERROR : EMPTY_CONTAINER;
+          CHECK(try_pop_RingBuffer(g, got_g) == expected);
+          CHECK(try_pop_RingBuffer_int(t, got_t) == expected);
+          if (expected == NO_ERROR) {
+            CHECK(got_g[0] == model.data[head] && got_t[0] == model.data[head]);
+            head = (head + 1) % MODEL_CAPACITY, model.size--;
+          }
+          break;
+        }
+        case 3: {
+          size_t expected = count < model.size ? count : model.size;
+          CHECK(try_pop_n_RingBuffer(g, got_g, count) == expected);
+          CHECK(try_pop_n_RingBuffer_int(t, got_t, count) == expected);
+          for (size_t i = 0; i < expected; i++) {
+            CHECK(got_g[i] == model.data[head] && got_t[i] == model.data[head]);
+            head = (head + 1) % MODEL_CAPACITY, model.size--;
+          }
+          break;
+        }
+      }
+      CHECK(size_RingBuffer(g) == model.size && size_RingBuffer_int(t) == model.size);
+    }
+    free_RingBuffer(&g);
+    free_RingBuffer_int(&t);
+  }
+}
+
+static void differential_Stack_Deque(size_t rounds, size_t steps) {
+  for (size_t round = 0; round < rounds; round++) {
+    size_t cap = random_below(&rng, 100);
+    Stack *stack = NULL;
+    Deque *deque = NULL;
+    CHECK(get_data(new_Stack(cap, sizeof(int)), (void**)&stack) == NULL);
+    CHECK(get_data(new_Deque(sizeof(int)), (void**)&deque) == NULL);
+    if (!stack || !deque) return;
+    // the stack is checked against model.data, the deque against a second model
+    static int queue[2 * MODEL_CAPACITY];
+    size_t front = MODEL_CAPACITY, back = MODEL_CAPACITY;
+    model.size = 0;
+
+    for (size_t step = 0; step < steps; step++) {
+      int value = random_value(), out = 0;
+      switch (random_below(&rng, 6)) {
+        case 0:
+          CHECK(push_Stack(stack, &value) == (model.size < cap ? NO_ERROR : NO_SPACE));
+          if (model.size < cap) model.data[model.size++] = value;
+          break;
+        case 1:
+          CHECK(pop_Stack(stack, &out) == (model.size ? NO_ERROR : EMPTY_CONTAINER));
+          if (model.size) CHECK(out == model.data[--model.size]);
+          break;
+        case 2:
+          if (back == 2 * MODEL_CAPACITY) break;
+          CHECK(push_back_Deque(deque, &value) == NO_ERROR);
+          queue[back++] = value;
+          break;
+        case 3:
+          if (front == 0) break;
+          CHECK(push_front_Deque(deque, &value) == NO_ERROR);
+          queue[--front] = value;
+          break;
+        case 4:
+          CHECK(pop_back_Deque(deque, &out) == (back > front ? NO_ERROR : EMPTY_CONTAINER));
+          if (back > front) CHECK(out == queue[--back]);
+          break;
+        case 5:
+          CHECK(pop_front_Deque(deque, &out) == (back > front ? NO_ERROR : EMPTY_CONTAINER));
+          if (back > front) CHECK(out == queue[front++]);
+          break;
+      }
+      CHECK(stack->size == model.size);
+      CHECK(model.size ? *(int*)peek_Stack(stack) == model.data[model.size - 1] : peek_Stack(stack) == NULL);
+      CHECK(deque->size == back - front);
+      if (!random_below(&rng, 16)) {
+        for (size_t i = 0; i < back - front; i++) CHECK(*(int*)get_item_Deque(deque, i) == queue[front + i]);
+      }
+      CHECK(get_item_Deque(deque, back - front) == NULL);
+    }
+    free_Stack(&stack);
+    free_Deque(&deque);
+  }
+}
+
+static void differential_ChunkedArray(size_t rounds, size_t steps) {
+  for (size_t round = 0; round < rounds; round++) {
+    ChunkedArray *arr = NULL;
+    CHECK(get_data(new_ChunkedArray(1 + random_below(&rng, 40), sizeof(int)), (void**)&arr) == NULL);
+    if (!arr) return;
+    // the model holds the elements [released, released + size - 1]
+    size_t released = 0;
+    model.size = 0;
+
+    for (size_t step = 0; step < steps; step++) {
+      int values[BATCH];
+      size_t count = random_below(&rng, BATCH + 1);
+      for (size_t i = 0; i < count; i++) values[i] = random_value();
+      switch (random_below(&rng, 4)) {
+        case 0:
+          if (released + model.size >= MODEL_CAPACITY) break;
+          CHECK(push_back_ChunkedArray(arr, values) == NO_ERROR);
+          model.data[released + model.size++] = values[0];
+          break;
+        case 1:
+          if (released + model.size + count > MODEL_CAPACITY) break;
+          CHECK(append_range_ChunkedArray(arr, values, count) == NO_ERROR);
+          memcpy(model.data + released + model.size, values, sizeof(int) * count);
+          model.size += count;
+          break;
+        case 2: {
+          // release_front only drops whole chunks, the rest stays readable
+          release_front_ChunkedArray(arr, count);
+          size_t dropped = model.size - arr->size;
+          released += dropped, model.size -= dropped;
+          CHECK(dropped <= count);
+          break;
+        }
+        case 3:
+          if (!random_below(&rng, 8)) {
+            clear_ChunkedArray(arr);
+            released = 0, model.size = 0;
+          }
+          break;
+      }
+      CHECK(arr->size == model.size);
+      for (size_t i = 0; i < model.size; i++) {
+        CHECK(*(int*)get_item_ChunkedArray(arr, i) == model.data[released + i]);
+      }
+      CHECK(get_item_ChunkedArray(arr, model.size) == NULL);
+      size_t chunk = 0, seen = 0, n;
+      void *data;
+      while (next_chunk_ChunkedArray(arr, &chunk, &data, &n)) {
+        CHECK(memcmp(data, model.data + released + seen, sizeof(int) * n) == 0);
+        seen += n;
+      }
+      CHECK(seen == model.size);
+    }
+    free_ChunkedArray(&arr);
+  }
+}
+
+static void differential_HashMap(size_t rounds, size_t steps) {
+  enum { KEYS = 512 };
+  for (size_t round = 0; round < rounds; round++) {
+    HashMap *g = NULL;
+    HashMap_int *t = NULL;
+    CHECK(get_data(new_HashMap(sizeof(int), sizeof(int), NULL, NULL, random_below(&rng, 16)),
+                   (void**)&g) == NULL);
+    CHECK(get_data(new_HashMap_int(random_below(&rng, 16)), (void**)&t) == NULL);
+    if (!g || !t) return;
+    // the model maps a key in [0, KEYS - 1] to model.data[key] if present[key]
+    unsigned char present[KEYS] = { 0 };
+    size_t size = 0;
+
+    for (size_t step = 0; step < steps; step++) {
+      int key = (int)random_below(&rng, KEYS), value = random_value();
+      switch (random_below(&rng, 4)) {
+        case 0: case 1:
+          CHECK(insert_HashMap(g, &key, &value) == NO_ERROR);
+          CHECK(insert_HashMap_int(t, key, value) == NO_ERROR);
+          size += !present[key];
+          present[key] = 1, model.data[key] = value;
+          break;
+        case 2: {
+          status_t expected = present[key] ? NO_ERROR : INVALID_INDEX;
+          status_t got_g = erase_HashMap(g, &key), got_t = erase_HashMap_int(t, key);
+          CHECK((got_g == NO_ERROR) == (expected == NO_ERROR));
+          CHECK((got_t == NO_ERROR) == (expected == NO_ERROR));
+          size -= present[key];
+          present[key] = 0;
+          break;
+        }
+        case 3:
+          if (!random_below(&rng, 32)) {
+            clear_HashMap(g);
+            clear_HashMap_int(t);
+            memset(present, 0, sizeof(present));
+            size = 0;
+          }
+          break;
+      }
+      int *found_g = (int*)find_HashMap(g, &key), *found_t = find_HashMap_int(t, key);
+      CHECK(present[key] ? found_g && *found_g == model.data[key] : found_g == NULL);
+      CHECK(present[key] ? found_t && *found_t == model.data[key] : found_t == NULL);
+      CHECK(contains_HashMap(g, &key) == present[key] && contains_HashMap_int(t, key) == present[key]);
+      CHECK(g->size == size && t->size == size);
+    }
+    // iteration visits every key once
+    size_t index = 0, visited = 0;
+    void *key, *value;
+    while (next_HashMap(g, &index, &key, &value)) {
+      int k = *(int*)key;
+      CHECK(k >= 0 && k < KEYS && present[k] && *(int*)value == model.data[k]);
+      visited++;
+    }
+    CHECK(visited == size);
+    free_HashMap(&g);
+    free_HashMap_int(&t);
+  }
+}
+
+int main(void) {
+  rng = test_seed();
+  size_t scale = test_scale();
+  differential_StrictArray(200 * scale, 400);
+  differential_StrictArray_int64(50 * scale, 300);
+  differential_Array(300 * scale);
+  differential_DynamicArray(40 * scale, 1500);
+  differential_RingBuffer(100 * scale, 500);
+  differential_Stack_Deque(40 * scale, 3000);
+  differential_ChunkedArray(60 * scale, 400);
+  differential_HashMap(30 * scale, 3000);
+  return test_exit("differential");
+}
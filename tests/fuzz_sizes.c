@@ -0,0 +1,435 @@
+/**
+ * @file tests/fuzz_sizes.c
+ * @brief fuzzing of the constructors and of the size arithmetic
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details Every constructor is called with capacities and element sizes drawn
+ * from the edges of \c `size_t` (0, 1, around the powers of two, around
+ * \c `SIZE_MAX` divided by the element size, \c `SIZE_MAX`) and at random.
+ * A constructor must return \c `INVALID_SIZE` when the size of the block does
+ * not fit in a \c `size_t`, otherwise \c `NO_ERROR` or \c `HEAP_FAILURE`, and
+ * an array it did create must hold its first and last element, which the
+ * sanitizers check. The \c `*_bytes_required` functions must return the exact
+ * size or 0, and the deserialization must reject every corrupted buffer.
+ *
+ * The capacities whose block would be feasible but bigger than
+ * \c `FUZZ_MAX_BYTES` are drawn again, so that no run fills the memory, and
+ * the bigger ones are expected to fail: run the address sanitizer with
+ * \c `ASAN_OPTIONS=allocator_may_return_null=1`, as CTest does.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <string.h>
+
+#include "../generic/StrictArray.h"
+#include "../generic/Array.h"
+#include "../generic/DynamicArray.h"
+#include "../generic/RingBuffer.h"
+#include "../generic/ConcurrentStrictArray.h"
+#include "../generic/SoA.h"
+#include "../generic/HashMap.h"
+#include "../generic/ChunkedArray.h"
+#include "../generic/ArrayView.h"
+#include "../generic/serialization.h"
+#include "../int/StrictArray.h"
+#include "../int/ArrayView.h"
+#include "../int/DynamicArray.h"
+#include "../int/SmallArray.h"
+#include "../int/RingBuffer.h"
+#include "../int/HashMap.h"
+#include "../int64/Array.h"
+#include "../double/DynamicArray.h"
+#include "../bool/StrictArray.h"
+#include "../bool/Array.h"
+#include "test_util.h"
+
+#define FUZZ_MAX_BYTES ((size_t)1 << 22)
+
+static uint64_t rng;
+
+/**
+ * @brief a capacity for elements of \i `type_size` bytes, often on an edge
+ */
+static size_t fuzz_count(size_t type_size) {
+  size_t max = type_size ? SIZE_MAX / type_size : SIZE_MAX;
+  switch (random_below(&rng, 12)) {
+    case 0: return 0;
+    case 1: return 1 + random_below(&rng, 3);
+    case 2: return random_below(&rng, 300);
+    case 3: return ((size_t)1 << random_below(&rng, 12)) + random_below(&rng, 3) - 1;
+    case 4: return max - random_below(&rng, 4);
+    case 5: return max + random_below(&rng, 4);
+    case 6: return SIZE_MAX - random_below(&rng, 130);
+    case 7: return SIZE_MAX / 2 + random_below(&rng, 3) - 1;
+    case 8: return ((size_t)1 << (40 + random_below(&rng, 23))) + random_below(&rng, 3) - 1;
+    case 9: return max / 2 + random_below(&rng, 3);
+    case 10: return (size_t)next_random(&rng);
+    default: return (size_t)next_random(&rng) >> random_below(&rng, 64);
+  }
+}
+
+/**
+ * @brief whether \i `count` * \i `type_size` bytes are either small, or too
+ * big for any allocation to succeed
+ */
+static int fuzz_callable(size_t count, size_t type_size) {
+  size_t bytes;
+  if (__builtin_mul_overflow(count, type_size, &bytes)) return 1;
+  return bytes <= FUZZ_MAX_BYTES || bytes >= SIZE_MAX / 8;
+}
+
+/**
+ * @brief a capacity of \c `fuzz_count` that passes \c `fuzz_callable`
+ */
+static size_t fuzz_callable_count(size_t type_size) {
+  size_t count;
+  do count = fuzz_count(type_size); while (!fuzz_callable(count, type_size));
+  return count;
+}
+
+static size_t fuzz_type_size(void) {
+  switch (random_below(&rng, 4)) {
+    case 0: return 1 + random_below(&rng, 8);
+    case 1: return (size_t)1 << random_below(&rng, 8);
+    case 2: return random_below(&rng, 100);
+    default: return fuzz_count(1);
+  }
+}
+
+/**
+ * @brief whether \i `header` + \i `count` * \i `type_size` overflows
+ */
+static int overflows(size_t header, size_t count, size_t type_size) {
+  size_t bytes;
+  return __builtin_mul_overflow(count, type_size, &bytes) || __builtin_add_overflow(bytes, header, &bytes);
+}
+
+static int is_allocation_status(status_t status) {
+  return status == NO_ERROR || status == INVALID_SIZE || status == HEAP_FAILURE;
+}
+
+static void touch(void *first, void *last, size_t type_size) {
+  memset(first, 0x5a, type_size);
+  memset(last, 0xa5, type_size);
+}
+
+static void fuzz_generic(size_t iterations) {
+  for (size_t i = 0; i < iterations; i++) {
+    size_t type_size, cap;
+    do type_size = fuzz_type_size(), cap = fuzz_count(type_size);
+    while (!fuzz_callable(cap, type_size ? 2 * type_size + 32 : 32));
+
+    StrictArray *strict = NULL;
+    status_t status = create_StrictArray(&strict, NULL, 0, cap, type_size);
+    CHECK(is_allocation_status(status));
+    if (!type_size || overflows(sizeof(StrictArray), cap, type_size)) CHECK(status == INVALID_SIZE);
+    if (status == NO_ERROR) {
+      CHECK(strict->capacity == cap);
+      if (cap) {
+        strict->size = cap;
+        touch(get_item(strict, 0), get_item(strict, cap - 1), type_size);
+      }
+      free_StrictArray(&strict);
+    }
+    size_t bytes = StrictArray_bytes_required(cap, type_size);
+    CHECK(overflows(sizeof(StrictArray), cap, type_size) ? bytes == 0 : bytes == sizeof(StrictArray) + cap * type_size);
+
+    Array *fixed = NULL;
+    status = create_Array(&fixed, NULL, 0, cap, type_size);
+    CHECK(is_allocation_status(status));
+    if (!type_size || overflows(sizeof(Array), cap, type_size)) CHECK(status == INVALID_SIZE);
+    if (status == NO_ERROR) {
+      CHECK(fixed->capacity == cap);
+      if (cap) touch(get_item_Array(fixed, 0), get_item_Array(fixed, cap - 1), type_size);
+      free_Array(&fixed);
+    }
+    bytes = Array_bytes_required(cap, type_size);
+    CHECK(overflows(sizeof(Array), cap, type_size) ? bytes == 0 : bytes == sizeof(Array) + cap * type_size);
+
+    DynamicArray *dynamic = NULL;
+    status = create_DynamicArray(&dynamic, NULL, 0, cap, type_size);
+    CHECK(is_allocation_status(status));
+    if (!type_size || overflows(sizeof(DynamicArray), cap, type_size)) CHECK(status == INVALID_SIZE);
+    if (status == NO_ERROR) {
+      CHECK(dynamic->capacity == cap);
+      // a reserve beyond SIZE_MAX bytes must fail without touching the array
+      CHECK(reserve_DynamicArray(&dynamic, fuzz_callable_count(type_size)) != SEGFAULT);
+      CHECK(dynamic->capacity >= cap);
+      free_DynamicArray(&dynamic);
+    }
+
+    Result r = new_RingBuffer(cap, type_size);
+    CHECK(is_allocation_status(r.ok));
+    if (r.ok == NO_ERROR) {
+      RingBuffer *rb = (RingBuffer*)r.data;
+      char value[256] = { 0 };
+      if (type_size <= sizeof(value)) {
+        CHECK(try_push_RingBuffer(rb, value) == NO_ERROR);
+        CHECK(try_pop_RingBuffer(rb, value) == NO_ERROR);
+      }
+      free_RingBuffer(&rb);
+    }
+    bytes = RingBuffer_bytes_required(cap, type_size);
+    size_t rounded = RingBuffer_round_capacity(cap);
+    if (bytes) CHECK(rounded >= cap && !overflows(sizeof(RingBuffer), rounded, type_size));
+    else CHECK(!rounded || overflows(sizeof(RingBuffer), rounded, type_size));
+
+    r = new_ConcurrentStrictArray(NULL, 0, cap, type_size);
+    CHECK(is_allocation_status(r.ok));
+    if (r.ok == NO_ERROR) {
+      ConcurrentStrictArray *concurrent = (ConcurrentStrictArray*)r.data;
+      char value[256] = { 0 };
+      if (cap && type_size <= sizeof(value)) CHECK(push_back_ConcurrentStrictArray(concurrent, value) == NO_ERROR);
+      free_ConcurrentStrictArray(&concurrent);
+    }
+
+    size_t field_sizes[3] = { type_size, 1, 8 }, field_offsets[3] = { 0, 0, 0 };
+    r = new_SoA(field_sizes, field_offsets, 1 + random_below(&rng, 3), cap);
+    CHECK(is_allocation_status(r.ok));
+    if (r.ok == NO_ERROR) {
+      SoA *soa = (SoA*)r.data;
+      free_SoA(&soa);
+    }
+    // the end of a field placed by the caller must fit in a size_t
+    field_offsets[0] = fuzz_count(1);
+    r = new_SoA(field_sizes, field_offsets, 1, 1);
+    if (type_size && overflows(field_offsets[0], 1, type_size)) CHECK(r.ok == INVALID_SIZE);
+    else CHECK(is_allocation_status(r.ok));
+    if (r.ok == NO_ERROR) {
+      SoA *soa = (SoA*)r.data;
+      CHECK(soa->row_bytes == field_offsets[0] + type_size);
+      free_SoA(&soa);
+    }
+
+    r = new_HashMap(type_size, 1 + random_below(&rng, 16), NULL, NULL, cap);
+    CHECK(is_allocation_status(r.ok));
+    if (r.ok == NO_ERROR) {
+      HashMap *map = (HashMap*)r.data;
+      free_HashMap(&map);
+    }
+
+    r = new_ChunkedArray(cap, type_size);
+    CHECK(is_allocation_status(r.ok));
+    if (r.ok == NO_ERROR) {
+      ChunkedArray *chunked = (ChunkedArray*)r.data;
+      char value[256] = { 0 };
+      // the chunks are allocated on demand, so a huge chunk fails on the first push
+      if (type_size <= sizeof(value)) CHECK(is_allocation_status(push_back_ChunkedArray(chunked, value)));
+      free_ChunkedArray(&chunked);
+    }
+  }
+}
+
+static void fuzz_specialised(size_t iterations) {
+  for (size_t i = 0; i < iterations; i++) {
+    size_t cap = fuzz_callable_count(sizeof(int));
+
+    StrictArray_int *strict = NULL;
+    status_t status = create_StrictArray_int(&strict, NULL, 0, cap);
+    CHECK(is_allocation_status(status));
+    if (overflows(sizeof(StrictArray_int), cap, sizeof(int))) CHECK(status == INVALID_SIZE);
+    if (status == NO_ERROR) {
+      CHECK(strict->capacity == cap);
+      if (cap) {
+        strict->size = cap;
+        *get_item_StrictArray_int(strict, 0) = 1, *get_item_StrictArray_int(strict, cap - 1) = 2;
+      }
+      free_StrictArray_int(&strict);
+    }
+    size_t bytes = StrictArray_int_bytes_required(cap);
+    CHECK(overflows(sizeof(StrictArray_int), cap, sizeof(int)) ? bytes == 0
+          : bytes == sizeof(StrictArray_int) + cap * sizeof(int));
+
+    cap = fuzz_callable_count(sizeof(int64_t));
+    Result r = new_Array_int64(NULL, 0, cap);
+    CHECK(is_allocation_status(r.ok));
+    if (overflows(sizeof(Array_int64), cap, sizeof(int64_t))) CHECK(r.ok == INVALID_SIZE);
+    if (r.ok == NO_ERROR) {
+      Array_int64 *fixed = (Array_int64*)r.data;
+      if (cap) *get_item_Array_int64(fixed, 0) = 1, *get_item_Array_int64(fixed, cap - 1) = 2;
+      free_Array_int64(&fixed);
+    }
+
+    cap = fuzz_callable_count(sizeof(double));
+    r = new_DynamicArray_double(NULL, 0, cap);
+    CHECK(is_allocation_status(r.ok));
+    if (overflows(sizeof(DynamicArray_double), cap, sizeof(double))) CHECK(r.ok == INVALID_SIZE);
+    if (r.ok == NO_ERROR) {
+      DynamicArray_double *dynamic = (DynamicArray_double*)r.data;
+      CHECK(push_back_DynamicArray_double(&dynamic, 0.5) != SEGFAULT);
+      free_DynamicArray_double(&dynamic);
+    }
+
+    cap = fuzz_callable_count(4 * sizeof(int));
+    DynamicArray_int *grown = NULL;
+    if (get_data(new_DynamicArray_int(NULL, 0, 1), (void**)&grown) == NULL) {
+      status = reserve_DynamicArray_int(&grown, cap);
+      CHECK(is_allocation_status(status));
+      if (overflows(sizeof(DynamicArray_int), cap, sizeof(int))) CHECK(status == INVALID_SIZE);
+      CHECK(grown && grown->capacity >= 1);
+      free_DynamicArray_int(&grown);
+    }
+
+    SmallArray_int small;
+    init_SmallArray_int(&small);
+    status = reserve_SmallArray_int(&small, cap);
+    CHECK(is_allocation_status(status));
+    if (overflows(0, cap, sizeof(int))) CHECK(status == INVALID_SIZE);
+    destroy_SmallArray_int(&small);
+
+    r = new_RingBuffer_int(cap);
+    CHECK(is_allocation_status(r.ok));
+    if (r.ok == NO_ERROR) {
+      RingBuffer_int *rb = (RingBuffer_int*)r.data;
+      int value = 0;
+      CHECK(try_push_RingBuffer_int(rb, 7) == NO_ERROR && try_pop_RingBuffer_int(rb, &value) == NO_ERROR);
+      CHECK(value == 7);
+      free_RingBuffer_int(&rb);
+    }
+
+    r = new_HashMap_int(cap);
+    CHECK(is_allocation_status(r.ok));
+    if (r.ok == NO_ERROR) {
+      HashMap_int *map = (HashMap_int*)r.data;
+      CHECK(insert_HashMap_int(map, 1, 2) == NO_ERROR);
+      free_HashMap_int(&map);
+    }
+  }
+}
+
+static void fuzz_bits(size_t iterations) {
+  for (size_t i = 0; i < iterations; i++) {
+    size_t cap;
+    do cap = fuzz_count(random_below(&rng, 2) ? 1 : 64); while (!fuzz_callable(words_for_bits(cap), sizeof(uint64_t)));
+    int fits = cap <= C_DSA_MAX_BITS && !overflows(sizeof(StrictArray_bool), words_for_bits(cap), sizeof(uint64_t));
+
+    Result r = new_StrictArray_bool(NULL, 0, cap);
+    CHECK(is_allocation_status(r.ok));
+    if (!fits) CHECK(r.ok == INVALID_SIZE);
+    if (r.ok == NO_ERROR) {
+      StrictArray_bool *strict = (StrictArray_bool*)r.data;
+      CHECK(strict->capacity == cap);
+      // the first bit lives in the first word, which must be part of the block
+      if (cap) CHECK(push_back_StrictArray_bool(strict, 1) == NO_ERROR && test_StrictArray_bool(strict, 0));
+      else CHECK(push_back_StrictArray_bool(strict, 1) == NO_SPACE);
+      free_StrictArray_bool(&strict);
+    }
+    size_t bytes = StrictArray_bool_bytes_required(cap);
+    CHECK(fits ? bytes == sizeof(StrictArray_bool) + sizeof(uint64_t) * words_for_bits(cap) : bytes == 0);
+
+    fits = cap <= C_DSA_MAX_BITS && !overflows(sizeof(Array_bool), words_for_bits(cap), sizeof(uint64_t));
+    r = new_Array_bool(NULL, 0, cap);
+    CHECK(is_allocation_status(r.ok));
+    if (!fits) CHECK(r.ok == INVALID_SIZE);
+    if (r.ok == NO_ERROR) {
+      Array_bool *fixed = (Array_bool*)r.data;
+      CHECK(fixed->capacity == cap);
+      if (cap) {
+        CHECK(set_Array_bool(fixed, 0, 1) == NO_ERROR && set_Array_bool(fixed, cap - 1, 1) == NO_ERROR);
+        CHECK(test_Array_bool(fixed, cap - 1));
+      }
+      free_Array_bool(&fixed);
+    }
+    CHECK(words_for_bits(cap) == cap / 64 + (cap % 64 != 0));
+  }
+}
+
+static void fuzz_serialization(size_t iterations) {
+  _Alignas(WireHeader) unsigned char buffer[sizeof(WireHeader) + 64 * sizeof(int)];
+  _Alignas(WireHeader) unsigned char copy[sizeof(buffer)];
+  for (size_t i = 0; i < iterations; i++) {
+    int values[64];
+    size_t size = random_below(&rng, 65);
+    for (size_t j = 0; j < size; j++) values[j] = (int)next_random(&rng);
+    StrictArray *arr = NULL;
+    if (create_StrictArray(&arr, values, size, size + random_below(&rng, 1000), sizeof(int)) != NO_ERROR) continue;
+    size_t bytes = serialized_bytes_StrictArray(arr);
+    CHECK(serialize_to_buffer_StrictArray(arr, buffer, sizeof(buffer)) == NO_ERROR);
+
+    StrictArray *back = NULL;
+    CHECK(get_data(deserialize_StrictArray(buffer, bytes), (void**)&back) == NULL);
+    if (back) {
+      CHECK(back->size == size && back->capacity == size);
+      CHECK(!size || memcmp(back->data, values, sizeof(int) * size) == 0);
+      free_StrictArray(&back);
+    }
+
+    // flipped bits, truncated buffers and random headers are all rejected
+    memcpy(copy, buffer, bytes);
+    size_t flips = 1 + random_below(&rng, 4);
+    for (size_t j = 0; j < flips; j++) {
+      size_t byte = random_below(&rng, bytes < offsetof(WireHeader, reserved) ? bytes : sizeof(WireHeader) + size * sizeof(int));
+      if (byte >= offsetof(WireHeader, reserved) && byte < sizeof(WireHeader)) byte = offsetof(WireHeader, checksum);
+      copy[byte] ^= (unsigned char)(1u << random_below(&rng, 8));
+    }
+    if (memcmp(copy, buffer, bytes)) CHECK(deserialize_StrictArray(copy, bytes).ok != NO_ERROR);
+    CHECK(deserialize_StrictArray(buffer, random_below(&rng, bytes)).ok != NO_ERROR);
+    for (size_t j = 0; j < sizeof(WireHeader); j++) copy[j] = (unsigned char)next_random(&rng);
+    memcpy(copy, C_DSA_WIRE_MAGIC, 4);
+    Result r = deserialize_StrictArray(copy, bytes);
+    CHECK(r.ok != NO_ERROR);
+    free_StrictArray(&arr);
+  }
+}
+
+/**
+ * @brief the number of elements begin, begin + step, ... before \i `end`
+ */
+static size_t strided_size(size_t begin, size_t end, size_t step) {
+  return end == begin ? 0 : 1 + (end - begin - 1) / step;
+}
+
+static void fuzz_views(size_t iterations) {
+  int values[100];
+  for (size_t i = 0; i < 100; i++) values[i] = (int)i;
+  StrictArray *arr = NULL;
+  StrictArray_int *ints = NULL;
+  CHECK(create_StrictArray(&arr, values, 100, 100, sizeof(int)) == NO_ERROR);
+  CHECK(get_data(new_StrictArray_int(values, 100, 100), (void**)&ints) == NULL);
+  if (!arr || !ints) goto cleanup;
+  for (size_t i = 0; i < iterations; i++) {
+    size_t end = random_below(&rng, 101), begin = random_below(&rng, end + 1);
+    size_t step = random_below(&rng, 2) ? fuzz_count(1) : 1 + random_below(&rng, 10);
+    if (!step) step = 1;
+
+    ArrayView view;
+    ArrayView_int view_int;
+    CHECK(strided_StrictArray(arr, begin, end, step, &view) == NO_ERROR);
+    CHECK(strided_StrictArray_int(ints, begin, end, step, &view_int) == NO_ERROR);
+    CHECK(view.size == strided_size(begin, end, step) && view_int.size == view.size);
+    if (view.size) {
+      CHECK(*(int*)get_item_ArrayView(&view, view.size - 1) == (int)(begin + (view.size - 1) * step));
+      CHECK(*get_item_ArrayView_int(&view_int, view.size - 1) == (int)(begin + (view.size - 1) * step));
+    }
+
+    // the stride of a view of a view must not wrap around
+    size_t outer = fuzz_count(1), stride;
+    if (!outer) outer = 1;
+    ArrayView nested;
+    ArrayView_int nested_int;
+    status_t status = strided_ArrayView(&view, 0, view.size, outer, &nested);
+    CHECK(strided_ArrayView_int(&view_int, 0, view_int.size, outer, &nested_int) == status);
+    if (__builtin_mul_overflow(step, outer, &stride)) {
+      CHECK(status == INVALID_SIZE);
+    } else {
+      CHECK(status == NO_ERROR);
+      CHECK(nested.stride == stride && nested_int.stride == stride);
+      CHECK(nested.size == strided_size(0, view.size, outer));
+    }
+  }
+cleanup:
+  free_StrictArray(&arr);
+  free_StrictArray_int(&ints);
+}
+
+int main(void) {
+  rng = test_seed();
+  size_t scale = test_scale();
+  fuzz_generic(20000 * scale);
+  fuzz_specialised(20000 * scale);
+  fuzz_bits(20000 * scale);
+  fuzz_serialization(5000 * scale);
+  fuzz_views(20000 * scale);
+  return test_exit("fuzz_sizes");
+}
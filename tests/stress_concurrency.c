@@ -0,0 +1,253 @@
+/**
+ * @file tests/stress_concurrency.c
+ * @brief stress tests of the structures shared between threads
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details The program runs a producer and a consumer on a \c `RingBuffer`
+ * and a \c `RingBuffer_int`, in batches of random sizes, and checks that every
+ * value comes out once and in order. Several threads then fill a
+ * \c `ConcurrentStrictArray` with \c `push_back` and \c `append_range` until it
+ * is full: every value must be stored exactly once, and every insertion beyond
+ * the capacity must return \c `NO_SPACE`. Last, the parallel algorithms of
+ * int/algorithms.h run on a \c `ThreadPool` and are compared to their serial
+ * versions. Build it with \c `-fsanitize=thread` to check the memory orders.
+ *
+ * Every stage prints its throughput, in millions of operations per second.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+#include "../generic/RingBuffer.h"
+#include "../generic/ConcurrentStrictArray.h"
+#include "../int/RingBuffer.h"
+#include "../int/algorithms.h"
+#include "test_util.h"
+
+#define STRESS_BATCH 64
+#define STRESS_THREADS 4
+
+typedef struct {
+  RingBuffer *generic;
+  RingBuffer_int *ints;
+  size_t count;
+  uint64_t seed;
+} RingStress;
+
+static void report(const char *stage, size_t ops, long long begin) {
+  double seconds = (double)(now_ns() - begin) / 1e9;
+  printf("%-32s %10zu ops %8.2f Mops/s\n", stage, ops, seconds > 0 ? (double)ops / seconds / 1e6 : 0.0);
+}
+
+static void *produce_RingBuffer(void *arg) {
+  RingStress *stress = (RingStress*)arg;
+  uint64_t rng = stress->seed;
+  size_t values[STRESS_BATCH];
+  for (size_t next = 0; next < stress->count;) {
+    size_t batch = 1 + random_below(&rng, STRESS_BATCH);
+    if (batch > stress->count - next) batch = stress->count - next;
+    for (size_t i = 0; i < batch; i++) values[i] = next + i;
+    size_t pushed = batch == 1 ? (try_push_RingBuffer(stress->generic, values) == NO_ERROR)
+                               : try_push_n_RingBuffer(stress->generic, values, batch);
+    if (!pushed) sched_yield();
+    next += pushed;
+  }
+  return NULL;
+}
+
+static void *produce_RingBuffer_int(void *arg) {
+  RingStress *stress = (RingStress*)arg;
+  uint64_t rng = stress->seed;
+  int values[STRESS_BATCH];
+  for (size_t next = 0; next < stress->count;) {
+    size_t batch = 1 + random_below(&rng, STRESS_BATCH);
+    if (batch > stress->count - next) batch = stress->count - next;
+    for (size_t i = 0; i < batch; i++) values[i] = (int)(next + i);
+    size_t pushed = batch == 1 ? (try_push_RingBuffer_int(stress->ints, values[0]) == NO_ERROR)
+                               : try_push_n_RingBuffer_int(stress->ints, values, batch);
+    if (!pushed) sched_yield();
+    next += pushed;
+  }
+  return NULL;
+}
+
+static void stress_RingBuffer(size_t count, uint64_t *rng) {
+  RingStress stress = { .count = count, .seed = next_random(rng) };
+  CHECK(get_data(new_RingBuffer(1 + random_below(rng, 200), sizeof(size_t)), (void**)&stress.generic) == NULL);
+  if (!stress.generic) return;
+
+  long long begin = now_ns();
+  pthread_t producer;
+  CHECK(pthread_create(&producer, NULL, produce_RingBuffer, &stress) == 0);
+  size_t values[STRESS_BATCH], expected = 0, failures = 0;
+  while (expected < count) {
+    size_t batch = 1 + random_below(rng, STRESS_BATCH);
+    size_t popped = batch == 1 ? (try_pop_RingBuffer(stress.generic, values) == NO_ERROR)
+                               : try_pop_n_RingBuffer(stress.generic, values, batch);
+    if (!popped) sched_yield();
+    for (size_t i = 0; i < popped; i++) failures += values[i] != expected++;
+  }
+  pthread_join(producer, NULL);
+  report("RingBuffer spsc", count, begin);
+  CHECK(failures == 0);
+  CHECK(size_RingBuffer(stress.generic) == 0);
+  CHECK(try_pop_RingBuffer(stress.generic, values) == EMPTY_CONTAINER);
+  free_RingBuffer(&stress.generic);
+}
+
+static void stress_RingBuffer_int(size_t count, uint64_t *rng) {
+  RingStress stress = { .count = count, .seed = next_random(rng) };
+  CHECK(get_data(new_RingBuffer_int(1 + random_below(rng, 200)), (void**)&stress.ints) == NULL);
+  if (!stress.ints) return;
+
+  long long begin = now_ns();
+  pthread_t producer;
+  CHECK(pthread_create(&producer, NULL, produce_RingBuffer_int, &stress) == 0);
+  int values[STRESS_BATCH];
+  size_t expected = 0, failures = 0;
+  while (expected < count) {
+    size_t batch = 1 + random_below(rng, STRESS_BATCH);
+    size_t popped = batch == 1 ? (try_pop_RingBuffer_int(stress.ints, values) == NO_ERROR)
+                               : try_pop_n_RingBuffer_int(stress.ints, values, batch);
+    if (!popped) sched_yield();
+    for (size_t i = 0; i < popped; i++) failures += values[i] != (int)expected++;
+  }
+  pthread_join(producer, NULL);
+  report("RingBuffer_int spsc", count, begin);
+  CHECK(failures == 0);
+  CHECK(size_RingBuffer_int(stress.ints) == 0);
+  free_RingBuffer_int(&stress.ints);
+}
+
+typedef struct {
+  ConcurrentStrictArray *arr;
+  size_t thread;
+  size_t count;
+  size_t stored;
+  size_t rejected;
+  uint64_t seed;
+} AppendStress;
+
+/**
+ * @brief the values of a thread are \i `thread` + k * \c `STRESS_THREADS`
+ */
+static void *append_ConcurrentStrictArray(void *arg) {
+  AppendStress *stress = (AppendStress*)arg;
+  uint64_t rng = stress->seed;
+  size_t values[STRESS_BATCH];
+  for (size_t next = 0; next < stress->count;) {
+    size_t batch = 1 + random_below(&rng, STRESS_BATCH);
+    if (batch > stress->count - next) batch = stress->count - next;
+    for (size_t i = 0; i < batch; i++) values[i] = stress->thread + (next + i) * STRESS_THREADS;
+    status_t status = batch == 1 ? push_back_ConcurrentStrictArray(stress->arr, values)
+                                 : append_range_ConcurrentStrictArray(stress->arr, values, batch);
+    if (status == NO_ERROR) stress->stored += batch;
+    else if (status == NO_SPACE) stress->rejected++;
+    else CHECK(status == NO_ERROR);
+    next += batch;
+  }
+  return NULL;
+}
+
+static void stress_ConcurrentStrictArray(size_t count, uint64_t *rng) {
+  // a little less than what the threads insert, so some insertions are rejected
+  size_t cap = STRESS_THREADS * count - 1 - random_below(rng, count);
+  ConcurrentStrictArray *arr = NULL;
+  CHECK(get_data(new_ConcurrentStrictArray(NULL, 0, cap, sizeof(size_t)), (void**)&arr) == NULL);
+  if (!arr) return;
+
+  AppendStress stress[STRESS_THREADS];
+  pthread_t threads[STRESS_THREADS];
+  long long begin = now_ns();
+  for (size_t t = 0; t < STRESS_THREADS; t++) {
+    stress[t] = (AppendStress) { .arr = arr, .thread = t, .count = count, .seed = next_random(rng) };
+    CHECK(pthread_create(&threads[t], NULL, append_ConcurrentStrictArray, &stress[t]) == 0);
+  }
+  size_t stored = 0, rejected = 0;
+  for (size_t t = 0; t < STRESS_THREADS; t++) {
+    pthread_join(threads[t], NULL);
+    stored += stress[t].stored, rejected += stress[t].rejected;
+  }
+  report("ConcurrentStrictArray append", STRESS_THREADS * count, begin);
+
+  size_t size = size_ConcurrentStrictArray(arr);
+  CHECK(size == stored && size <= cap);
+  CHECK(rejected > 0);
+  unsigned char *seen = (unsigned char*)calloc(STRESS_THREADS * count, 1);
+  if (seen) {
+    size_t duplicates = 0, ordered = 1, last[STRESS_THREADS];
+    memset(last, 0xff, sizeof(last));
+    for (size_t i = 0; i < size; i++) {
+      size_t value = *(size_t*)get_item_ConcurrentStrictArray(arr, i);
+      if (value >= STRESS_THREADS * count || seen[value]++) duplicates++;
+      // the values of one thread keep the order of its insertions
+      else if (last[value % STRESS_THREADS] != SIZE_MAX && last[value % STRESS_THREADS] > value) ordered = 0;
+      else last[value % STRESS_THREADS] = value;
+    }
+    CHECK(duplicates == 0);
+    CHECK(ordered);
+    free(seen);
+  }
+  CHECK(get_item_ConcurrentStrictArray(arr, size) == NULL);
+  free_ConcurrentStrictArray(&arr);
+}
+
+static int scale_int(int value, void *ctx) {
+  return value * *(int*)ctx + 1;
+}
+
+static int add_int(int acc, int value, void *ctx) {
+  (void)ctx;
+  return (int)((unsigned)acc + (unsigned)value);
+}
+
+static void stress_parallel_algorithms(size_t count, uint64_t *rng) {
+  ThreadPool *pool = NULL;
+  CHECK(get_data(new_ThreadPool(STRESS_THREADS), (void**)&pool) == NULL);
+  StrictArray_int *arr = NULL, *copy = NULL;
+  CHECK(get_data(new_StrictArray_int(NULL, 0, count), (void**)&arr) == NULL);
+  CHECK(get_data(new_StrictArray_int(NULL, 0, count), (void**)&copy) == NULL);
+  if (!pool || !arr || !copy) goto cleanup;
+  for (size_t i = 0; i < count; i++) {
+    int value = (int)(next_random(rng) & 0xffff) - 0x8000;
+    push_back_StrictArray_int(arr, value);
+    push_back_StrictArray_int(copy, value);
+  }
+
+  long long begin = now_ns();
+  int factor = 3;
+  CHECK(parallel_transform_StrictArray_int(pool, arr, scale_int, &factor) == NO_ERROR);
+  CHECK(transform_StrictArray_int(copy, scale_int, &factor) == NO_ERROR);
+  CHECK(memcmp(arr->data, copy->data, sizeof(int) * count) == 0);
+
+  int parallel = 0, serial = 0;
+  CHECK(parallel_reduce_StrictArray_int(pool, arr, &parallel, add_int, add_int, NULL) == NO_ERROR);
+  CHECK(reduce_StrictArray_int(copy, &serial, add_int, NULL) == NO_ERROR);
+  CHECK(parallel == serial);
+
+  CHECK(parallel_sort_StrictArray_int(pool, arr) == NO_ERROR);
+  CHECK(sort_StrictArray_int(copy) == NO_ERROR);
+  CHECK(memcmp(arr->data, copy->data, sizeof(int) * count) == 0);
+  for (size_t i = 1; i < count; i++) CHECK(arr->data[i - 1] <= arr->data[i]);
+  report("parallel algorithms", 3 * count, begin);
+
+cleanup:
+  free_StrictArray_int(&arr);
+  free_StrictArray_int(&copy);
+  free_ThreadPool(&pool);
+}
+
+int main(void) {
+  uint64_t rng = test_seed();
+  size_t scale = test_scale();
+  for (size_t round = 0; round < 4; round++) {
+    stress_RingBuffer(200000 * scale, &rng);
+    stress_RingBuffer_int(200000 * scale, &rng);
+    stress_ConcurrentStrictArray(50000 * scale, &rng);
+  }
+  stress_parallel_algorithms(100000 * scale, &rng);
+  return test_exit("stress_concurrency");
+}
@@ -0,0 +1,79 @@
+/**
+ * @file tests/test_util.h
+ * @brief the helpers shared by the test programs
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details Every test program is a plain \c `main` counting its failed checks:
+ * \c `CHECK` prints the file, the line and the expression of a failed check
+ * and the program exits with a non-zero status if any check failed, so CTest
+ * reports it. The random inputs come from a xorshift generator seeded from
+ * \c `C_DSA_TEST_SEED` (or a fixed seed), so a failure can be replayed, and
+ * the number of iterations is scaled by \c `C_DSA_TEST_SCALE` (1 by default).
+ *
+ * Test's APIs:
+ * @li CHECK : count and report a failed check
+ * @li test_seed : the seed of the run
+ * @li test_scale : the factor of the number of iterations
+ * @li next_random : the next number of a generator
+ * @li random_below : a random number in [0, n - 1]
+ * @li now_ns : a monotonic time in nanoseconds
+ * @li test_exit : report the failures and return the exit status
+ */
+#ifndef __C_DSA_TESTS_TEST_UTIL_H__
+#define __C_DSA_TESTS_TEST_UTIL_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static size_t test_failures;
+
+#define CHECK(expr)                                                            \
+  do {                                                                         \
+    if (!(expr)) {                                                             \
+      test_failures++;                                                         \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #expr); \
+    }                                                                          \
+  } while (0)
+
+static inline uint64_t test_seed(void) {
+  const char *env = getenv("C_DSA_TEST_SEED");
+  uint64_t seed = env ? strtoull(env, NULL, 0) : 0x2545f4914f6cdd1dull;
+  return seed ? seed : 1;
+}
+
+static inline size_t test_scale(void) {
+  const char *env = getenv("C_DSA_TEST_SCALE");
+  size_t scale = env ? (size_t)strtoull(env, NULL, 0) : 1;
+  return scale ? scale : 1;
+}
+
+static inline uint64_t next_random(uint64_t *state) {
+  uint64_t x = *state;
+  x ^= x << 13, x ^= x >> 7, x ^= x << 17;
+  return *state = x;
+}
+
+static inline size_t random_below(uint64_t *state, size_t n) {
+  return n ? (size_t)(next_random(state) % n) : 0;
+}
+
+static inline long long now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static inline int test_exit(const char *name) {
+  if (test_failures) {
+    fprintf(stderr, "%s: %zu failed checks (seed %llu)\n", name, test_failures,
+            (unsigned long long)test_seed());
+    return EXIT_FAILURE;
+  }
+  printf("%s: ok\n", name);
+  return EXIT_SUCCESS;
+}
+
+#endif // __C_DSA_TESTS_TEST_UTIL_H__
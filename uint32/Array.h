@@ -0,0 +1,36 @@
+/**
+ * @file uint32/Array.h
+ * @author andarling
+ * @date 14/10/2026
+ * @brief a library for Array for 32-bit unsigned integers
+ * 
+ * @details this library only make a \c `struct` for normal array in C, as it 
+ * contains an additional attribute \i `capacity` to denote the maximum elements
+ * the container can hold
+ * 
+ * The structure and APIs are generated by \c `DEFINE_ARRAY`, see
+ * generic/Array_template.h for the details of every function.
+ * 
+ * API:
+ * @li new_T ~ create
+ * @li new_T_with_allocator ~ create with an \c `Allocator`
+ * @li create_T, create_T_with_allocator ~ create through an out-parameter
+ * @li init_T ~ create in a caller-provided buffer
+ * @li T_bytes_required ~ size of the buffer for \c `init_T`
+ * @li new_T_aligned, create_T_aligned ~ create with aligned elements
+ * @li alignment_T ~ alignment of the elements
+ * @li from_T ~ copy
+ * @li create_from_T ~ copy through an out-parameter
+ * @li free_T ~ free()
+ * @li get_item_T ~ a[]
+ */
+#ifndef __C_DSA_UINT32_ARRAY__
+#define __C_DSA_UINT32_ARRAY__
+
+#include <stdint.h>
+
+#include "../generic/Array_template.h"
+
+DEFINE_ARRAY(uint32_t, uint32)
+
+#endif // __C_DSA_UINT32_ARRAY__
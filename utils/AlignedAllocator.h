@@ -0,0 +1,162 @@
+/**
+ * @file AlignedAllocator.h
+ * @brief heap allocators aligning the elements following a header
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details The arrays keep their elements in a flexible member right after
+ * their header, so on the heap the elements are only aligned as the header
+ * (8 bytes). An \c `AlignedAllocator` pads the block it takes from the heap so
+ * that the address \i `header_bytes` after the returned pointer is aligned to
+ * \i `alignment`: once the array header is written there, its elements start on
+ * an \i `alignment` boundary, e.g. a cache line or an AVX-512 register width.
+ * The offset from the heap block to the returned pointer is stored in the
+ * \c `size_t` right before it, so \i `free` and \i `realloc` need no context.
+ * The alignments are the powers of two from \c `C_DSA_MIN_ALIGNMENT` to
+ * \c `C_DSA_MAX_ALIGNMENT`.
+ *
+ * \c `DEFINE_ALIGNED_ALLOCATORS(name, header_bytes)` emits one static
+ * allocator per alignment for a given header and
+ * \c `const Allocator *name_aligned_allocator(size_t alignment)` to look one up,
+ * the array headers use it to implement their \c `new_T_aligned` constructors.
+ * A clone made through \c `from_T` keeps the allocator and so the alignment.
+ *
+ * AlignedAllocator's APIs:
+ * @li aligned_heap_alloc, aligned_heap_realloc, aligned_heap_free : the
+ * functions of every \c `AlignedAllocator`
+ * @li is_valid_alignment : whether an alignment is supported
+ * @li alignment_of : the alignment of an address
+ * @li DEFINE_ALIGNED_ALLOCATORS : the allocators for a header size
+ */
+#ifndef __C_DSA_UTILS_ALIGNED_ALLOCATOR__
+#define __C_DSA_UTILS_ALIGNED_ALLOCATOR__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+#include "Allocator.h"
+
+#define C_DSA_MIN_ALIGNMENT_SHIFT 4
+#define C_DSA_MAX_ALIGNMENT_SHIFT 12
+#define C_DSA_MIN_ALIGNMENT ((size_t)1 << C_DSA_MIN_ALIGNMENT_SHIFT)
+#define C_DSA_MAX_ALIGNMENT ((size_t)1 << C_DSA_MAX_ALIGNMENT_SHIFT)
+#define C_DSA_ALIGNMENT_COUNT (C_DSA_MAX_ALIGNMENT_SHIFT - C_DSA_MIN_ALIGNMENT_SHIFT + 1)
+
+typedef struct AlignedAllocator AlignedAllocator;
+
+/**
+ * @struct AlignedAllocator
+ * @author andarling
+ * @date 14/10/2026
+ * @brief an \c `Allocator` whose context is the \c `AlignedAllocator` itself
+ *
+ * \i `header_bytes` is a multiple of \c `sizeof(size_t)`, so the offset stored
+ * before the returned pointer is aligned.
+ */
+struct AlignedAllocator {
+  Allocator allocator;
+  size_t alignment, header_bytes;
+};
+
+C_DSA_API void *aligned_heap_alloc(void *ctx, size_t bytes) {
+  const AlignedAllocator *aligned = (const AlignedAllocator*)ctx;
+  size_t padding = aligned->alignment + sizeof(size_t);
+  if (bytes > SIZE_MAX - padding) return NULL;
+  char *raw = (char*)malloc(bytes + padding);
+  if (!raw) return NULL;
+
+  uintptr_t data = (uintptr_t)(raw + sizeof(size_t) + aligned->header_bytes);
+  data = (data + aligned->alignment - 1) & ~(uintptr_t)(aligned->alignment - 1);
+  char *ptr = (char*)data - aligned->header_bytes;
+  ((size_t*)ptr)[-1] = (size_t)(ptr - raw);
+  return ptr;
+}
+
+C_DSA_API void aligned_heap_free(void *ctx, void *ptr, size_t bytes) {
+  (void)ctx, (void)bytes;
+  if (!ptr) return;
+  free((char*)ptr - ((size_t*)ptr)[-1]);
+}
+
+/**
+ * @brief moves the block, as the padding of the new one differs from the old one
+ */
+C_DSA_API void *aligned_heap_realloc(void *ctx, void *ptr, size_t old_bytes, size_t new_bytes) {
+  void *grown = aligned_heap_alloc(ctx, new_bytes);
+  if (!grown) return NULL;
+  if (ptr) {
+    memcpy(grown, ptr, old_bytes < new_bytes ? old_bytes : new_bytes);
+    aligned_heap_free(ctx, ptr, old_bytes);
+  }
+  return grown;
+}
+
+/**
+ * @fn int is_valid_alignment(size_t alignment)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief whether \i `alignment` is a power of two in
+ * [\c `C_DSA_MIN_ALIGNMENT`, \c `C_DSA_MAX_ALIGNMENT`]
+ */
+C_DSA_API int is_valid_alignment(size_t alignment) {
+  return alignment >= C_DSA_MIN_ALIGNMENT && alignment <= C_DSA_MAX_ALIGNMENT
+      && !(alignment & (alignment - 1));
+}
+
+/**
+ * @fn size_t alignment_of(const void *ptr)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the greatest power of two dividing the address \i `ptr`, at most
+ * \c `C_DSA_MAX_ALIGNMENT` (which is also returned for a null pointer)
+ */
+C_DSA_API size_t alignment_of(const void *ptr) {
+  uintptr_t address = (uintptr_t)ptr | C_DSA_MAX_ALIGNMENT;
+  return (size_t)(address & -address);
+}
+
+/**
+ * @brief the index of \i `alignment` in the tables of aligned allocators, which
+ * must be a valid alignment
+ */
+C_DSA_API size_t index_alignment(size_t alignment) {
+  size_t index = 0;
+  while ((C_DSA_MIN_ALIGNMENT << index) < alignment) index++;
+  return index;
+}
+
+#define C_DSA_ALIGNED_ALLOCATOR(table, index, header_bytes)                    \
+  { { aligned_heap_alloc, aligned_heap_realloc, aligned_heap_free,             \
+      (void*)&table[index] }, C_DSA_MIN_ALIGNMENT << (index), (header_bytes) }
+
+/**
+ * @def DEFINE_ALIGNED_ALLOCATORS(name, header_bytes)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief emits the table \c `name_aligned_allocators` and
+ * \c `const Allocator *name_aligned_allocator(size_t alignment)`, which returns
+ * the allocator aligning the address \i `header_bytes` after its blocks to
+ * \i `alignment`, or a null pointer if \i `alignment` is not valid
+ */
+#define DEFINE_ALIGNED_ALLOCATORS(name, header_bytes)                          \
+  static const AlignedAllocator name##_aligned_allocators[C_DSA_ALIGNMENT_COUNT] = { \
+    C_DSA_ALIGNED_ALLOCATOR(name##_aligned_allocators, 0, header_bytes),       \
+    C_DSA_ALIGNED_ALLOCATOR(name##_aligned_allocators, 1, header_bytes),       \
+    C_DSA_ALIGNED_ALLOCATOR(name##_aligned_allocators, 2, header_bytes),       \
+    C_DSA_ALIGNED_ALLOCATOR(name##_aligned_allocators, 3, header_bytes),       \
+    C_DSA_ALIGNED_ALLOCATOR(name##_aligned_allocators, 4, header_bytes),       \
+    C_DSA_ALIGNED_ALLOCATOR(name##_aligned_allocators, 5, header_bytes),       \
+    C_DSA_ALIGNED_ALLOCATOR(name##_aligned_allocators, 6, header_bytes),       \
+    C_DSA_ALIGNED_ALLOCATOR(name##_aligned_allocators, 7, header_bytes),       \
+    C_DSA_ALIGNED_ALLOCATOR(name##_aligned_allocators, 8, header_bytes)        \
+  };                                                                           \
+                                                                               \
+  C_DSA_API const Allocator *name##_aligned_allocator(size_t alignment) {      \
+    if (!is_valid_alignment(alignment)) return NULL;                           \
+    return &name##_aligned_allocators[index_alignment(alignment)].allocator;   \
+  }
+
+#endif // __C_DSA_UTILS_ALIGNED_ALLOCATOR__
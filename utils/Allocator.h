@@ -0,0 +1,68 @@
+/**
+ * @file Allocator.h
+ * @brief an allocator interface for every data structure
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details An \c `Allocator` is a set of functions plus a context pointer that
+ * every \c `new_T_with_allocator` constructor accepts and that is kept inside
+ * the data structure, so \c `free_T` and the growing functions release and
+ * resize the memory with the same allocator.
+ * The \c `heap_allocator` is the default one and uses \c `malloc`, \c `realloc`
+ * and \c `free`.
+ * See utils/Arena.h and utils/Pool.h for the other shipped allocators.
+ */
+#ifndef __C_DSA_UTILS_ALLOCATOR__
+#define __C_DSA_UTILS_ALLOCATOR__
+
+#include <stdlib.h>
+
+#include "config.h"
+
+typedef struct Allocator Allocator;
+
+/**
+ * @struct Allocator
+ * @author andarling
+ * @date 14/10/2026
+ * @brief a set of allocation functions sharing the context \i `ctx`
+ *
+ * Every function receives \i `ctx` as its first argument, \i `realloc` and
+ * \i `free` also receive the size of the block (as it was requested), so
+ * size-class allocators do not have to store it.
+ * \i `alloc` and \i `realloc` return a null pointer on failure, in which case
+ * a block given to \i `realloc` is left untouched.
+ */
+struct Allocator {
+  void *(*alloc)(void *ctx, size_t bytes);
+  void *(*realloc)(void *ctx, void *ptr, size_t old_bytes, size_t new_bytes);
+  void (*free)(void *ctx, void *ptr, size_t bytes);
+  void *ctx;
+};
+
+C_DSA_API void *heap_alloc(void *ctx, size_t bytes) {
+  (void)ctx;
+  return malloc(bytes);
+}
+
+C_DSA_API void *heap_realloc(void *ctx, void *ptr, size_t old_bytes, size_t new_bytes) {
+  (void)ctx, (void)old_bytes;
+  return realloc(ptr, new_bytes);
+}
+
+C_DSA_API void heap_free(void *ctx, void *ptr, size_t bytes) {
+  (void)ctx, (void)bytes;
+  free(ptr);
+}
+
+/**
+ * @brief the default allocator, backed by the C heap
+ */
+static const Allocator heap_allocator = {
+  .alloc = heap_alloc,
+  .realloc = heap_realloc,
+  .free = heap_free,
+  .ctx = NULL
+};
+
+#endif // __C_DSA_UTILS_ALLOCATOR__
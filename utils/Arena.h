@@ -0,0 +1,268 @@
+/**
+ * @file Arena.h
+ * @brief a bump-pointer arena allocator
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details An \c `Arena` hands out memory by bumping an offset inside big blocks
+ * taken from the heap, freeing a single allocation does nothing and all the
+ * allocations are released at once by \c `reset_Arena` in O(1), the blocks are
+ * kept and reused by the next allocations.
+ * Data structures created with the arena's allocator (\c `allocator_Arena`) do
+ * not need to be freed one by one, but they must not be used after a reset.
+ * An \c `Arena` is not thread safe.
+ *
+ * Arena's APIs:
+ * @li new_T : dynamically create type T on the heap
+ * @li free_T : deallocate type T and all of its blocks
+ * @li alloc_T : allocate a block of memory from T
+ * @li realloc_T : resize a block of memory of T, in place if it is the last one
+ * @li reset_T : release every allocation of T at once
+ * @li allocator_T : the \c `Allocator` backed by T
+ */
+#ifndef __C_DSA_UTILS_ARENA__
+#define __C_DSA_UTILS_ARENA__
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+#include "status.h"
+#include "Result.h"
+#include "Allocator.h"
+
+/**
+ * @brief the alignment of every allocation made by an arena
+ */
+#define C_DSA_ARENA_ALIGNMENT (sizeof(max_align_t))
+
+typedef struct ArenaBlock ArenaBlock;
+typedef struct Arena Arena;
+
+/**
+ * @struct ArenaBlock
+ * @author andarling
+ * @date 14/10/2026
+ * @brief a block of an arena, \i `used` bytes of \i `data` are handed out
+ */
+struct ArenaBlock {
+  ArenaBlock *next;
+  size_t capacity, used;
+  _Alignas(max_align_t) char data[];
+};
+
+/**
+ * @struct Arena
+ * @author andarling
+ * @date 14/10/2026
+ * @brief a list of blocks from which the memory is bumped
+ *
+ * \i `current` is the block allocations are made from, the blocks before it are
+ * full and the blocks after it are free (kept from before the last reset).
+ * \i `last` is the last allocation, the only one which can be resized in place.
+ */
+struct Arena {
+  ArenaBlock *head, *current;
+  size_t block_size;
+  void *last;
+  Allocator allocator;
+};
+
+C_DSA_API void *alloc_Arena(Arena *arena, size_t bytes);
+C_DSA_API void *realloc_Arena(Arena *arena, void *ptr, size_t old_bytes, size_t new_bytes);
+
+C_DSA_API void *arena_alloc(void *ctx, size_t bytes) {
+  return alloc_Arena((Arena*)ctx, bytes);
+}
+
+C_DSA_API void *arena_realloc(void *ctx, void *ptr, size_t old_bytes, size_t new_bytes) {
+  return realloc_Arena((Arena*)ctx, ptr, old_bytes, new_bytes);
+}
+
+C_DSA_API void arena_free(void *ctx, void *ptr, size_t bytes) {
+  (void)ctx, (void)ptr, (void)bytes;
+}
+
+/**
+ * @fn Result new_Arena(size_t block_size)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to a new arena
+ *
+ * @param[in] block_size the size in bytes of every block taken from the heap,
+ * bigger allocations get a block of their own
+ * (block_size > 0)
+ *
+ * @return a \c `Result` type to the successfully allocated arena or a error message
+ */
+C_DSA_API Result new_Arena(size_t block_size) {
+  if (block_size <= 0) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: Block cannot have less than 1 byte\n"
+    };
+  }
+
+  Arena *result = (Arena*)malloc(sizeof(Arena));
+  ArenaBlock *head = (ArenaBlock*)malloc(sizeof(ArenaBlock) + block_size);
+  if (!result || !head) {
+    free(result);
+    free(head);
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+  head->next = NULL, head->capacity = block_size, head->used = 0;
+  result->head = result->current = head;
+  result->block_size = block_size;
+  result->last = NULL;
+  result->allocator = (Allocator) {
+    .alloc = arena_alloc,
+    .realloc = arena_realloc,
+    .free = arena_free,
+    .ctx = result
+  };
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn void free_Arena(Arena **arena)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief deallocate every block of the arena and set the pointer to NULL
+ *
+ * @param[in] arena a pointer to the address of the arena
+ * (if arena is a null pointer then exits the function)
+ *
+ * @return void
+ */
+C_DSA_API void free_Arena(Arena **arena) {
+  if (!arena || !*arena) return;
+  ArenaBlock *block = (*arena)->head;
+  while (block) {
+    ArenaBlock *next = block->next;
+    free(block);
+    block = next;
+  }
+  free(*arena);
+  *arena = NULL;
+}
+
+/**
+ * @fn void *alloc_Arena(Arena *arena, size_t bytes)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief allocate \i `bytes` bytes aligned to \c `C_DSA_ARENA_ALIGNMENT`
+ *
+ * @param[in] arena a pointer to \c `Arena` type
+ * @param[in] bytes the number of bytes to allocate
+ *
+ * @return a pointer to the allocated memory or a null pointer on failure
+ */
+C_DSA_API void *alloc_Arena(Arena *arena, size_t bytes) {
+  if (!arena) return NULL;
+  size_t rounded = (bytes + C_DSA_ARENA_ALIGNMENT - 1) & ~(C_DSA_ARENA_ALIGNMENT - 1);
+  if (rounded < bytes) return NULL;
+
+  ArenaBlock *block = arena->current;
+  while (block->capacity - block->used < rounded) {
+    ArenaBlock *next = block->next;
+    if (next && next->capacity >= rounded) {
+      next->used = 0;
+    }
+    else {
+      // keeps the free blocks after the new one
+      size_t capacity = rounded > arena->block_size ? rounded : arena->block_size;
+      ArenaBlock *fresh = (ArenaBlock*)malloc(sizeof(ArenaBlock) + capacity);
+      if (!fresh) return NULL;
+      fresh->next = next, fresh->capacity = capacity, fresh->used = 0;
+      block->next = fresh;
+      next = fresh;
+    }
+    block = next;
+  }
+  arena->current = block;
+
+  void *result = block->data + block->used;
+  block->used += rounded;
+  arena->last = result;
+  return result;
+}
+
+/**
+ * @fn void *realloc_Arena(Arena *arena, void *ptr, size_t old_bytes, size_t new_bytes)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief resize an allocation of the arena
+ *
+ * If \i `ptr` is the last allocation and the block has enough space, it is
+ * resized in place, else a new allocation is made and the data is copied.
+ *
+ * @param[in] arena a pointer to \c `Arena` type
+ * @param[in] ptr the allocation to resize (if null, it acts as \c `alloc_Arena`)
+ * @param[in] old_bytes the size of the allocation
+ * @param[in] new_bytes the new size of the allocation
+ *
+ * @return a pointer to the resized memory or a null pointer on failure
+ */
+C_DSA_API void *realloc_Arena(Arena *arena, void *ptr, size_t old_bytes, size_t new_bytes) {
+  if (!arena) return NULL;
+  if (!ptr) return alloc_Arena(arena, new_bytes);
+
+  if (ptr == arena->last) {
+    ArenaBlock *block = arena->current;
+    size_t offset = (size_t)((char*)ptr - block->data);
+    size_t rounded = (new_bytes + C_DSA_ARENA_ALIGNMENT - 1) & ~(C_DSA_ARENA_ALIGNMENT - 1);
+    if (rounded >= new_bytes && rounded <= block->capacity - offset) {
+      block->used = offset + rounded;
+      return ptr;
+    }
+  }
+
+  void *result = alloc_Arena(arena, new_bytes);
+  if (!result) return NULL;
+  memcpy(result, ptr, old_bytes < new_bytes ? old_bytes : new_bytes);
+  return result;
+}
+
+/**
+ * @fn void reset_Arena(Arena *arena)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief release every allocation of the arena in O(1)
+ *
+ * The blocks are kept for the next allocations.
+ *
+ * @param[in] arena a pointer to \c `Arena` type
+ * (if arena is a null pointer then exits the function)
+ *
+ * @return void
+ */
+C_DSA_API void reset_Arena(Arena *arena) {
+  if (!arena) return;
+  arena->current = arena->head;
+  arena->head->used = 0;
+  arena->last = NULL;
+}
+
+/**
+ * @fn const Allocator *allocator_Arena(Arena *arena)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the \c `Allocator` allocating from \i `arena`
+ *
+ * @param[in] arena a pointer to \c `Arena` type
+ *
+ * @return a pointer to the allocator, valid as long as \i `arena`
+ */
+C_DSA_API const Allocator *allocator_Arena(Arena *arena) {
+  if (!arena) return NULL;
+  return &arena->allocator;
+}
+
+#endif // __C_DSA_UTILS_ARENA__
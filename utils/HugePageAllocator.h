@@ -0,0 +1,326 @@
+/**
+ * @file HugePageAllocator.h
+ * @brief an allocator of huge pages, optionally bound to NUMA nodes
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details A \c `HugePageAllocator` maps every block with \c `mmap` instead of
+ * taking it from the heap, so arrays of many gigabytes can be backed by huge
+ * pages (fewer TLB misses when scanning them) and placed on chosen NUMA nodes.
+ * Give \c `allocator_HugePageAllocator` to \c `new_StrictArray_with_allocator`,
+ * \c `new_Array_with_allocator` or any other \c `new_T_with_allocator`.
+ * @li \c `C_DSA_PAGES_TRANSPARENT` maps blocks aligned to
+ * \c `C_DSA_HUGE_PAGE_SIZE` and asks for transparent huge pages with
+ * \c `madvise(MADV_HUGEPAGE)`
+ * @li \c `C_DSA_PAGES_EXPLICIT` maps blocks from the reserved huge pages with
+ * \c `MAP_HUGETLB`, and falls back to transparent huge pages if none is left
+ * @li \c `C_DSA_NUMA_BIND` and \c `C_DSA_NUMA_INTERLEAVE` bind the pages to, or
+ * interleave them across, the nodes of \i `node_mask` with the \c `mbind`
+ * system call (no libnuma needed); this is a hint, a failing \c `mbind`
+ * leaves the default placement
+ *
+ * Nothing is touched on allocation, a page is placed when it is first written.
+ * With \c `C_DSA_NUMA_LOCAL` it lands on the node of the writing thread, and
+ * \c `parallel_first_touch` spreads the pages over the nodes the threads of a
+ * \c `ThreadPool` run on. This is best-effort, see \c `parallel_first_touch`;
+ * \c `C_DSA_NUMA_BIND` or \c `C_DSA_NUMA_INTERLEAVE` give a placement that
+ * does not depend on the threads. Note that the constructors write the header
+ * and copy the initial elements from the calling thread.
+ * Huge pages and NUMA placement are only available on Linux (they need
+ * \c `_DEFAULT_SOURCE` defined before including any header), elsewhere the
+ * allocator falls back to the heap.
+ * A \c `HugePageAllocator` is thread safe.
+ *
+ * HugePageAllocator's APIs:
+ * @li new_T : dynamically create type T on the heap
+ * @li free_T : deallocate type T
+ * @li allocator_T : the \c `Allocator` backed by T
+ * @li parallel_first_touch : write every page of a block from the threads of a
+ * \c `ThreadPool`
+ */
+#ifndef __C_DSA_UTILS_HUGE_PAGE_ALLOCATOR__
+#define __C_DSA_UTILS_HUGE_PAGE_ALLOCATOR__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "config.h"
+#include "status.h"
+#include "Result.h"
+#include "Allocator.h"
+#include "ThreadPool.h"
+
+#ifndef C_DSA_HUGE_PAGE_SIZE
+#define C_DSA_HUGE_PAGE_SIZE ((size_t)2 << 20)
+#endif
+
+/**
+ * @brief the pages backing the blocks
+ */
+typedef enum {
+  C_DSA_PAGES_DEFAULT,
+  C_DSA_PAGES_TRANSPARENT,
+  C_DSA_PAGES_EXPLICIT
+} huge_page_t;
+
+/**
+ * @brief where the pages are placed, the values are the \c `mbind` modes
+ */
+typedef enum {
+  C_DSA_NUMA_LOCAL = 0,
+  C_DSA_NUMA_BIND = 2,
+  C_DSA_NUMA_INTERLEAVE = 3
+} numa_policy_t;
+
+typedef struct HugePageAllocator HugePageAllocator;
+
+/**
+ * @struct HugePageAllocator
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the way blocks are mapped and the \c `Allocator` mapping them
+ *
+ * \i `node_mask` has the bit n set for the node n (nodes 0 to 63).
+ */
+struct HugePageAllocator {
+  huge_page_t pages;
+  numa_policy_t numa;
+  unsigned long node_mask;
+  Allocator allocator;
+};
+
+/**
+ * @brief the number of bytes mapped for a block of \i `bytes` bytes, 0 if it
+ * overflows
+ */
+C_DSA_API size_t mapped_bytes_HugePageAllocator(const HugePageAllocator *huge, size_t bytes) {
+#ifdef __linux__
+  size_t page = huge->pages == C_DSA_PAGES_DEFAULT ? (size_t)sysconf(_SC_PAGESIZE) : C_DSA_HUGE_PAGE_SIZE;
+#else
+  size_t page = 1;
+  (void)huge;
+#endif
+  if (bytes > SIZE_MAX - page) return 0;
+  return (bytes + page - 1) / page * page;
+}
+
+#ifdef __linux__
+/**
+ * @brief map \i `bytes` bytes aligned to \c `C_DSA_HUGE_PAGE_SIZE`, by mapping
+ * one more huge page and unmapping what is around the aligned range
+ */
+C_DSA_API void *map_aligned_HugePageAllocator(size_t bytes) {
+  size_t over = bytes + C_DSA_HUGE_PAGE_SIZE;
+  char *raw = (char*)mmap(NULL, over, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (raw == (char*)MAP_FAILED) return NULL;
+  char *ptr = (char*)(((uintptr_t)raw + C_DSA_HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(C_DSA_HUGE_PAGE_SIZE - 1));
+  if (ptr != raw) munmap(raw, (size_t)(ptr - raw));
+  if (ptr + bytes != raw + over) munmap(ptr + bytes, (size_t)(raw + over - (ptr + bytes)));
+  return ptr;
+}
+#endif
+
+C_DSA_API void *huge_page_alloc(void *ctx, size_t bytes) {
+  const HugePageAllocator *huge = (const HugePageAllocator*)ctx;
+#ifdef __linux__
+  size_t mapped = mapped_bytes_HugePageAllocator(huge, bytes);
+  if (!mapped) return NULL;
+
+  void *ptr = NULL;
+#ifdef MAP_HUGETLB
+  if (huge->pages == C_DSA_PAGES_EXPLICIT) {
+    ptr = mmap(NULL, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr == MAP_FAILED) ptr = NULL;
+  }
+#endif
+  if (!ptr && huge->pages != C_DSA_PAGES_DEFAULT) {
+    ptr = map_aligned_HugePageAllocator(mapped);
+#ifdef MADV_HUGEPAGE
+    if (ptr) madvise(ptr, mapped, MADV_HUGEPAGE);
+#endif
+  }
+  else if (!ptr) {
+    ptr = mmap(NULL, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) ptr = NULL;
+  }
+
+#ifdef SYS_mbind
+  if (ptr && huge->numa != C_DSA_NUMA_LOCAL) {
+    unsigned long mask = huge->node_mask;
+    syscall(SYS_mbind, ptr, mapped, (int)huge->numa, &mask, sizeof(mask) * 8 + 1, 0u);
+  }
+#endif
+  return ptr;
+#else
+  (void)huge;
+  return malloc(bytes);
+#endif
+}
+
+C_DSA_API void huge_page_free(void *ctx, void *ptr, size_t bytes) {
+  if (!ptr) return;
+#ifdef __linux__
+  munmap(ptr, mapped_bytes_HugePageAllocator((const HugePageAllocator*)ctx, bytes));
+#else
+  (void)ctx, (void)bytes;
+  free(ptr);
+#endif
+}
+
+/**
+ * @brief maps a new block when the mapped size changes, the pages of the old
+ * one are copied and unmapped
+ */
+C_DSA_API void *huge_page_realloc(void *ctx, void *ptr, size_t old_bytes, size_t new_bytes) {
+  const HugePageAllocator *huge = (const HugePageAllocator*)ctx;
+  if (ptr && mapped_bytes_HugePageAllocator(huge, old_bytes) == mapped_bytes_HugePageAllocator(huge, new_bytes)) {
+    return ptr;
+  }
+  void *grown = huge_page_alloc(ctx, new_bytes);
+  if (!grown) return NULL;
+  if (ptr) {
+    memcpy(grown, ptr, old_bytes < new_bytes ? old_bytes : new_bytes);
+    huge_page_free(ctx, ptr, old_bytes);
+  }
+  return grown;
+}
+
+/**
+ * @fn Result new_HugePageAllocator(huge_page_t pages, numa_policy_t numa, unsigned long node_mask)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to a new allocator mapping its blocks
+ *
+ * @param[in] pages the pages backing the blocks
+ * @param[in] numa where the pages are placed
+ * @param[in] node_mask the nodes used by \c `C_DSA_NUMA_BIND` and
+ * \c `C_DSA_NUMA_INTERLEAVE`
+ * (node_mask is not 0 unless numa is \c `C_DSA_NUMA_LOCAL`)
+ *
+ * @return a \c `Result` type to the successfully allocated allocator or a error message
+ */
+C_DSA_API Result new_HugePageAllocator(huge_page_t pages, numa_policy_t numa, unsigned long node_mask) {
+  if (numa != C_DSA_NUMA_LOCAL && !node_mask) {
+    return (Result) {
+      .ok = INVALID_SIZE,
+      .error_msg = "SizeError: NUMA policy needs at least one node\n"
+    };
+  }
+  HugePageAllocator *result = (HugePageAllocator*)malloc(sizeof(HugePageAllocator));
+  if (!result) {
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+  result->pages = pages, result->numa = numa, result->node_mask = node_mask;
+  result->allocator = (Allocator) {
+    .alloc = huge_page_alloc,
+    .realloc = huge_page_realloc,
+    .free = huge_page_free,
+    .ctx = result
+  };
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn void free_HugePageAllocator(HugePageAllocator **huge)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief deallocate the allocator and set the pointer to NULL
+ *
+ * The blocks it mapped must be released before.
+ *
+ * @param[in] huge a pointer to the address of the allocator
+ * (if huge is a null pointer then exits the function)
+ *
+ * @return void
+ */
+C_DSA_API void free_HugePageAllocator(HugePageAllocator **huge) {
+  if (!huge || !*huge) return;
+  free(*huge);
+  *huge = NULL;
+}
+
+/**
+ * @fn const Allocator *allocator_HugePageAllocator(HugePageAllocator *huge)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the \c `Allocator` mapping blocks as \i `huge` says
+ *
+ * @param[in] huge a pointer to \c `HugePageAllocator` type
+ *
+ * @return a pointer to the allocator, valid as long as \i `huge`
+ */
+C_DSA_API const Allocator *allocator_HugePageAllocator(HugePageAllocator *huge) {
+  if (!huge) return NULL;
+  return &huge->allocator;
+}
+
+typedef struct {
+  volatile char *data;
+  size_t bytes, page, chunks;
+} FirstTouchJob;
+
+C_DSA_API void first_touch_task(void *ctx, size_t index) {
+  FirstTouchJob *job = (FirstTouchJob*)ctx;
+  size_t pages = (job->bytes + job->page - 1) / job->page;
+  size_t begin = chunk_begin_ThreadPool(pages, job->chunks, index);
+  size_t end = chunk_begin_ThreadPool(pages, job->chunks, index + 1);
+  for (size_t i = begin; i < end; i++) job->data[i * job->page] = job->data[i * job->page];
+  // data may not start on a page, then its last page starts after the last step
+  if (index + 1 == job->chunks) job->data[job->bytes - 1] = job->data[job->bytes - 1];
+}
+
+/**
+ * @fn status_t parallel_first_touch(ThreadPool *pool, void *data, size_t bytes)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write every page of \i `data` once, splitting them evenly on the
+ * threads of \i `pool`
+ *
+ * Every byte keeps its value, so it can be called on an array already holding
+ * elements, e.g. \c `parallel_first_touch(pool, arr->data, type_size * capacity)`.
+ * Pages already placed do not move.
+ * The placement is best-effort: the chunks of pages are claimed by whichever
+ * thread of \i `pool` is free and the threads are not pinned to a core, so
+ * the thread touching a chunk, and the node getting its pages, is not
+ * necessarily the one a later \c `run_ThreadPool` gives the same chunk to.
+ * The pages are spread over the nodes of the threads rather than matched to
+ * them.
+ *
+ * @param[in] pool the threads touching the pages
+ * (if pool is a null pointer then the calling thread touches them)
+ * @param[in] data the first byte to touch
+ * (data is not a null pointer unless bytes is 0)
+ * @param[in] bytes the number of bytes to touch
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t parallel_first_touch(ThreadPool *pool, void *data, size_t bytes) {
+  if (!data) return bytes ? SEGFAULT : NO_ERROR;
+  if (!bytes) return NO_ERROR;
+#ifdef __linux__
+  size_t page = (size_t)sysconf(_SC_PAGESIZE);
+#else
+  size_t page = 4096;
+#endif
+  size_t pages = (bytes + page - 1) / page;
+  size_t chunks = thread_count_ThreadPool(pool) * 4;
+  if (chunks > pages) chunks = pages;
+  FirstTouchJob job = { .data = (volatile char*)data, .bytes = bytes, .page = page, .chunks = chunks };
+  return run_ThreadPool(pool, chunks, first_touch_task, &job);
+}
+
+#endif // __C_DSA_UTILS_HUGE_PAGE_ALLOCATOR__
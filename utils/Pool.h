@@ -0,0 +1,262 @@
+/**
+ * @file Pool.h
+ * @brief a fixed size-class pool allocator
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details A \c `Pool` keeps a free list for each size class (powers of two from
+ * \c `C_DSA_POOL_MIN_CLASS` to \c `C_DSA_POOL_MAX_CLASS` bytes), allocations are
+ * rounded up to their class and are served from the free list, which is refilled
+ * by carving slabs of \c `C_DSA_POOL_SLAB_SIZE` bytes taken from the heap.
+ * Freed blocks go back to their free list instead of the heap, so creating and
+ * freeing many small data structures costs a few pointer operations.
+ * Allocations bigger than the biggest class go straight to the heap.
+ * A \c `Pool` is not thread safe.
+ *
+ * Pool's APIs:
+ * @li new_T : dynamically create type T on the heap
+ * @li free_T : deallocate type T and all of its slabs
+ * @li alloc_T : allocate a block of memory from T
+ * @li realloc_T : resize a block of memory of T
+ * @li release_T : give a block of memory back to T
+ * @li allocator_T : the \c `Allocator` backed by T
+ */
+#ifndef __C_DSA_UTILS_POOL__
+#define __C_DSA_UTILS_POOL__
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+#include "status.h"
+#include "Result.h"
+#include "Allocator.h"
+
+#define C_DSA_POOL_MIN_SHIFT 5
+#define C_DSA_POOL_MAX_SHIFT 12
+#define C_DSA_POOL_MIN_CLASS ((size_t)1 << C_DSA_POOL_MIN_SHIFT)
+#define C_DSA_POOL_MAX_CLASS ((size_t)1 << C_DSA_POOL_MAX_SHIFT)
+#define C_DSA_POOL_CLASS_COUNT (C_DSA_POOL_MAX_SHIFT - C_DSA_POOL_MIN_SHIFT + 1)
+#define C_DSA_POOL_SLAB_SIZE ((size_t)1 << 16)
+
+typedef struct PoolSlab PoolSlab;
+typedef struct PoolNode PoolNode;
+typedef struct Pool Pool;
+
+struct PoolSlab {
+  PoolSlab *next;
+  _Alignas(max_align_t) char data[];
+};
+
+struct PoolNode {
+  PoolNode *next;
+};
+
+/**
+ * @struct Pool
+ * @author andarling
+ * @date 14/10/2026
+ * @brief a free list per size class and the list of slabs they are carved from
+ */
+struct Pool {
+  PoolNode *free_lists[C_DSA_POOL_CLASS_COUNT];
+  PoolSlab *slabs;
+  Allocator allocator;
+};
+
+C_DSA_API void *alloc_Pool(Pool *pool, size_t bytes);
+C_DSA_API void *realloc_Pool(Pool *pool, void *ptr, size_t old_bytes, size_t new_bytes);
+C_DSA_API void release_Pool(Pool *pool, void *ptr, size_t bytes);
+
+C_DSA_API void *pool_alloc(void *ctx, size_t bytes) {
+  return alloc_Pool((Pool*)ctx, bytes);
+}
+
+C_DSA_API void *pool_realloc(void *ctx, void *ptr, size_t old_bytes, size_t new_bytes) {
+  return realloc_Pool((Pool*)ctx, ptr, old_bytes, new_bytes);
+}
+
+C_DSA_API void pool_free(void *ctx, void *ptr, size_t bytes) {
+  release_Pool((Pool*)ctx, ptr, bytes);
+}
+
+/**
+ * @brief the size class of an allocation of \i `bytes` bytes, or
+ * \c `C_DSA_POOL_CLASS_COUNT` if it is too big for the pool
+ */
+C_DSA_API size_t size_class_Pool(size_t bytes) {
+  if (bytes > C_DSA_POOL_MAX_CLASS) return C_DSA_POOL_CLASS_COUNT;
+  size_t index = 0, class_size = C_DSA_POOL_MIN_CLASS;
+  while (class_size < bytes) {
+    class_size <<= 1;
+    index++;
+  }
+  return index;
+}
+
+/**
+ * @fn Result new_Pool(void)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to a new empty pool
+ *
+ * @return a \c `Result` type to the successfully allocated pool or a error message
+ */
+C_DSA_API Result new_Pool(void) {
+  Pool *result = (Pool*)malloc(sizeof(Pool));
+  if (!result) {
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+  for (size_t i = 0; i < C_DSA_POOL_CLASS_COUNT; i++) {
+    result->free_lists[i] = NULL;
+  }
+  result->slabs = NULL;
+  result->allocator = (Allocator) {
+    .alloc = pool_alloc,
+    .realloc = pool_realloc,
+    .free = pool_free,
+    .ctx = result
+  };
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn void free_Pool(Pool **pool)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief deallocate every slab of the pool and set the pointer to NULL
+ *
+ * Blocks bigger than \c `C_DSA_POOL_MAX_CLASS` are not owned by the pool and
+ * must be released before.
+ *
+ * @param[in] pool a pointer to the address of the pool
+ * (if pool is a null pointer then exits the function)
+ *
+ * @return void
+ */
+C_DSA_API void free_Pool(Pool **pool) {
+  if (!pool || !*pool) return;
+  PoolSlab *slab = (*pool)->slabs;
+  while (slab) {
+    PoolSlab *next = slab->next;
+    free(slab);
+    slab = next;
+  }
+  free(*pool);
+  *pool = NULL;
+}
+
+/**
+ * @fn void *alloc_Pool(Pool *pool, size_t bytes)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief allocate a block of at least \i `bytes` bytes
+ *
+ * @param[in] pool a pointer to \c `Pool` type
+ * @param[in] bytes the number of bytes to allocate
+ *
+ * @return a pointer to the allocated memory or a null pointer on failure
+ */
+C_DSA_API void *alloc_Pool(Pool *pool, size_t bytes) {
+  if (!pool) return NULL;
+  size_t index = size_class_Pool(bytes);
+  if (index == C_DSA_POOL_CLASS_COUNT) return malloc(bytes);
+
+  if (!pool->free_lists[index]) {
+    PoolSlab *slab = (PoolSlab*)malloc(sizeof(PoolSlab) + C_DSA_POOL_SLAB_SIZE);
+    if (!slab) return NULL;
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+
+    // threads the whole slab into the free list of the class
+    size_t class_size = C_DSA_POOL_MIN_CLASS << index;
+    for (size_t offset = 0; offset + class_size <= C_DSA_POOL_SLAB_SIZE; offset += class_size) {
+      PoolNode *node = (PoolNode*)(slab->data + offset);
+      node->next = pool->free_lists[index];
+      pool->free_lists[index] = node;
+    }
+  }
+
+  PoolNode *node = pool->free_lists[index];
+  pool->free_lists[index] = node->next;
+  return node;
+}
+
+/**
+ * @fn void *realloc_Pool(Pool *pool, void *ptr, size_t old_bytes, size_t new_bytes)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief resize a block of the pool
+ *
+ * If both sizes fall in the same class, the block is kept.
+ *
+ * @param[in] pool a pointer to \c `Pool` type
+ * @param[in] ptr the block to resize (if null, it acts as \c `alloc_Pool`)
+ * @param[in] old_bytes the size the block was allocated with
+ * @param[in] new_bytes the new size of the block
+ *
+ * @return a pointer to the resized memory or a null pointer on failure
+ */
+C_DSA_API void *realloc_Pool(Pool *pool, void *ptr, size_t old_bytes, size_t new_bytes) {
+  if (!pool) return NULL;
+  if (!ptr) return alloc_Pool(pool, new_bytes);
+
+  size_t old_index = size_class_Pool(old_bytes), new_index = size_class_Pool(new_bytes);
+  if (old_index == new_index) {
+    return old_index == C_DSA_POOL_CLASS_COUNT ? realloc(ptr, new_bytes) : ptr;
+  }
+
+  void *result = alloc_Pool(pool, new_bytes);
+  if (!result) return NULL;
+  memcpy(result, ptr, old_bytes < new_bytes ? old_bytes : new_bytes);
+  release_Pool(pool, ptr, old_bytes);
+  return result;
+}
+
+/**
+ * @fn void release_Pool(Pool *pool, void *ptr, size_t bytes)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief give a block back to the free list of its class
+ *
+ * @param[in] pool a pointer to \c `Pool` type
+ * @param[in] ptr the block to release (if null, nothing is done)
+ * @param[in] bytes the size the block was allocated with
+ *
+ * @return void
+ */
+C_DSA_API void release_Pool(Pool *pool, void *ptr, size_t bytes) {
+  if (!pool || !ptr) return;
+  size_t index = size_class_Pool(bytes);
+  if (index == C_DSA_POOL_CLASS_COUNT) {
+    free(ptr);
+    return;
+  }
+  PoolNode *node = (PoolNode*)ptr;
+  node->next = pool->free_lists[index];
+  pool->free_lists[index] = node;
+}
+
+/**
+ * @fn const Allocator *allocator_Pool(Pool *pool)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief return the \c `Allocator` allocating from \i `pool`
+ *
+ * @param[in] pool a pointer to \c `Pool` type
+ *
+ * @return a pointer to the allocator, valid as long as \i `pool`
+ */
+C_DSA_API const Allocator *allocator_Pool(Pool *pool) {
+  if (!pool) return NULL;
+  return &pool->allocator;
+}
+
+#endif // __C_DSA_UTILS_POOL__
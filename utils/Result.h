@@ -1,6 +1,7 @@
 #ifndef __C_DSA_UTILS_RESULT__
 #define __C_DSA_UTILS_RESULT__
 
+#include "config.h"
 #include "status.h"
 #include <stdlib.h>
 
@@ -11,7 +12,8 @@ typedef struct Result Result;
  * 
  * The Result type will have an error code with status_t type and the user can
  * read the detailed error message with  error_msg,
- * else it return a void pointer to the data (must be allocated dynamically)
+ * else it return a void pointer to the data (allocated dynamically, or laid out
+ * in a caller-provided buffer by the \c `init_T` functions)
  */
 struct Result {
   status_t ok;
@@ -29,7 +31,7 @@ struct Result {
  * 
  * @return a message if an error occured, else a null pointer
  */
-const char *get_data_p(Result *from, void **to) {
+C_DSA_API const char *get_data_p(Result *from, void **to) {
   if (from == NULL || to == NULL) {
     return "ValueError: cannot access a null pointer.\n";
   }
@@ -43,7 +45,7 @@ const char *get_data_p(Result *from, void **to) {
   }
 }
 
-const char *get_data(Result from, void **to) {
+C_DSA_API const char *get_data(Result from, void **to) {
   if (to == NULL) return NULL;
   if (from.ok != NO_ERROR) return from.error_msg;
   else {
@@ -0,0 +1,268 @@
+/**
+ * @file ThreadPool.h
+ * @brief a small fork-join thread pool for the parallel algorithms
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details A \c `ThreadPool` keeps worker threads (POSIX threads) sleeping until
+ * \c `run_ThreadPool` hands them a job: a function called once for every index
+ * in [0, \i `task_count` - 1]. The workers and the calling thread claim the
+ * next index with an atomic increment until there is none left, so a thread
+ * finishing its tasks early takes more of them instead of waiting for the
+ * slower ones (the tasks should be a few times more than the threads).
+ * \c `run_ThreadPool` returns when every task is done.
+ * Only one thread may call \c `run_ThreadPool` on a pool at the same time and a
+ * task must not call it on the same pool.
+ *
+ * ThreadPool's APIs:
+ * @li new_T : create type T and start its threads
+ * @li free_T : stop the threads and deallocate type T
+ * @li run_T : run a job on the threads of T and wait for it
+ * @li thread_count_T : the number of threads running the tasks of type T
+ * @li chunk_count_T : how many tasks to split a range of elements in
+ * @li chunk_begin_T : the first element of a task
+ */
+#ifndef __C_DSA_UTILS_THREAD_POOL__
+#define __C_DSA_UTILS_THREAD_POOL__
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "config.h"
+#include "status.h"
+#include "Result.h"
+
+/**
+ * @brief the smallest number of elements worth a task of their own
+ */
+#ifndef C_DSA_PARALLEL_GRAIN
+#define C_DSA_PARALLEL_GRAIN 4096
+#endif
+
+typedef struct ThreadPool ThreadPool;
+
+/**
+ * @brief a task of a job, called with the job's context and the task's index
+ */
+typedef void (*ThreadPoolTask)(void *ctx, size_t index);
+
+/**
+ * @struct ThreadPool
+ * @author andarling
+ * @date 14/10/2026
+ * @brief worker threads and the job they are running
+ *
+ * \i `thread_count` counts the calling thread, so there are
+ * \i `thread_count` - 1 \i `threads`. \i `generation` is increased for every
+ * job and \i `active` is the number of workers which did not finish it yet.
+ */
+struct ThreadPool {
+  size_t thread_count;
+  pthread_t *threads;
+  pthread_mutex_t lock;
+  pthread_cond_t work_ready, work_done;
+  size_t generation, active;
+  int shutdown;
+  ThreadPoolTask task;
+  void *ctx;
+  size_t task_count;
+  _Alignas(C_DSA_CACHE_LINE_SIZE) atomic_size_t next_task;
+};
+
+C_DSA_API void claim_tasks_ThreadPool(ThreadPool *pool) {
+  size_t index;
+  while ((index = atomic_fetch_add_explicit(&pool->next_task, 1, memory_order_relaxed)) < pool->task_count) {
+    pool->task(pool->ctx, index);
+  }
+}
+
+C_DSA_API void *worker_ThreadPool(void *arg) {
+  ThreadPool *pool = (ThreadPool*)arg;
+  size_t seen = 0;
+  pthread_mutex_lock(&pool->lock);
+  for (;;) {
+    while (pool->generation == seen && !pool->shutdown) {
+      pthread_cond_wait(&pool->work_ready, &pool->lock);
+    }
+    if (pool->shutdown) break;
+    seen = pool->generation;
+    pthread_mutex_unlock(&pool->lock);
+
+    claim_tasks_ThreadPool(pool);
+
+    pthread_mutex_lock(&pool->lock);
+    if (--pool->active == 0) pthread_cond_signal(&pool->work_done);
+  }
+  pthread_mutex_unlock(&pool->lock);
+  return NULL;
+}
+
+/**
+ * @fn void free_ThreadPool(ThreadPool **pool)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief stop and join every thread, deallocate the pool and set the pointer to NULL
+ *
+ * @param[in] pool a pointer to the address of the pool
+ * (if pool is a null pointer then exits the function)
+ *
+ * @return void
+ */
+C_DSA_API void free_ThreadPool(ThreadPool **pool) {
+  if (!pool || !*pool) return;
+  ThreadPool *p = *pool;
+  pthread_mutex_lock(&p->lock);
+  p->shutdown = 1;
+  pthread_cond_broadcast(&p->work_ready);
+  pthread_mutex_unlock(&p->lock);
+  for (size_t i = 0; i + 1 < p->thread_count; i++) {
+    pthread_join(p->threads[i], NULL);
+  }
+  pthread_cond_destroy(&p->work_done);
+  pthread_cond_destroy(&p->work_ready);
+  pthread_mutex_destroy(&p->lock);
+  free(p->threads);
+  free(p);
+  *pool = NULL;
+}
+
+/**
+ * @fn Result new_ThreadPool(size_t thread_count)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief returns a \c `Result` type to a new pool with its threads started
+ *
+ * @param[in] thread_count the number of threads running the tasks, the thread
+ * calling \c `run_ThreadPool` included
+ * (if 0 then defaults to the number of online processors)
+ *
+ * @return a \c `Result` type to the successfully created pool or a error message
+ */
+C_DSA_API Result new_ThreadPool(size_t thread_count) {
+  if (!thread_count) {
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    thread_count = online > 0 ? (size_t)online : 1;
+  }
+
+  ThreadPool *result = (ThreadPool*)malloc(sizeof(ThreadPool));
+  pthread_t *threads = (pthread_t*)malloc(sizeof(pthread_t) * (thread_count > 1 ? thread_count - 1 : 1));
+  if (!result || !threads) {
+    free(result);
+    free(threads);
+    return (Result) {
+      .ok = HEAP_FAILURE,
+      .error_msg = "AllocationError: Not enough memory in the heap"
+    };
+  }
+  result->thread_count = 1;
+  result->threads = threads;
+  pthread_mutex_init(&result->lock, NULL);
+  pthread_cond_init(&result->work_ready, NULL);
+  pthread_cond_init(&result->work_done, NULL);
+  result->generation = result->active = 0;
+  result->shutdown = 0;
+  result->task = NULL, result->ctx = NULL, result->task_count = 0;
+  atomic_init(&result->next_task, 0);
+
+  // thread_count - 1 is the number of threads started so far
+  for (; result->thread_count < thread_count; result->thread_count++) {
+    if (pthread_create(&threads[result->thread_count - 1], NULL, worker_ThreadPool, result)) {
+      free_ThreadPool(&result);
+      return (Result) {
+        .ok = HEAP_FAILURE,
+        .error_msg = "AllocationError: cannot start a thread\n"
+      };
+    }
+  }
+  return (Result) {
+    .ok = NO_ERROR,
+    .data = result
+  };
+}
+
+/**
+ * @fn status_t run_ThreadPool(ThreadPool *pool, size_t task_count, ThreadPoolTask task, void *ctx)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief call \i `task`(\i `ctx`, i) for every i in [0, \i `task_count` - 1]
+ *
+ * The calling thread runs tasks too and the function returns when every task
+ * is done, the effects of the tasks are then visible to the caller.
+ *
+ * @param[in] pool a pointer to \c `ThreadPool` type
+ * (if pool is a null pointer then the tasks are run by the calling thread)
+ * @param[in] task_count the number of tasks
+ * @param[in] task the function run by every task
+ * (task is not a null pointer)
+ * @param[in] ctx the context given to every task
+ *
+ * @return 0 if success and non-zero if an error occurs
+ */
+C_DSA_API status_t run_ThreadPool(ThreadPool *pool, size_t task_count, ThreadPoolTask task, void *ctx) {
+  if (!task) return SEGFAULT;
+  if (!pool || pool->thread_count == 1 || task_count == 1) {
+    for (size_t i = 0; i < task_count; i++) task(ctx, i);
+    return NO_ERROR;
+  }
+
+  pthread_mutex_lock(&pool->lock);
+  pool->task = task, pool->ctx = ctx, pool->task_count = task_count;
+  atomic_store_explicit(&pool->next_task, 0, memory_order_relaxed);
+  pool->active = pool->thread_count - 1;
+  pool->generation++;
+  pthread_cond_broadcast(&pool->work_ready);
+  pthread_mutex_unlock(&pool->lock);
+
+  claim_tasks_ThreadPool(pool);
+
+  pthread_mutex_lock(&pool->lock);
+  while (pool->active) {
+    pthread_cond_wait(&pool->work_done, &pool->lock);
+  }
+  pthread_mutex_unlock(&pool->lock);
+  return NO_ERROR;
+}
+
+/**
+ * @fn size_t thread_count_ThreadPool(ThreadPool *pool)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the number of threads running the tasks, 1 if pool is a null pointer
+ */
+C_DSA_API size_t thread_count_ThreadPool(ThreadPool *pool) {
+  return pool ? pool->thread_count : 1;
+}
+
+/**
+ * @fn size_t chunk_count_ThreadPool(ThreadPool *pool, size_t n, size_t tasks_per_thread)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the number of tasks to split \i `n` elements in
+ *
+ * \i `tasks_per_thread` tasks for every thread of \i `pool`, but no task gets
+ * less than \c `C_DSA_PARALLEL_GRAIN` elements.
+ *
+ * @return a number of tasks in [1, \i `n`] (1 if n is 0)
+ */
+C_DSA_API size_t chunk_count_ThreadPool(ThreadPool *pool, size_t n, size_t tasks_per_thread) {
+  size_t wanted = thread_count_ThreadPool(pool) * (tasks_per_thread ? tasks_per_thread : 1);
+  size_t most = n / C_DSA_PARALLEL_GRAIN;
+  if (wanted > most) wanted = most;
+  return wanted ? wanted : 1;
+}
+
+/**
+ * @fn size_t chunk_begin_ThreadPool(size_t n, size_t chunks, size_t index)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the first element of the \i `index`-th of \i `chunks` even chunks of
+ * \i `n` elements, or \i `n` if index is \i `chunks`
+ */
+C_DSA_API size_t chunk_begin_ThreadPool(size_t n, size_t chunks, size_t index) {
+  size_t extra = n % chunks;
+  return index * (n / chunks) + (index < extra ? index : extra);
+}
+
+#endif // __C_DSA_UTILS_THREAD_POOL__
@@ -0,0 +1,87 @@
+/**
+ * @file checked.h
+ * @brief overflow-checked size arithmetic
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details The constructors compute the bytes of a block from a number of
+ * elements given by the caller, e.g. \i `header + type_size * capacity`, which
+ * wraps around silently when it does not fit in a \c `size_t`: the block is
+ * then much smaller than the array believes it is.
+ * Every such computation goes through these functions, which return
+ * \c `INVALID_SIZE` instead of a wrapped result. They use the overflow
+ * builtins of GCC and Clang (a multiplication and a flag test) and a division
+ * elsewhere.
+ *
+ * Checked's APIs:
+ * @li checked_add : the sum of two sizes
+ * @li checked_mul : the product of two sizes
+ * @li checked_bytes : the bytes of a header followed by elements
+ */
+#ifndef __C_DSA_UTILS_CHECKED__
+#define __C_DSA_UTILS_CHECKED__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "status.h"
+
+/**
+ * @fn status_t checked_add(size_t a, size_t b, size_t *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write \i `a` + \i `b` to \i `out`
+ *
+ * @return 0 if success, \c `INVALID_SIZE` if the sum does not fit in a
+ * \c `size_t`, in which case \i `out` is not written
+ */
+C_DSA_API status_t checked_add(size_t a, size_t b, size_t *out) {
+#if defined(__GNUC__) || defined(__clang__)
+  size_t sum;
+  if (C_DSA_UNLIKELY(__builtin_add_overflow(a, b, &sum))) return INVALID_SIZE;
+  *out = sum;
+#else
+  if (C_DSA_UNLIKELY(a > SIZE_MAX - b)) return INVALID_SIZE;
+  *out = a + b;
+#endif
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t checked_mul(size_t a, size_t b, size_t *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write \i `a` * \i `b` to \i `out`
+ *
+ * @return 0 if success, \c `INVALID_SIZE` if the product does not fit in a
+ * \c `size_t`, in which case \i `out` is not written
+ */
+C_DSA_API status_t checked_mul(size_t a, size_t b, size_t *out) {
+#if defined(__GNUC__) || defined(__clang__)
+  size_t product;
+  if (C_DSA_UNLIKELY(__builtin_mul_overflow(a, b, &product))) return INVALID_SIZE;
+  *out = product;
+#else
+  if (C_DSA_UNLIKELY(b && a > SIZE_MAX / b)) return INVALID_SIZE;
+  *out = a * b;
+#endif
+  return NO_ERROR;
+}
+
+/**
+ * @fn status_t checked_bytes(size_t header, size_t count, size_t type_size, size_t *out)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief write \i `header` + \i `count` * \i `type_size` to \i `out`
+ *
+ * @return 0 if success, \c `INVALID_SIZE` if the result does not fit in a
+ * \c `size_t`, in which case \i `out` is not written
+ */
+C_DSA_API status_t checked_bytes(size_t header, size_t count, size_t type_size, size_t *out) {
+  size_t bytes;
+  if (checked_mul(count, type_size, &bytes) != NO_ERROR) return INVALID_SIZE;
+  return checked_add(header, bytes, out);
+}
+
+#endif // __C_DSA_UTILS_CHECKED__
@@ -0,0 +1,53 @@
+/**
+ * @file config.h
+ * @brief build configuration shared by every header
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details The library is header-only: every function is defined with
+ * \c `C_DSA_API` linkage, which is \c `static inline` unless it is defined before
+ * including any header. Every translation unit gets its own internal copy, so
+ * the headers can be included from any number of translation units without
+ * duplicate symbols, and the compiler is free to inline every call (unused
+ * functions are discarded).
+ * \c `C_DSA_API` can be overriden to add attributes, e.g.
+ * \c `#define C_DSA_API static inline __attribute__((always_inline))`.
+ *
+ * \c `C_DSA_CACHE_LINE_SIZE` is the size in bytes the concurrent data structures
+ * pad their shared counters to, so that two threads writing different counters
+ * do not share a cache line (64 unless it is defined before).
+ *
+ * \c `C_DSA_LIKELY(x)` and \c `C_DSA_UNLIKELY(x)` tell the compiler which way
+ * a check usually goes, so the error paths are laid out away from the hot path
+ * (they are plain conditions on compilers without \c `__builtin_expect`).
+ *
+ * \c `C_DSA_PREFETCH(p)` asks for the cache line holding \i `p` ahead of a read,
+ * it never faults, even for an address out of the data (it does nothing on
+ * compilers without \c `__builtin_prefetch`).
+ */
+#ifndef __C_DSA_UTILS_CONFIG__
+#define __C_DSA_UTILS_CONFIG__
+
+#ifndef C_DSA_API
+#define C_DSA_API static inline
+#endif
+
+#ifndef C_DSA_CACHE_LINE_SIZE
+#define C_DSA_CACHE_LINE_SIZE 64
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define C_DSA_LIKELY(x) __builtin_expect(!!(x), 1)
+#define C_DSA_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+#define C_DSA_LIKELY(x) (x)
+#define C_DSA_UNLIKELY(x) (x)
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define C_DSA_PREFETCH(p) __builtin_prefetch(p)
+#else
+#define C_DSA_PREFETCH(p) ((void)(p))
+#endif
+
+#endif // __C_DSA_UTILS_CONFIG__
@@ -0,0 +1,144 @@
+/**
+ * @file instrument.h
+ * @brief opt-in counters of the allocations and accesses of the arrays
+ * @author andarling
+ * @date 14/10/2026
+ *
+ * @details Defining \c `C_DSA_INSTRUMENT` (for the whole program) makes the
+ * array families count, per thread, their allocations, the bytes they hold,
+ * their appends and removals and the bytes their clones copy. Without it, the
+ * counting macros expand to nothing and cost nothing, and
+ * \c `snapshot_Instrument` reports zeros.
+ * The counters are \c `_Thread_local`, so counting takes no lock nor atomic
+ * operation. As the library is header-only, exactly one translation unit must
+ * define \c `C_DSA_INSTRUMENT_IMPLEMENTATION` before including any header of
+ * the library to hold their definition.
+ * Counters are kept per family: \c `StrictArray_int` counts as a
+ * \c `StrictArray`. An array freed by another thread than the one which
+ * allocated it moves the live bytes of both threads, only the sum over every
+ * thread is meaningful then.
+ *
+ * Instrument's APIs:
+ * @li snapshot_Instrument : copy the counters of the calling thread
+ * @li reset_Instrument : clear the counters of the calling thread
+ * @li name_Instrument : the name of a family of arrays
+ */
+#ifndef __C_DSA_UTILS_INSTRUMENT__
+#define __C_DSA_UTILS_INSTRUMENT__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "config.h"
+
+/**
+ * @brief the instrumented families of arrays
+ */
+typedef enum {
+  C_DSA_STRICT_ARRAY,
+  C_DSA_ARRAY,
+  C_DSA_DYNAMIC_ARRAY,
+  C_DSA_FAMILY_COUNT
+} instrument_family_t;
+
+typedef struct InstrumentCounters InstrumentCounters;
+
+/**
+ * @struct InstrumentCounters
+ * @author andarling
+ * @date 14/10/2026
+ * @brief what a family of arrays did on one thread
+ *
+ * \i `live_bytes` is signed as a thread can free what another one allocated,
+ * \i `peak_bytes` is its greatest value since the last reset.
+ */
+struct InstrumentCounters {
+  size_t allocations, frees, resizes;
+  int64_t live_bytes, peak_bytes;
+  size_t pushes, pops, failed_pushes;
+  size_t clones, clone_bytes;
+};
+
+#ifdef C_DSA_INSTRUMENT
+
+extern _Thread_local InstrumentCounters c_dsa_counters[C_DSA_FAMILY_COUNT];
+
+#ifdef C_DSA_INSTRUMENT_IMPLEMENTATION
+_Thread_local InstrumentCounters c_dsa_counters[C_DSA_FAMILY_COUNT];
+#endif
+
+C_DSA_API void add_live_bytes_Instrument(instrument_family_t family, int64_t bytes) {
+  InstrumentCounters *counters = c_dsa_counters + family;
+  counters->live_bytes += bytes;
+  if (counters->live_bytes > counters->peak_bytes) counters->peak_bytes = counters->live_bytes;
+}
+
+#define C_DSA_COUNT_ALLOC(family, bytes)                                       \
+  (c_dsa_counters[family].allocations++, add_live_bytes_Instrument(family, (int64_t)(bytes)))
+#define C_DSA_COUNT_FREE(family, bytes)                                        \
+  (c_dsa_counters[family].frees++, add_live_bytes_Instrument(family, -(int64_t)(bytes)))
+#define C_DSA_COUNT_RESIZE(family, old_bytes, new_bytes)                       \
+  (c_dsa_counters[family].resizes++,                                           \
+   add_live_bytes_Instrument(family, (int64_t)(new_bytes) - (int64_t)(old_bytes)))
+#define C_DSA_COUNT_PUSH(family, count) (c_dsa_counters[family].pushes += (count))
+#define C_DSA_COUNT_POP(family, count) (c_dsa_counters[family].pops += (count))
+#define C_DSA_COUNT_FAILED_PUSH(family) (c_dsa_counters[family].failed_pushes++)
+#define C_DSA_COUNT_CLONE(family, bytes)                                       \
+  (c_dsa_counters[family].clones++, c_dsa_counters[family].clone_bytes += (bytes))
+
+#else
+
+#define C_DSA_COUNT_ALLOC(family, bytes) ((void)0)
+#define C_DSA_COUNT_FREE(family, bytes) ((void)0)
+#define C_DSA_COUNT_RESIZE(family, old_bytes, new_bytes) ((void)0)
+#define C_DSA_COUNT_PUSH(family, count) ((void)0)
+#define C_DSA_COUNT_POP(family, count) ((void)0)
+#define C_DSA_COUNT_FAILED_PUSH(family) ((void)0)
+#define C_DSA_COUNT_CLONE(family, bytes) ((void)0)
+
+#endif // C_DSA_INSTRUMENT
+
+/**
+ * @fn void snapshot_Instrument(InstrumentCounters out[C_DSA_FAMILY_COUNT])
+ * @author andarling
+ * @date 14/10/2026
+ * @brief copy the counters of the calling thread, one per family
+ *
+ * @param[out] out the counters, indexed by \c `instrument_family_t`
+ * (out is not a null pointer)
+ */
+C_DSA_API void snapshot_Instrument(InstrumentCounters out[C_DSA_FAMILY_COUNT]) {
+#ifdef C_DSA_INSTRUMENT
+  memcpy(out, c_dsa_counters, sizeof(c_dsa_counters));
+#else
+  memset(out, 0, sizeof(InstrumentCounters) * C_DSA_FAMILY_COUNT);
+#endif
+}
+
+/**
+ * @fn void reset_Instrument(void)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief clear the counters of the calling thread
+ *
+ * The live bytes are cleared too, so they only count what happens afterwards.
+ */
+C_DSA_API void reset_Instrument(void) {
+#ifdef C_DSA_INSTRUMENT
+  memset(c_dsa_counters, 0, sizeof(c_dsa_counters));
+#endif
+}
+
+/**
+ * @fn const char *name_Instrument(instrument_family_t family)
+ * @author andarling
+ * @date 14/10/2026
+ * @brief the name of \i `family`, or a null pointer if it is not one
+ */
+C_DSA_API const char *name_Instrument(instrument_family_t family) {
+  static const char *names[C_DSA_FAMILY_COUNT] = { "StrictArray", "Array", "DynamicArray" };
+  return (size_t)family < C_DSA_FAMILY_COUNT ? names[family] : NULL;
+}
+
+#endif // __C_DSA_UTILS_INSTRUMENT__
@@ -9,6 +9,7 @@
  * SizeError
  * AllocationError
  * ValueError
+ * IOError
  */
 
 typedef enum status_t status_t;
@@ -25,7 +26,9 @@ enum status_t {
   NO_SPACE,
   INVALID_SIZE,
   HEAP_FAILURE,
-  INVALID_INDEX
+  INVALID_INDEX,
+  EMPTY_CONTAINER, // nothing to remove
+  IO_FAILURE // a file or mapping operation failed
 };
 
 #endif // __C_STATUS__
\ No newline at end of file